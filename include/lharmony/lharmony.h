@@ -18,13 +18,22 @@
 
 // IWYU pragma: begin_exports
 #include "./lharmony_Pitch.h"
+#include "./lharmony_PitchBuffer.h"
 #include "./lharmony_PitchClass.h"
+#include "./lharmony_PitchClassSet.h"
+#include "./lharmony_KeyboardState.h"
+#include "./lharmony_PitchCents.h"
 #include "./lharmony_PitchUtils.h"
+#include "./lharmony_TuningReference.h"
 
 #include "./lharmony_Interval.h"
 #include "./lharmony_IntervalConstants.h"
+#include "./lharmony_IntervalNames.h"
 #include "./lharmony_CompoundInterval.h"
 #include "./lharmony_MicrotonalInterval.h"
+#include "./lharmony_MelodicInterval.h"
+#include "./lharmony_RatioInterval.h"
+#include "./lharmony_RatioRecognizer.h"
 
 #include "./lharmony_Chord.h"
 
@@ -32,6 +41,9 @@
 #include "./lharmony_Chromatic.h"
 #include "./lharmony_KeySignature.h"
 #include "./lharmony_KeySignatureConstants.h"
+#include "./lharmony_PitchSpelling.h"
+#include "./lharmony_PitchNames.h"
+#include "./lharmony_PitchQuantizer.h"
 #include "./lharmony_Mode.h"
 #include "./lharmony_Octatonic.h"
 #include "./lharmony_WholeTone.h"
@@ -14,10 +14,14 @@
 
 #pragma once
 
+#include <cstddef>
+#include <functional>
 #include <initializer_list>
 #include <vector>
 #include "lharmony/lharmony_Export.h"
+#include "lharmony/lharmony_KeyboardState.h"
 #include "lharmony/lharmony_Pitch.h"
+#include "lharmony/lharmony_PitchClassSet.h"
 
 /** @file
 	This file defines the \c Chord class.
@@ -29,7 +33,6 @@ namespace limes::harmony
 {
 
 class Interval;
-struct PitchClass;
 
 namespace scales
 {
@@ -59,6 +62,11 @@ class LHARM_EXPORT Chord final
 	 */
 	explicit Chord (const std::initializer_list<int>& midiNotes);
 	explicit Chord (const std::initializer_list<Pitch>& midiNotes);
+
+	/** Creates a %chord from the notes that are on in a KeyboardState.
+		The notes are already sorted and unique, so this only allocates the %chord's storage.
+	 */
+	explicit Chord (const KeyboardState& keyboardState);
 	///@}
 
 	Chord (const Chord&) = default;
@@ -67,6 +75,12 @@ class LHARM_EXPORT Chord final
 	Chord (Chord&&) = default;
 	Chord& operator=(Chord&&) = default;
 
+	/** Returns true if the two chords contain exactly the same pitches. */
+	[[nodiscard]] bool operator== (const Chord& other) const noexcept;
+
+	/** Returns true if the two chords do not contain exactly the same pitches. */
+	[[nodiscard]] bool operator!= (const Chord& other) const noexcept;
+
 	/** Returns the number of unique pitches in this %chord. */
 	[[nodiscard]] int getNumPitches() const;
 
@@ -93,11 +107,21 @@ class LHARM_EXPORT Chord final
 	/** Returns a list of %pitch classes present in this %chord. */
 	[[nodiscard]] std::vector<PitchClass> getPitchClasses() const;
 
+	/** Returns the %pitch classes present in this %chord as a PitchClassSet.
+		@see getPitchClasses()
+	 */
+	[[nodiscard]] PitchClassSet getPitchClassSet() const noexcept;
+
 	/** Returns the number of unique %pitch classes present in this %chord.
 		The same %pitch class present in multiple octaves will only be tallied once by this function.
 	 */
 	[[nodiscard]] int getNumUniquePitchClasses() const;
 
+	/** Returns the MIDI notes of this %chord as a KeyboardState.
+		Each %pitch is rounded to its nearest MIDI note; pitches outside the range 0 to 127 are left out.
+	 */
+	[[nodiscard]] KeyboardState getKeyboardState() const noexcept;
+
 	/** Returns a copy of the list of pitches present in this %chord. */
 	[[nodiscard]] std::vector<Pitch> getPitches() const;
 
@@ -108,7 +132,24 @@ class LHARM_EXPORT Chord final
 	[[nodiscard]] Chord applyInterval (Interval interval, bool above);
 
 private:
+	friend struct std::hash<Chord>;
+
 	std::vector<Pitch> pitches;
 };
 
 }  // namespace limes::harmony
+
+namespace std
+{
+
+/** A specialization of \c std::hash for Chord objects.
+	A %chord's pitches are always sorted and unique, so this combines the packed values of its pitches in order, without allocating.
+	@ingroup limes_harmony
+ */
+template <>
+struct LHARM_EXPORT hash<limes::harmony::Chord> final
+{
+	[[nodiscard]] size_t operator() (const limes::harmony::Chord& chord) const noexcept;
+};
+
+}  // namespace std
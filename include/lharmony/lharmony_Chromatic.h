@@ -18,6 +18,7 @@
 #include "lharmony/lharmony_Export.h"
 #include "lharmony/lharmony_Scale.h"
 #include "lharmony/lharmony_PitchClass.h"
+#include "lharmony/lharmony_PitchClassSet.h"
 
 /** @file
 	This file defines the Chromatic %scale class.
@@ -68,6 +69,9 @@ class LHARM_EXPORT Chromatic final : public Scale
 	/** Returns an array of 12 1's, since every %interval in a %chromatic %scale is a half step. */
 	[[nodiscard]] std::vector<int> getIntervalsAsSemitones() const final;
 
+	/** Returns a set containing all 12 %pitch classes. */
+	[[nodiscard]] PitchClassSet getPitchClassSet() const noexcept final;
+
 	/** Returns the %pitch class that this %chromatic %scale starts on. */
 	[[nodiscard]] PitchClass getPitchClassOfRoot() const noexcept final;
 
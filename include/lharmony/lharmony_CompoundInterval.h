@@ -14,9 +14,17 @@
 
 #pragma once
 
-#include <vector>
+#include <cassert>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <iosfwd>
+#include <ranges>
+#include <span>
+#include <string>
 #include "lharmony/lharmony_Export.h"
 #include "lharmony/lharmony_Interval.h"
+#include "lharmony/lharmony_Pitch.h"
 
 /** @file
 	This file defines the \c CompoundInterval class.
@@ -27,63 +35,157 @@
 namespace limes::harmony
 {
 
-class Pitch;
+namespace detail
+{
+
+// adds a fixed number of cents to each value of a simple interval's just intonation cents
+struct AddCents final
+{
+	double cents { 0. };
+
+	[[nodiscard]] constexpr double operator() (double value) const noexcept { return value + cents; }
+};
 
+}  // namespace detail
 
 /** A class for representing intervals larger than an octave.
 
 	Internally, the %interval is represented as a number of whole octaves and an Interval object.
 	This class is capable of representing intervals smaller than an octave, but if you know your %interval is going to be smaller than an octave, prefer to use the Interval class directly.
 
+	Like Interval, this class has no virtual functions and is trivially copyable; it is 4 bytes, and the number of octaves must fit in a signed 16-bit integer.
+	Convert a simple %interval to a compound one with the explicit constructor, and back with getSimpleInterval().
+
 	@ingroup lharmony_intervals
 	@see Interval, MicrotonalInterval
-
-	@todo static assertion tests
  */
-class LHARM_EXPORT CompoundInterval final : public Interval
+class LHARM_EXPORT CompoundInterval final
 {
 public:
 	/** @name Constructors */
 	///@{
+	/** Creates a compound %interval representing a perfect unison. */
+	constexpr CompoundInterval() noexcept = default;
+
 	/** Creates a compound %interval with the given number of octaves and the given simple %interval component.
 		If the simple %interval is a perfect or augmented octave, the number of octaves will be incremented and the simple %interval component will be reduced to a perfect or augmented unison.
 	 */
-	CompoundInterval (int octaves, const Interval& simpleInterval) noexcept;
+	constexpr CompoundInterval (int octaves, const Interval& simpleInterval) noexcept;
 
-	/** Creates a compound %interval from a given kind and quality, eg, major ninth, etc. */
-	CompoundInterval (int kindToUse, Interval::Quality qualityToUse);
+	/** Creates a compound %interval spanning no whole octaves from a simple %interval.
+		A perfect or augmented octave becomes one octave and a perfect or augmented unison.
+	 */
+	constexpr explicit CompoundInterval (const Interval& simpleInterval) noexcept;
+
+	/** Creates a compound %interval from a given kind and quality, eg, major ninth, etc.
+		If the kind or quality are invalid, an exception will be thrown; in a constant expression, this is a compile-time error.
+		@see tryMake()
+	 */
+	constexpr CompoundInterval (int kindToUse, Interval::Quality qualityToUse);
 
 	/** Constructs a compound %interval with the given number of semitones. */
-	explicit CompoundInterval (int numSemitones) noexcept;
+	constexpr explicit CompoundInterval (int numSemitones) noexcept;
 	///@}
 
 	/** @name Creation functions */
 	///@{
+	/** Creates a compound %interval from a given kind and quality, without throwing.
+		This accepts the same arguments as the constructor taking a kind and a quality, but reports invalid arguments through the returned object instead of throwing an exception,
+		so it is safe to call from a realtime thread.
+	 */
+	[[nodiscard]] static constexpr IntervalResult<CompoundInterval> tryMake (int kindToUse, Interval::Quality qualityToUse) noexcept;
+
 	/** Returns a compound %interval object representing the distance between two MIDI notes. */
-	[[nodiscard]] static CompoundInterval fromPitches (int midiPitch1, int midiPitch2) noexcept;
+	[[nodiscard]] static constexpr CompoundInterval fromPitches (int midiPitch1, int midiPitch2) noexcept;
 
 	/** Returns a compound %interval object representing the distance between two pitch objects. */
-	[[nodiscard]] static CompoundInterval fromPitches (const Pitch& pitch1, const Pitch& pitch2) noexcept;
+	[[nodiscard]] static constexpr CompoundInterval fromPitches (const Pitch& pitch1, const Pitch& pitch2) noexcept;
 	///@}
 
 	constexpr CompoundInterval (const CompoundInterval&) = default;
-	CompoundInterval& operator=(const CompoundInterval&) = default;
+	constexpr CompoundInterval& operator=(const CompoundInterval&) = default;
 
 	constexpr CompoundInterval (CompoundInterval&&) = default;
-	CompoundInterval& operator=(CompoundInterval&&) = default;
+	constexpr CompoundInterval& operator=(CompoundInterval&&) = default;
 
-	/** Returns true if the two compound intervals are exactly equal; that is, have the same number of octaves, and their simple %interval components are exactly equal in kind and quality. */
+	~CompoundInterval() = default;
+
+	/** Returns true if the two compound intervals are exactly equal; that is, have the same number of octaves, and their simple %interval components are exactly equal in kind and quality.
+		Perfect and augmented octaves are always stored as a whole number of octaves and a unison, however they are built,
+		so two intervals are equal exactly when neither is ordered before the other.
+	 */
 	[[nodiscard]] constexpr bool operator== (const CompoundInterval& other) const noexcept;
 
 	/** Returns true if the two intervals are not exactly equal. */
 	[[nodiscard]] constexpr bool operator!= (const CompoundInterval& other) const noexcept;
 
-	/** Returns true if this %interval is semantically larger than the other one, taking enharmonic spellings into account. */
+	/** Returns true if the two compound intervals represent the same number of semitones, regardless of their enharmonic spelling. */
+	[[nodiscard]] constexpr bool isEnharmonicTo (const CompoundInterval& other) const noexcept;
+
+	/** The largest number of spellings any number of semitones can have as a compound %interval.
+		For example, 12 semitones can be an augmented seventh, a perfect octave or a diminished ninth.
+	 */
+	static constexpr std::size_t maxSpellings = 3;
+
+	/** Writes every valid spelling of the given number of semitones into the output span, ordered by kind, and returns the number of spellings written.
+		The spellings are built from the constant tables of Interval::getSpellings(), so this never allocates or validates intervals.
+		If the output span holds fewer than maxSpellings elements, the spellings of the largest kinds may not be written.
+		@param semitones The number of semitones. Negative values are treated the same as their magnitude.
+		@param spellings The span to write the spellings into.
+	 */
+	[[nodiscard]] static constexpr std::size_t getSpellings (int semitones, std::span<CompoundInterval> spellings) noexcept;
+
+	/** Returns true if this %interval is semantically larger than the other one, taking enharmonic spellings into account.
+		Intervals are ordered by their number of semitones, and enharmonic intervals by their kind, so a diminished 12th is larger than an augmented 11th.
+	 */
 	[[nodiscard]] constexpr bool operator> (const CompoundInterval& other) const noexcept;
 
 	/** Returns true if this %interval is semantically smaller than the other one, taking enharmonic spellings into account. */
 	[[nodiscard]] constexpr bool operator<(const CompoundInterval& other) const noexcept;
 
+	/** Returns true if this %interval is semantically larger than or equal to the other one. */
+	[[nodiscard]] constexpr bool operator>= (const CompoundInterval& other) const noexcept;
+
+	/** Returns true if this %interval is semantically smaller than or equal to the other one. */
+	[[nodiscard]] constexpr bool operator<= (const CompoundInterval& other) const noexcept;
+
+	/** @name Addition and subtraction
+		Adding or subtracting two compound intervals works on their spellings, so the kinds are added as well as the sizes:
+		a major third plus a minor third is a perfect fifth, and a major tenth plus a perfect fifth is a major 14th.
+		If no %interval of the resulting kind has the resulting size (for example, an augmented fourth plus an augmented fifth would be a doubly augmented octave),
+		the result is spelled from its number of semitones, as by the constructor that takes a number of semitones.
+
+		Like Interval, this class represents the distance between two notes without a direction, so subtracting a larger %interval from a smaller one gives the
+		distance between them. Use MelodicInterval for signed distances.
+	 */
+	///@{
+
+	/** Adds another compound %interval to this one, adding their kinds. */
+	[[nodiscard]] constexpr CompoundInterval operator+ (const CompoundInterval& other) const noexcept;
+
+	/** Adds a number of semitones to this %interval. The result is spelled from its number of semitones. */
+	[[nodiscard]] constexpr CompoundInterval operator+ (int semitonesToAdd) const noexcept;
+
+	/** Adds another compound %interval to this one, adding their kinds. */
+	constexpr CompoundInterval& operator+= (const CompoundInterval& other) noexcept;
+
+	/** Adds a number of semitones to this %interval. The result is spelled from its number of semitones. */
+	constexpr CompoundInterval& operator+= (int semitonesToAdd) noexcept;
+
+	/** Returns the distance between this compound %interval and another one, subtracting their kinds. */
+	[[nodiscard]] constexpr CompoundInterval operator- (const CompoundInterval& other) const noexcept;
+
+	/** Subtracts a number of semitones from this %interval. The result is spelled from its number of semitones. */
+	[[nodiscard]] constexpr CompoundInterval operator- (int semitonesToSubtract) const noexcept;
+
+	/** Subtracts another compound %interval from this one, subtracting their kinds. */
+	constexpr CompoundInterval& operator-= (const CompoundInterval& other) noexcept;
+
+	/** Subtracts a number of semitones from this %interval. The result is spelled from its number of semitones. */
+	constexpr CompoundInterval& operator-= (int semitonesToSubtract) noexcept;
+
+	///@}
+
 	/** Returns the number of whole octaves contained in this compound %interval. */
 	[[nodiscard]] constexpr int getNumOctaves() const noexcept;
 
@@ -91,10 +193,10 @@ class LHARM_EXPORT CompoundInterval final : public Interval
 		The %interval object returned by this function will always be a diminished octave or smaller, and may be a perfect unison.
 		@see hasSameSimpleInterval()
 	 */
-	[[nodiscard]] Interval getSimpleInterval() const noexcept;
+	[[nodiscard]] constexpr Interval getSimpleInterval() const noexcept;
 
 	/** Returns the number of semitones this compound %interval represents. */
-	[[nodiscard]] int getNumSemitones() const noexcept final;
+	[[nodiscard]] constexpr int getNumSemitones() const noexcept;
 
 	/** Returns true if the two compound intervals have the same sub-octave component, regardless of how many octaves either compound %interval spans.
 		For example, a major tenth and a major seventeenth would return true, because they are both compound major thirds.
@@ -108,21 +210,105 @@ class LHARM_EXPORT CompoundInterval final : public Interval
 		compoundInterval.getSimpleInterval().getQuality();
 		@endcode
 	 */
-	[[nodiscard]] Interval::Quality getQuality() const noexcept final;
+	[[nodiscard]] constexpr Interval::Quality getQuality() const noexcept;
 
 	/** Returns the kind of this compound %interval as an integer, eg, 9, 10, etc. */
-	[[nodiscard]] int getKind() const noexcept final;
+	[[nodiscard]] constexpr int getKind() const noexcept;
 
-	/** Returns an array of possible cents values this %interval can represent in just intonation, taking enharmonic spelling into account. */
-	[[nodiscard]] std::vector<double> getCents_JustIntonation() const final;
+	/** @name Cents measurements */
+	///@{
+	/** A lazy view of the simple %interval's just intonation cents values, each offset by the compound %interval's octaves. */
+	using JustIntonationCents = std::ranges::transform_view<std::span<const double>, detail::AddCents>;
+
+	/** Returns the possible cents values this %interval can represent in just intonation, taking enharmonic spelling into account.
+		The values are those of Interval::getCents_JustIntonation() plus 1200 cents for each octave, from smallest to largest.
+		The returned view reads from a static table and never allocates.
+	 */
+	[[nodiscard]] constexpr JustIntonationCents getCents_JustIntonation() const noexcept;
+
+	/** Returns the number of cents this %interval represents in equal temperament. */
+	[[nodiscard]] constexpr int getCents_EqualTemperament() const noexcept;
+	///@}
+
+	/** Returns a new pitch object that represents the note this interval's distance above or below the passed pitch object.
+		@param other The pitch object to start from.
+		@param above When true, the returned pitch will be this interval's distance above the passed pitch. When false, the returned pitch will be this interval's distance below the passed pitch.
+	 */
+	[[nodiscard]] constexpr Pitch applyToPitch (Pitch other, bool above) const noexcept;
+
+	/** Returns a string description of this compound %interval, such as "Major 10th". If the \c useShort parameter is true, then an abbreviated string will be returned, such as "M10".
+		Intervals spanning no whole octaves are described in the same way as Interval::getStringDescription().
+	 */
+	[[nodiscard]] std::string getStringDescription (bool useShort = false) const;
+
+	/** @name Packed encodings */
+	///@{
+
+	/** Returns this compound %interval packed into a 32-bit integer.
+		The lowest 8 bits hold the packed value of the simple %interval component (see Interval::getPackedValue()), and the upper 24 bits hold the number of octaves.
+		@see fromPackedValue()
+	 */
+	[[nodiscard]] constexpr std::uint32_t getPackedValue() const noexcept;
+
+	/** Recreates a compound %interval from a value returned by getPackedValue().
+		An exception is thrown if the value does not encode a valid simple %interval.
+	 */
+	[[nodiscard]] static constexpr CompoundInterval fromPackedValue (std::uint32_t packedValue);
+
+	///@}
 
 private:
+	[[noreturn]] static void throwInvalidKindOrQuality (IntervalError error, int kind, Interval::Quality quality);
+
+	[[nodiscard]] static constexpr CompoundInterval fromStepsAndSemitones (int steps, int semitones) noexcept;
+
 	Interval interval;
 
-	int numOctaves { 0 };
+	std::int16_t numOctaves { 0 };
 };
 
+/** Adds a compound %interval to the given pitch and returns a new pitch object at the resulting pitch.
+	@ingroup music_intervals
+ */
+constexpr Pitch operator+ (const Pitch& pitch, const CompoundInterval& interval) noexcept;
+
+/** Subtracts a compound %interval from the given pitch and returns a new pitch object at the resulting pitch.
+	@ingroup music_intervals
+ */
+constexpr Pitch operator- (const Pitch& pitch, const CompoundInterval& interval) noexcept;
+
+/** Converts a span of semitone counts to compound intervals, in the same way as the constructor that takes a number of semitones.
+	Negative counts are converted to the %interval of the same size, as CompoundInterval::fromPitches() does.
+	Each count divided by 12 must fit in a signed 16-bit integer. The output span must be at least as long as the input span.
+	@ingroup lharmony_intervals
+ */
+LHARM_EXPORT void getCompoundIntervals (std::span<const int> semitones, std::span<CompoundInterval> intervals) noexcept;
+
+/** Writes a string description of the CompoundInterval to the output stream.
+
+	@ingroup music_intervals
+	@relates CompoundInterval
+	@see CompoundInterval::getStringDescription()
+ */
+LHARM_EXPORT std::ostream& operator<< (std::ostream& os, const CompoundInterval& value);
 
 }  // namespace limes::harmony
 
 #include "./lharmony_CompoundInterval_impl.h"  // IWYU pragma: export
+
+namespace std
+{
+
+/** A specialization of \c std::hash for CompoundInterval objects.
+	@ingroup lharmony_intervals
+ */
+template <>
+struct hash<limes::harmony::CompoundInterval> final
+{
+	[[nodiscard]] size_t operator() (const limes::harmony::CompoundInterval& interval) const noexcept
+	{
+		return hash<std::uint32_t> {}(interval.getPackedValue());
+	}
+};
+
+}  // namespace std
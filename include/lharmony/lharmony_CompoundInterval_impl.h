@@ -27,6 +27,109 @@
 namespace limes::harmony
 {
 
+constexpr CompoundInterval::CompoundInterval (int octaves, const Interval& simpleInterval) noexcept
+	: interval (simpleInterval), numOctaves (static_cast<std::int16_t> (octaves))
+{
+	assert (octaves >= std::numeric_limits<std::int16_t>::min() && octaves < std::numeric_limits<std::int16_t>::max());
+
+	constexpr auto octave_kind = 8;
+
+	if (interval.getKind() == octave_kind)
+	{
+		const auto quality_ = interval.getQuality();
+
+		if (quality_ != Interval::Quality::Diminished)
+		{
+			++numOctaves;
+			interval = Interval { 0, quality_ };
+		}
+	}
+}
+
+constexpr CompoundInterval::CompoundInterval (const Interval& simpleInterval) noexcept
+	: CompoundInterval (0, simpleInterval)
+{
+}
+
+constexpr CompoundInterval::CompoundInterval (int kindToUse, Interval::Quality qualityToUse)
+{
+	const auto result = tryMake (kindToUse, qualityToUse);
+
+	if (! result)
+		throwInvalidKindOrQuality (result.error(), kindToUse, qualityToUse);
+
+	*this = *result;
+}
+
+constexpr IntervalResult<CompoundInterval> CompoundInterval::tryMake (int kindToUse, Interval::Quality qualityToUse) noexcept
+{
+	if (kindToUse < 0)
+		return IntervalError::InvalidKind;
+
+	if (kindToUse <= 8)
+	{
+		const auto simple = Interval::tryMake (kindToUse, qualityToUse);
+
+		if (! simple)
+			return simple.error();
+
+		// go through the constructor so that perfect and augmented octaves are stored the same way as when built from semitones
+		return CompoundInterval { 0, *simple };
+	}
+
+	const auto octaves = (kindToUse - 1) / 7;
+
+	if (octaves >= std::numeric_limits<std::int16_t>::max())
+		return IntervalError::InvalidKind;
+
+	const auto intervalKind = kindToUse - (7 * octaves);
+
+	// a remainder of 1 is a compound unison, ie, a whole number of octaves,
+	// except that unisons cannot be diminished, so a diminished 15th is stored as an octave and a diminished octave
+	const auto isDiminishedOctave = intervalKind == 1 && qualityToUse == Interval::Quality::Diminished;
+
+	const auto simple = Interval::tryMake (isDiminishedOctave ? 8 : (intervalKind == 1 ? 0 : intervalKind), qualityToUse);
+
+	if (! simple)
+		return simple.error();
+
+	CompoundInterval interval;
+
+	interval.interval	= *simple;
+	interval.numOctaves = static_cast<std::int16_t> (isDiminishedOctave ? octaves - 1 : octaves);
+
+	return interval;
+}
+
+constexpr CompoundInterval::CompoundInterval (int numSemitones) noexcept
+	: interval (Interval::fromNumSemitones (numSemitones % semitonesInOctave))
+{
+	const auto octaves = numSemitones / semitonesInOctave;
+
+	assert (octaves >= std::numeric_limits<std::int16_t>::min() && octaves < std::numeric_limits<std::int16_t>::max());
+
+	numOctaves = static_cast<std::int16_t> (octaves);
+}
+
+constexpr CompoundInterval CompoundInterval::fromPitches (int midiPitch1, int midiPitch2) noexcept
+{
+	const auto distance = midiPitch2 - midiPitch1;
+
+	return CompoundInterval { distance < 0 ? -distance : distance };
+}
+
+constexpr CompoundInterval CompoundInterval::fromPitches (const Pitch& pitch1, const Pitch& pitch2) noexcept
+{
+	return fromPitches (pitch1.getRoundedMidiPitch(), pitch2.getRoundedMidiPitch());
+}
+
+constexpr CompoundInterval CompoundInterval::fromPackedValue (std::uint32_t packedValue)
+{
+	const auto octaves = static_cast<std::int32_t> (packedValue) >> 8;
+
+	return CompoundInterval { octaves, Interval::fromPackedValue (static_cast<std::uint8_t> (packedValue & 0xFF)) };
+}
+
 constexpr bool CompoundInterval::operator== (const CompoundInterval& other) const noexcept
 {
 	return numOctaves == other.numOctaves && interval == other.interval;
@@ -37,20 +140,146 @@ constexpr bool CompoundInterval::operator!= (const CompoundInterval& other) cons
 	return ! (*this == other);
 }
 
-constexpr bool CompoundInterval::operator> (const CompoundInterval& other) const noexcept
+constexpr bool CompoundInterval::isEnharmonicTo (const CompoundInterval& other) const noexcept
+{
+	return getNumSemitones() == other.getNumSemitones();
+}
+
+constexpr std::size_t CompoundInterval::getSpellings (int semitones, std::span<CompoundInterval> spellings) noexcept
 {
-	if (numOctaves < other.numOctaves)
-		return false;
+	const auto magnitude = semitones < 0 ? -semitones : semitones;
+	const auto octaves	 = magnitude / semitonesInOctave;
+
+	std::size_t numWritten = 0;
+
+	// simple intervals of 12 and 13 semitones can also spell this size, one octave lower
+	for (auto numOctaves = octaves - 1; numOctaves <= octaves; ++numOctaves)
+	{
+		if (numOctaves < 0)
+			continue;
 
-	return interval > other.interval;
+		for (const auto& simple : Interval::getSpellings (magnitude - (numOctaves * semitonesInOctave)))
+		{
+			// perfect and augmented octaves would be normalized to the unisons of the next octave, which are also spelled there
+			if (simple.getKind() == 8 && simple.getQuality() != Interval::Quality::Diminished)
+				continue;
+
+			if (numWritten == spellings.size())
+				return numWritten;
+
+			spellings[numWritten++] = CompoundInterval { numOctaves, simple };
+		}
+	}
+
+	return numWritten;
+}
+
+constexpr bool CompoundInterval::operator> (const CompoundInterval& other) const noexcept
+{
+	return other < *this;
 }
 
 constexpr bool CompoundInterval::operator<(const CompoundInterval& other) const noexcept
 {
-	if (numOctaves > other.numOctaves)
-		return false;
+	const auto semitones	  = getNumSemitones();
+	const auto otherSemitones = other.getNumSemitones();
+
+	if (semitones != otherSemitones)
+		return semitones < otherSemitones;
+
+	return getKind() < other.getKind();
+}
+
+constexpr bool CompoundInterval::operator>= (const CompoundInterval& other) const noexcept
+{
+	return ! (*this < other);
+}
+
+constexpr bool CompoundInterval::operator<= (const CompoundInterval& other) const noexcept
+{
+	return ! (other < *this);
+}
+
+constexpr CompoundInterval CompoundInterval::fromStepsAndSemitones (int steps, int semitones) noexcept
+{
+	const auto fromSemitones = [semitones]
+	{
+		return CompoundInterval {} + semitones;
+	};
+
+	if (steps < 0)
+		return fromSemitones();
+
+	auto octaves		 = steps / 7;
+	auto simpleSteps	 = steps % 7;
+	auto simpleSemitones = semitones - (octaves * semitonesInOctave);
+
+	// unisons can't be diminished, so a compound unison that is a semitone short is a diminished octave
+	if (simpleSteps == 0 && simpleSemitones < 0 && octaves > 0)
+	{
+		--octaves;
+		simpleSteps = 7;
+		simpleSemitones += semitonesInOctave;
+	}
+
+	if (simpleSemitones < 0 || simpleSemitones >= static_cast<int> (detail::intervalDenseIndicesByStepsAndSemitones[0].size()))
+		return fromSemitones();
+
+	const auto index = detail::intervalDenseIndicesByStepsAndSemitones[static_cast<std::size_t> (simpleSteps)][static_cast<std::size_t> (simpleSemitones)];
+
+	if (index == Interval::numDenseIndices)
+		return fromSemitones();
+
+	return CompoundInterval { octaves, Interval::fromDenseIndex (index) };
+}
+
+constexpr CompoundInterval CompoundInterval::operator+ (const CompoundInterval& other) const noexcept
+{
+	return fromStepsAndSemitones (getKind() + other.getKind() - 2, getNumSemitones() + other.getNumSemitones());
+}
+
+constexpr CompoundInterval CompoundInterval::operator- (const CompoundInterval& other) const noexcept
+{
+	if (*this < other)
+		return other - *this;
+
+	return fromStepsAndSemitones (getKind() - other.getKind(), getNumSemitones() - other.getNumSemitones());
+}
+
+constexpr CompoundInterval CompoundInterval::operator+ (int semitonesToAdd) const noexcept
+{
+	const auto semitones = getNumSemitones() + semitonesToAdd;
 
-	return interval < other.interval;
+	return CompoundInterval { semitones < 0 ? -semitones : semitones };
+}
+
+constexpr CompoundInterval CompoundInterval::operator- (int semitonesToSubtract) const noexcept
+{
+	return *this + (-semitonesToSubtract);
+}
+
+constexpr CompoundInterval& CompoundInterval::operator+= (const CompoundInterval& other) noexcept
+{
+	*this = *this + other;
+	return *this;
+}
+
+constexpr CompoundInterval& CompoundInterval::operator+= (int semitonesToAdd) noexcept
+{
+	*this = *this + semitonesToAdd;
+	return *this;
+}
+
+constexpr CompoundInterval& CompoundInterval::operator-= (const CompoundInterval& other) noexcept
+{
+	*this = *this - other;
+	return *this;
+}
+
+constexpr CompoundInterval& CompoundInterval::operator-= (int semitonesToSubtract) noexcept
+{
+	*this = *this - semitonesToSubtract;
+	return *this;
 }
 
 constexpr int CompoundInterval::getNumOctaves() const noexcept
@@ -58,9 +287,76 @@ constexpr int CompoundInterval::getNumOctaves() const noexcept
 	return numOctaves;
 }
 
+constexpr Interval CompoundInterval::getSimpleInterval() const noexcept
+{
+	return interval;
+}
+
+constexpr int CompoundInterval::getNumSemitones() const noexcept
+{
+	return interval.getNumSemitones() + (numOctaves * semitonesInOctave);
+}
+
 constexpr bool CompoundInterval::hasSameSimpleInterval (const CompoundInterval& other) const noexcept
 {
 	return interval == other.interval;
 }
 
+constexpr Interval::Quality CompoundInterval::getQuality() const noexcept
+{
+	return interval.getQuality();
+}
+
+constexpr int CompoundInterval::getKind() const noexcept
+{
+	const auto simple = [kind = interval.getKind()]
+	{
+		if (kind > 0)
+			return kind - 1;
+
+		return kind;
+	}();
+
+	return (numOctaves * 7) + simple + 1;
+}
+
+constexpr CompoundInterval::JustIntonationCents CompoundInterval::getCents_JustIntonation() const noexcept
+{
+	return JustIntonationCents { interval.getCents_JustIntonation(), detail::AddCents { static_cast<double> (numOctaves) * 1200. } };
+}
+
+constexpr int CompoundInterval::getCents_EqualTemperament() const noexcept
+{
+	constexpr auto centsPerSemitone = 100;
+
+	return getNumSemitones() * centsPerSemitone;
+}
+
+constexpr Pitch CompoundInterval::applyToPitch (Pitch other, bool above) const noexcept
+{
+	const auto semitones = getNumSemitones();
+	const auto starting	 = other.getRoundedMidiPitch();
+
+	if (above)
+		return Pitch { starting + semitones };
+
+	return Pitch { starting - semitones };
+}
+
+constexpr std::uint32_t CompoundInterval::getPackedValue() const noexcept
+{
+	// the octaves are shifted as a signed value, so that fromPackedValue() can recover negative counts with an arithmetic shift
+	return static_cast<std::uint32_t> (numOctaves * 256) | interval.getPackedValue();
+}
+
+constexpr Pitch operator+ (const Pitch& pitch, const CompoundInterval& interval) noexcept
+{
+	return Pitch { pitch.getRoundedMidiPitch() + interval.getNumSemitones() };
+}
+
+constexpr Pitch operator- (const Pitch& pitch, const CompoundInterval& interval) noexcept
+{
+	return Pitch { pitch.getRoundedMidiPitch() - interval.getNumSemitones() };
+}
+
 }  // namespace limes::harmony
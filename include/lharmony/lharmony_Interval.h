@@ -14,10 +14,18 @@
 
 #pragma once
 
-#include <vector>
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iosfwd>
+#include <span>
 #include <string>
+#include <string_view>
 #include "lharmony/lharmony_Export.h"
 #include "lharmony/lharmony_Pitch.h"
+#include "lharmony/lharmony_PitchUtils.h"
 
 /** @defgroup lharmony_intervals Intervals
 	Utilities for working with musical pitch intervals.
@@ -34,6 +42,118 @@
 namespace limes::harmony
 {
 
+/** An exact frequency ratio of a just intonation %interval, such as 3/2 for a perfect fifth.
+	@ingroup lharmony_intervals
+	@see Interval::getJustRatios()
+ */
+struct LHARM_EXPORT JustRatio final
+{
+	/** The numerator of the ratio. */
+	std::uint32_t numerator { 1 };
+
+	/** The denominator of the ratio. */
+	std::uint32_t denominator { 1 };
+
+	/** Returns the ratio as a floating-point number. */
+	[[nodiscard]] constexpr double getRatio() const noexcept
+	{
+		return static_cast<double> (numerator) / static_cast<double> (denominator);
+	}
+
+	/** Returns the size of the ratio in cents. */
+	[[nodiscard]] constexpr double getCents() const noexcept
+	{
+		return ratioToCents (getRatio());
+	}
+
+	/** Returns true if the two ratios have the same numerator and denominator. */
+	[[nodiscard]] constexpr bool operator== (const JustRatio& other) const noexcept
+	{
+		return numerator == other.numerator && denominator == other.denominator;
+	}
+
+	/** Returns true if the two ratios have a different numerator or denominator. */
+	[[nodiscard]] constexpr bool operator!= (const JustRatio& other) const noexcept
+	{
+		return ! (*this == other);
+	}
+};
+
+/** The reasons that Interval::tryMake() or CompoundInterval::tryMake() can fail.
+	@ingroup lharmony_intervals
+ */
+enum class IntervalError : std::uint8_t
+{
+	InvalidKind,		  ///< The kind was negative, was 1, or spans more octaves than a CompoundInterval can store.
+	InvalidQuality,		  ///< The quality was not one of the Interval::Quality enumerators.
+	InvalidQualityForKind  ///< The quality does not exist for the kind, such as a "major fifth" or a "perfect third".
+};
+
+/** Holds either a successfully created %interval, or the IntervalError describing why it could not be created.
+
+	This is returned by the non-throwing factory functions Interval::tryMake() and CompoundInterval::tryMake(), and mirrors the parts of the \c std::expected interface that they need.
+	It is trivially copyable, never allocates, and every member function can be used in constant expressions.
+
+	@tparam IntervalType Either Interval or CompoundInterval.
+	@ingroup lharmony_intervals
+ */
+template <typename IntervalType>
+class IntervalResult final
+{
+public:
+	/** Creates a result holding a valid %interval. */
+	constexpr IntervalResult (const IntervalType& intervalToUse) noexcept  // NOLINT
+		: result (intervalToUse)
+	{
+	}
+
+	/** Creates a result holding an error. */
+	constexpr IntervalResult (IntervalError errorToUse) noexcept  // NOLINT
+		: error_ (errorToUse), valid (false)
+	{
+	}
+
+	/** Returns true if this result holds a valid %interval. */
+	[[nodiscard]] constexpr bool has_value() const noexcept { return valid; }
+
+	/** Returns true if this result holds a valid %interval. */
+	[[nodiscard]] constexpr explicit operator bool() const noexcept { return valid; }
+
+	/** Returns the %interval. This result must hold a valid %interval. */
+	[[nodiscard]] constexpr const IntervalType& operator*() const noexcept
+	{
+		assert (valid);
+		return result;
+	}
+
+	/** Returns a pointer to the %interval. This result must hold a valid %interval. */
+	[[nodiscard]] constexpr const IntervalType* operator->() const noexcept
+	{
+		assert (valid);
+		return &result;
+	}
+
+	/** Returns the %interval if this result holds one, otherwise returns the fallback. */
+	[[nodiscard]] constexpr IntervalType value_or (const IntervalType& fallback) const noexcept
+	{
+		return valid ? result : fallback;
+	}
+
+	/** Returns the reason the %interval could not be created. This result must not hold a valid %interval. */
+	[[nodiscard]] constexpr IntervalError error() const noexcept
+	{
+		assert (! valid);
+		return error_;
+	}
+
+private:
+	IntervalType result;
+
+	IntervalError error_ { IntervalError::InvalidKind };
+
+	bool valid { true };
+};
+
 /** A class that represents a musical interval between two pitches.
 
 	This class is meant for intervals that are an octave or smaller, and that can be expressed as a whole number of semitones.
@@ -75,28 +195,28 @@ namespace limes::harmony
 	Perfect octave, augmented seventh  | 12
 	Augmented octave                   | 13
 
+	Internally, an %interval is stored as its dense index (see getDenseIndex()), and all of its arithmetic is done with lookup tables that are built at compile time,
+	so every member function except the string functions can be used in constant expressions.
+	The class has no virtual functions and is a single byte, so arrays of intervals are cheap to store and process.
+	Use the explicit conversions in CompoundInterval and MicrotonalInterval to move between simple, compound and microtonal intervals.
+
 	Some convenient predefined interval objects can be found in the \c intervals namespace.
 
 	@ingroup lharmony_intervals
 	@see CompoundInterval, MicrotonalInterval, isValidQualityForKind()
 
-	@todo throw exception in constructor if necessary
 	@todo support for doubly augmented/diminished intervals?
-
-	@todo I feel like MicrotonalInterval should have the same base class. Perhaps the Interval
-	base class should have a smaller interface, and this class actually becomes DiatonicInterval
  */
-class LHARM_EXPORT Interval
+class LHARM_EXPORT Interval final
 {
 public:
-	/** Destructor. */
-	virtual ~Interval() = default;
+	~Interval() = default;
 
-	Interval (const Interval&) = default;
-	Interval& operator=(const Interval&) = default;
+	constexpr Interval (const Interval&) = default;
+	constexpr Interval& operator=(const Interval&) = default;
 
-	Interval (Interval&&) = default;
-	Interval& operator=(Interval&&) = default;
+	constexpr Interval (Interval&&) = default;
+	constexpr Interval& operator=(Interval&&) = default;
 
 	/** Describes the quality of the %interval.
 		Note that not all possible quality values are valid for every possible %interval type; a "major fifth" or a "perfect third" do not exist.
@@ -111,45 +231,59 @@ class LHARM_EXPORT Interval
 		Perfect		 ///< A perfect interval.
 	};
 
-	/** Returns a string description of the specified interval quality. */
+	/** Returns a string description of the specified interval quality, such as "Major", or "M" if \c useShort is true.
+		@see getQualityName()
+	 */
 	[[nodiscard]] static std::string qualityToString (Quality q, bool useShort = false);
 
+	/** Returns the name of the specified interval quality, such as "Major", or "M" if \c useShort is true.
+		The returned view refers to a static table, so this never allocates.
+	 */
+	[[nodiscard]] static constexpr std::string_view getQualityName (Quality q, bool useShort = false) noexcept;
+
 	/** @name Constructors */
 	///@{
 
 	/** Creates an %interval representing a perfect unison. */
-	Interval() noexcept;
+	constexpr Interval() noexcept = default;
 
 	/** Creates an %interval with a specified kind and quality.
-		If the kind or quality parameters are invalid, an assertion will be thrown.
+		If the kind or quality parameters are invalid, an exception will be thrown; in a constant expression, this is a compile-time error.
 		@param kindToUse The kind of %interval to create -- 0 for unison, 2 for second, 3 for third, etc. Note that 1 is not a valid value, and values greater than 8 will be reduced to their equivalent intervals that are within one octave (ie, using the modulus operator).
 		@param qualityToUse The quality of %interval to create. Note that not all possible quality values are valid for every possible %interval type; a "major fifth" or a "perfect third" do not exist.
-		@see isValidQualityForKind()
+		@see isValidQualityForKind(), tryMake()
 	 */
-	Interval (int kindToUse, Quality qualityToUse);
+	constexpr Interval (int kindToUse, Quality qualityToUse);
 
 	///@}
 
 	/** @name Creation functions */
 	///@{
 
+	/** Creates an %interval with a specified kind and quality, without throwing.
+		This accepts the same arguments as the constructor taking a kind and a quality, but reports invalid arguments through the returned object instead of throwing an exception,
+		so it is safe to call from a realtime thread.
+		@see isValidQualityForKind()
+	 */
+	[[nodiscard]] static constexpr IntervalResult<Interval> tryMake (int kindToUse, Quality qualityToUse) noexcept;
+
 	/** Creates an %interval from a number of semitones.
 		This uses reasonable defaults, always preferring major, minor, or perfect intervals when available instead of augmented or diminished.
 		@see fromPitches
 	 */
-	[[nodiscard]] static Interval fromNumSemitones (int semitones) noexcept;
+	[[nodiscard]] constexpr static Interval fromNumSemitones (int semitones) noexcept;
 
 	/** Creates an %interval from the distance between two pitch objects.
 		This uses reasonable defaults, always preferring major, minor, or perfect intervals when available instead of augmented or diminished.
 		@see fromNumSemitones
 	 */
-	[[nodiscard]] static Interval fromPitches (Pitch pitch1, Pitch pitch2) noexcept;
+	[[nodiscard]] constexpr static Interval fromPitches (Pitch pitch1, Pitch pitch2) noexcept;
 
 	/** Creates an %interval from the distance between two MIDI pitches.
 		This uses reasonable defaults, always preferring major, minor, or perfect intervals when available instead of augmented or diminished.
 		@see fromNumSemitones
 	 */
-	[[nodiscard]] static Interval fromPitches (int midiPitch1, int midiPitch2) noexcept;
+	[[nodiscard]] constexpr static Interval fromPitches (int midiPitch1, int midiPitch2) noexcept;
 
 	///@}
 
@@ -160,52 +294,92 @@ class LHARM_EXPORT Interval
 		Note that this will return false for intervals that represent the same number of semitones but are spelled differently.
 		@see isEnharmonicTo()
 	 */
-	[[nodiscard]] bool operator== (const Interval& other) const noexcept;
+	[[nodiscard]] constexpr bool operator== (const Interval& other) const noexcept
+	{
+		return denseIndex == other.denseIndex;
+	}
 
 	/** Returns true if the two intervals are not exactly equal.
 		Note that this will return true for intervals that represent the same number of semitones but are spelled differently.
 		@see isEnharmonicTo()
 	 */
-	[[nodiscard]] bool operator!= (const Interval& other) const noexcept;
+	[[nodiscard]] constexpr bool operator!= (const Interval& other) const noexcept
+	{
+		return ! (*this == other);
+	}
 
 	/** Returns true if the two intervals represent the same number of semitones, regardless of their enharmonic spelling.
 		For example, a diminished fifth is enharmonic to an augmented fourth.
 	 */
-	[[nodiscard]] bool isEnharmonicTo (const Interval& other) const noexcept;
+	[[nodiscard]] constexpr bool isEnharmonicTo (const Interval& other) const noexcept;
+
+	///@}
+
+	/** @name Enharmonic spellings */
+	///@{
+
+	/** The number of distinct enharmonic classes. Enharmonic class ids run from 0 to 13. */
+	static constexpr std::size_t numEnharmonicClasses = semitonesInOctave + 2;
+
+	/** Returns an id between 0 and 13 that is shared by exactly the intervals that are enharmonic to this one, which can be used as an index into an array of size numEnharmonicClasses.
+		The id is the number of semitones the %interval spans, so a diminished fifth and an augmented fourth both have the id 6.
+		@see isEnharmonicTo(), getSpellings()
+	 */
+	[[nodiscard]] constexpr std::size_t getEnharmonicClass() const noexcept;
+
+	/** Returns every valid spelling of the given number of semitones, ordered by kind.
+		For example, 6 semitones may be spelled as an augmented fourth or a diminished fifth, while 13 semitones can only be an augmented octave.
+		Unlike fromNumSemitones(), which picks a single default spelling, this lets spelling algorithms enumerate every candidate without constructing and validating intervals.
+		The returned span refers to a static table, so this never allocates.
+		@param semitones The number of semitones, which should be between 0 and 13. Other values return an empty span.
+		@see getEnharmonicSpellings(), fromNumSemitones()
+	 */
+	[[nodiscard]] static constexpr std::span<const Interval> getSpellings (int semitones) noexcept;
+
+	/** Returns every %interval that is enharmonic to this one, including this %interval itself, ordered by kind.
+		@see getSpellings()
+	 */
+	[[nodiscard]] constexpr std::span<const Interval> getEnharmonicSpellings() const noexcept;
 
 	///@}
 
 	/** Returns true if this %interval is semantically larger than the other one, taking enharmonic spellings into account.
 		For example, this will tell you that a diminished fifth is "larger" than an augmented fourth.
 	 */
-	[[nodiscard]] bool operator> (const Interval& other) const noexcept;
+	[[nodiscard]] constexpr bool operator> (const Interval& other) const noexcept;
 
 	/** Returns true if this %interval is semantically smaller than the other one, taking enharmonic spellings into account.
 		For example, this will tell you that an augmented fourth is "smaller" than a diminished fifth.
 	 */
-	[[nodiscard]] bool operator<(const Interval& other) const noexcept;
+	[[nodiscard]] constexpr bool operator<(const Interval& other) const noexcept;
+
+	/** Returns true if this %interval is semantically larger than or equal to the other one. */
+	[[nodiscard]] constexpr bool operator>= (const Interval& other) const noexcept;
+
+	/** Returns true if this %interval is semantically smaller than or equal to the other one. */
+	[[nodiscard]] constexpr bool operator<= (const Interval& other) const noexcept;
 
 	/** @name Addition */
 	///@{
 
 	/** Adds another %interval object to this one. */
-	[[nodiscard]] Interval operator+ (const Interval& other) const noexcept;
+	[[nodiscard]] constexpr Interval operator+ (const Interval& other) const noexcept;
 
 	/** Adds a number of semitones to this %interval. */
-	[[nodiscard]] Interval operator+ (int semitonesToAdd) const noexcept;
+	[[nodiscard]] constexpr Interval operator+ (int semitonesToAdd) const noexcept;
 
 	/** Adds another %interval object to this one. */
-	Interval& operator+= (const Interval& other) noexcept;
+	constexpr Interval& operator+= (const Interval& other) noexcept;
 
 	/** Adds a number of semitones to this %interval. */
-	Interval& operator+= (int semitonesToAdd) noexcept;
+	constexpr Interval& operator+= (int semitonesToAdd) noexcept;
 
 	/** Increments this %interval by one semitone, preserving the kind by manipulating the quality where possible.
 		For example, a major second will increment to an augmented second, rather than a minor third.
 		A perfect octave will increment to an augmented octave.
 		Calling the increment operator on an augmented octave will do nothing.
 	 */
-	Interval& operator++() noexcept;
+	constexpr Interval& operator++() noexcept;
 
 	///@}
 
@@ -213,59 +387,66 @@ class LHARM_EXPORT Interval
 	///@{
 
 	/** Subtracts another %interval object from this one. */
-	[[nodiscard]] Interval operator- (const Interval& other) const noexcept;
+	[[nodiscard]] constexpr Interval operator- (const Interval& other) const noexcept;
 
 	/** Subtracts a number of semitones from this %interval. */
-	[[nodiscard]] Interval operator- (int semitonesToSubtract) const noexcept;
+	[[nodiscard]] constexpr Interval operator- (int semitonesToSubtract) const noexcept;
 
 	/** Subtracts another %interval object from this one. */
-	Interval& operator-= (const Interval& other) noexcept;
+	constexpr Interval& operator-= (const Interval& other) noexcept;
 
 	/** Subtracts a number of semitones from this %interval. */
-	Interval& operator-= (int semitonesToSubtract) noexcept;
+	constexpr Interval& operator-= (int semitonesToSubtract) noexcept;
 
 	/** Decrements this %interval by one semitone, preserving the kind by manipulating the quality where possible.
 		For example, a minor second will decrement to a diminished second, rather than a perfect unison.
 		In the special case of a diminished second, it will decrement to a perfect unison (even though these two intervals are enharmonically equivalent).
 		Calling the decrement operator on a perfect unison will do nothing.
 	 */
-	Interval& operator--() noexcept;
+	constexpr Interval& operator--() noexcept;
 
 	///@}
 
 	/** Returns the %interval that is the inverse of this one, taking enharmonic spellings into account.
 		An %interval and its inverse add together to form a perfect octave -- for example, a major second's inverse is a minor seventh, a perfect fourth's inverse is a perfect fifth, etc.
 	 */
-	[[nodiscard]] Interval getInverse() const noexcept;
+	[[nodiscard]] constexpr Interval getInverse() const noexcept;
 
 	/** Returns the number of semitones that this %interval represents.
 		@see getKind()
 	 */
-	[[nodiscard]] virtual int getNumSemitones() const noexcept;
+	[[nodiscard]] constexpr int getNumSemitones() const noexcept;
 
 	/** Returns the kind of this %interval as an integer.
 		0 represents unison, 2 is a second, 3 is a third, etc.
 		Note that this will never return 1.
 		@see getNumSemitones()
 	 */
-	[[nodiscard]] virtual int getKind() const noexcept;
+	[[nodiscard]] constexpr int getKind() const noexcept;
 
 	/** Returns the quality of this %interval. */
-	[[nodiscard]] virtual Quality getQuality() const noexcept;
+	[[nodiscard]] constexpr Quality getQuality() const noexcept;
 
 	/** @name Cents measurements */
 	///@{
 
-	/** Returns an array of possible cents values this %interval can represent in just intonation, taking enharmonic spelling into account.
+	/** Returns the possible cents values this %interval can represent in just intonation, taking enharmonic spelling into account, from smallest to largest.
+		The values are the exact sizes of the ratios returned by getJustRatios(), in the same order. They are stored in a static table, so this never allocates.
 		@see getJustRatios, getCents_EqualTemperament
 	 */
-	[[nodiscard]] virtual std::vector<double> getCents_JustIntonation() const;
+	[[nodiscard]] constexpr std::span<const double> getCents_JustIntonation() const noexcept;
+
+	/** Returns the exact frequency ratios this %interval can represent in just intonation, from smallest to largest.
+		For example, a major third may be 5/4, 81/64 or 9/7.
+		@see getCents_JustIntonation
+	 */
+	[[nodiscard]] constexpr std::span<const JustRatio> getJustRatios() const noexcept;
 
 	/** Returns the number of cents this %interval represents in equal temperament.
 		Note that, unlike just intonation, enharmonic spellings represent equal numbers of cents in equal temperament.
 		@see getCents_JustIntonation
 	 */
-	[[nodiscard]] int getCents_EqualTemperament() const noexcept;
+	[[nodiscard]] constexpr int getCents_EqualTemperament() const noexcept;
 
 	///@}
 
@@ -273,13 +454,19 @@ class LHARM_EXPORT Interval
 		@param other The pitch object to start from.
 		@param above When true, the returned pitch will be this interval's distance above the passed pitch. When false, the returned pitch will be this interval's distance below the passed pitch.
 	 */
-	[[nodiscard]] Pitch applyToPitch (Pitch other, bool above) const noexcept;
+	[[nodiscard]] constexpr Pitch applyToPitch (Pitch other, bool above) const noexcept;
 
-	/** Returns a string description of this interval, such as "major second". If the \c useShort
+	/** Returns a string description of this interval, such as "Major second". If the \c useShort
 		parameter is true, then an abbreviated string will be returned, such as "M2".
+		@see getName()
 	 */
 	[[nodiscard]] std::string getStringDescription (bool useShort = false) const;
 
+	/** Returns the same name as getStringDescription(), such as "Major second" or "M2", without allocating.
+		The returned view refers to a static table.
+	 */
+	[[nodiscard]] constexpr std::string_view getName (bool useShort = false) const noexcept;
+
 	/** Returns true if the quality is valid for the given kind of %interval.
 		For example, a perfect fourth or fifth is valid, while a perfect third or perfect second is not. A major or minor third is valid, while a major fourth or minor fifth is not.
 		Note the special case that a diminished unison is invalid; unisons can only be perfect or augmented.
@@ -300,52 +487,53 @@ class LHARM_EXPORT Interval
 	 */
 	[[nodiscard]] static constexpr bool isValidQualityForKind (Quality quality, int kind) noexcept;
 
-private:
-	[[nodiscard]] bool intervalIsPerfectKind() const noexcept;
-
-	Quality quality { Quality::Major };
-
-	int kind { 0 };
-};
+	/** @name Packed encodings */
+	///@{
 
-constexpr bool Interval::isValidQualityForKind (Quality quality, int kind) noexcept
-{
-	if (kind == 1)
-		return false;
+	/** The number of valid kind/quality combinations. Dense indices run from 0 to 26. */
+	static constexpr std::size_t numDenseIndices = 27;
 
-	const auto baseKind = [k = kind]  // NOLINT
-	{
-		const auto base = k % 8;
+	/** Returns this %interval's kind and quality packed into a single byte, as <tt>(kind << 3) | quality</tt>.
+		@see fromPackedValue()
+	 */
+	[[nodiscard]] constexpr std::uint8_t getPackedValue() const noexcept;
 
-		if (k > 8)
-			return base + (k / 8);
+	/** Recreates an %interval from a value returned by getPackedValue().
+		An exception is thrown if the value does not encode a valid kind and quality.
+	 */
+	[[nodiscard]] static constexpr Interval fromPackedValue (std::uint8_t packedValue);
 
-		return base;
-	}();
+	/** Returns a unique index between 0 and 26 for this %interval, which can be used as a perfect hash into an array of size numDenseIndices.
+		Intervals are numbered by kind, and then from smallest to largest quality, so a perfect unison is 0, an augmented unison is 1, and an augmented octave is 26.
+		@see fromDenseIndex()
+	 */
+	[[nodiscard]] constexpr std::size_t getDenseIndex() const noexcept;
 
-	if (baseKind == 0 || baseKind == 4 || baseKind == 5)
-	{
-		const auto base = quality != Quality::Major && quality != Quality::Minor;
+	/** Returns the dense index of the %interval with the given kind and quality.
+		The combination must be valid; see isValidQualityForKind().
+	 */
+	[[nodiscard]] static constexpr std::size_t getDenseIndex (int kind, Quality quality) noexcept;
 
-		if (kind == 0)
-			return base && quality != Quality::Diminished;
+	/** Returns the %interval with the given dense index, which must be less than numDenseIndices. */
+	[[nodiscard]] static constexpr Interval fromDenseIndex (std::size_t index) noexcept;
 
-		return base;
-	}
+	///@}
 
-	return quality != Quality::Perfect;
-}
+private:
+	[[noreturn]] static void throwInvalidKindOrQuality (int kind, Quality quality);
 
+	std::uint8_t denseIndex { 0 };
+};
 
 /** Adds an interval to the given pitch and returns a new pitch object at the resulting pitch.
 	@ingroup music_intervals
  */
-LHARM_EXPORT Pitch operator+ (const Pitch& pitch, const Interval& interval) noexcept;
+constexpr Pitch operator+ (const Pitch& pitch, const Interval& interval) noexcept;
 
 /** Subtracts an interval from the given pitch and returns a new pitch object at the resulting pitch.
 	@ingroup music_intervals
  */
-LHARM_EXPORT Pitch operator- (const Pitch& pitch, const Interval& interval) noexcept;
+constexpr Pitch operator- (const Pitch& pitch, const Interval& interval) noexcept;
 
 /** Writes a string description of the Interval to the output stream.
 
@@ -356,3 +544,22 @@ LHARM_EXPORT Pitch operator- (const Pitch& pitch, const Interval& interval) noex
 LHARM_EXPORT std::ostream& operator<< (std::ostream& os, const Interval& value);
 
 }  // namespace limes::harmony
+
+#include "./lharmony_Interval_impl.h"  // IWYU pragma: export
+
+namespace std
+{
+
+/** A specialization of \c std::hash for Interval objects.
+	@ingroup lharmony_intervals
+ */
+template <>
+struct hash<limes::harmony::Interval> final
+{
+	[[nodiscard]] size_t operator() (const limes::harmony::Interval& interval) const noexcept
+	{
+		return interval.getDenseIndex();
+	}
+};
+
+}  // namespace std
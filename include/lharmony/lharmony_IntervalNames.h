@@ -0,0 +1,166 @@
+/*
+ * ======================================================================================
+ *  __    ____  __  __  ____  ___
+ * (  )  (_  _)(  \/  )( ___)/ __)
+ *  )(__  _)(_  )    (  )__) \__ \
+ * (____)(____)(_/\/\_)(____)(___/
+ *
+ *  This file is part of the Limes open source library and is licensed under the terms of the GNU Public License.
+ *
+ *  Commercial licenses are available; contact the maintainers at ben.the.vining@gmail.com to inquire for details.
+ *
+ * ======================================================================================
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <cstddef>
+#include <version>
+#include "lharmony/lharmony_Export.h"
+#include "lharmony/lharmony_Interval.h"
+#include "lharmony/lharmony_CompoundInterval.h"
+
+#ifdef __cpp_lib_format
+#	include <format>
+#endif
+
+/** @file
+	This file defines functions for converting intervals to and from their names, such as "M3", "Perfect fifth" or "Minor 10th".
+
+	These functions follow the conventions of \c std::from_chars() and \c std::to_chars() : they work on caller-provided character ranges,
+	never allocate, never throw, and report errors through the \c ec member of their result.
+
+	@ingroup lharmony_intervals
+ */
+
+namespace limes::harmony
+{
+
+/** An upper bound on the length of the names that toChars() writes for an Interval or CompoundInterval, such as "Diminished -229375th".
+	A buffer of this many characters is always large enough.
+	@ingroup lharmony_intervals
+ */
+inline constexpr std::size_t maxIntervalNameLength = 20;
+
+/** @name Parsing
+	Each of these functions parses the longest %interval name at the start of the range <code>[first, last)</code> .
+	A name is a quality followed by a kind. The quality is either a single letter, which is case-sensitive (\c d , \c m , \c M , \c A or \c P ),
+	or a word, which is not (\c perfect , \c major , \c minor , \c augmented or \c diminished , or the abbreviations \c perf , \c maj , \c min , \c aug or \c dim ).
+	A quality word may be followed by a single space. The kind is either a number, optionally followed by its ordinal suffix, such as "10" or "10th",
+	or a word (\c unison , \c second , \c third , \c fourth , \c fifth , \c sixth , \c seventh or \c octave ). A unison may be numbered 0 or 1.
+	This accepts every name that \c getStringDescription() and toChars() write, as well as names such as "aug 4", "maj3" and "P1".
+	Leading whitespace is not skipped.
+
+	On success, the returned \c ptr points to the first character that is not part of the name, and \c ec is value-initialized.
+	If no name could be parsed, or the name's quality does not exist for its kind (such as "M5"), \c ptr is \c first , \c ec is \c std::errc::invalid_argument ,
+	and the output value is not modified. If the kind is too large to be represented, \c ptr points past the name and \c ec is \c std::errc::result_out_of_range .
+ */
+///@{
+
+/** Parses a simple %interval name, such as "M3", "aug 4" or "Perfect fifth". Kinds larger than an octave are out of range.
+	@ingroup lharmony_intervals
+ */
+LHARM_EXPORT std::from_chars_result fromChars (const char* first, const char* last, Interval& value) noexcept;
+
+/** Parses a simple or compound %interval name, such as "M3", "m10" or "Perfect 12th".
+	@ingroup lharmony_intervals
+ */
+LHARM_EXPORT std::from_chars_result fromChars (const char* first, const char* last, CompoundInterval& value) noexcept;
+
+///@}
+
+/** @name Formatting
+	Each of these functions writes a name into the range <code>[first, last)</code> , without a null terminator.
+	The names are the same as the ones returned by \c getStringDescription() .
+
+	On success, the returned \c ptr points one past the last character written, and \c ec is value-initialized.
+	If the range is too small, \c ptr is \c last , \c ec is \c std::errc::value_too_large , and the contents of the range are unspecified.
+ */
+///@{
+
+/** Writes an %interval's name, such as "Major third", or "M3" if \c useShort is true.
+	@ingroup lharmony_intervals
+	@see Interval::getName()
+ */
+LHARM_EXPORT std::to_chars_result toChars (char* first, char* last, const Interval& value, bool useShort = false) noexcept;
+
+/** Writes a compound %interval's name, such as "Major 10th", or "M10" if \c useShort is true.
+	Intervals up to an octave are named by their total kind, the same as Interval, so an octave is always a "Perfect octave" however it was built.
+	@ingroup lharmony_intervals
+	@see CompoundInterval::getStringDescription()
+ */
+LHARM_EXPORT std::to_chars_result toChars (char* first, char* last, const CompoundInterval& value, bool useShort = false) noexcept;
+
+///@}
+
+}  // namespace limes::harmony
+
+#ifdef __cpp_lib_format
+
+namespace limes::harmony::detail
+{
+
+/** Implements \c std::formatter for Interval and CompoundInterval.
+	The format specification may be empty or \c l for the long name (the default), or \c s for the short name.
+ */
+template <typename T>
+struct IntervalNameFormatter
+{
+	constexpr auto parse (std::format_parse_context& ctx)
+	{
+		auto it = ctx.begin();
+
+		if (it != ctx.end() && (*it == 's' || *it == 'l'))
+		{
+			useShort = *it == 's';
+			++it;
+		}
+
+		if (it != ctx.end() && *it != '}')
+			throw std::format_error ("Invalid format specification for an interval name");
+
+		return it;
+	}
+
+	template <typename FormatContext>
+	auto format (const T& value, FormatContext& ctx) const
+	{
+		std::array<char, maxIntervalNameLength> buffer;
+
+		const auto result = toChars (buffer.data(), buffer.data() + buffer.size(), value, useShort);
+
+		return std::copy (buffer.data(), result.ptr, ctx.out());
+	}
+
+	bool useShort { false };
+};
+
+}  // namespace limes::harmony::detail
+
+namespace std
+{
+
+/** A specialization of \c std::formatter for Interval objects, which writes the same names as toChars().
+	Use <code>{:s}</code> for the short name, such as "M3".
+	@ingroup lharmony_intervals
+ */
+template <>
+struct formatter<limes::harmony::Interval, char> final : limes::harmony::detail::IntervalNameFormatter<limes::harmony::Interval>
+{
+};
+
+/** A specialization of \c std::formatter for CompoundInterval objects, which writes the same names as toChars().
+	Use <code>{:s}</code> for the short name, such as "M10".
+	@ingroup lharmony_intervals
+ */
+template <>
+struct formatter<limes::harmony::CompoundInterval, char> final : limes::harmony::detail::IntervalNameFormatter<limes::harmony::CompoundInterval>
+{
+};
+
+}  // namespace std
+
+#endif
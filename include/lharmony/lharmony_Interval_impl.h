@@ -27,6 +27,682 @@
 namespace limes::harmony
 {
 
+constexpr bool Interval::isValidQualityForKind (Quality quality, int kind) noexcept
+{
+	if (kind == 1)
+		return false;
+
+	const auto baseKind = [k = kind]  // NOLINT
+	{
+		const auto base = k % 8;
+
+		if (k > 8)
+			return base + (k / 8);
+
+		return base;
+	}();
+
+	if (baseKind == 0 || baseKind == 4 || baseKind == 5)
+	{
+		const auto base = quality != Quality::Major && quality != Quality::Minor;
+
+		if (kind == 0)
+			return base && quality != Quality::Diminished;
+
+		return base;
+	}
+
+	return quality != Quality::Perfect;
+}
+
+namespace detail
+{
+
+struct IntervalSpelling final
+{
+	int kind { 0 };
+
+	Interval::Quality quality { Interval::Quality::Perfect };
+};
+
+// every valid kind and quality, ordered by kind and then from smallest to largest quality
+inline constexpr auto intervalsByDenseIndex = []
+{
+	using Q = Interval::Quality;
+
+	constexpr std::array<Q, 5> qualitiesBySize { Q::Diminished, Q::Minor, Q::Perfect, Q::Major, Q::Augmented };
+
+	std::array<IntervalSpelling, Interval::numDenseIndices> spellings {};
+
+	std::size_t index = 0;
+
+	for (auto kind = 0; kind <= 8; ++kind)
+		for (const auto quality : qualitiesBySize)
+			if (Interval::isValidQualityForKind (quality, kind))
+				spellings[index++] = IntervalSpelling { kind, quality };
+
+	return spellings;
+}();
+
+// the short and long names of each quality, indexed by Interval::Quality
+inline constexpr std::array<std::string_view, 5> intervalQualityShortNames { "d", "m", "M", "A", "P" };
+
+inline constexpr std::array<std::string_view, 5> intervalQualityLongNames { "Diminished", "Minor", "Major", "Augmented", "Perfect" };
+
+// the short and long names of each interval, in the same order as the table above
+inline constexpr std::array<std::string_view, Interval::numDenseIndices> intervalShortNamesByDenseIndex {
+	"P0", "A0",				 // unison
+	"d2", "m2", "M2", "A2",	 // second
+	"d3", "m3", "M3", "A3",	 // third
+	"d4", "P4", "A4",		 // fourth
+	"d5", "P5", "A5",		 // fifth
+	"d6", "m6", "M6", "A6",	 // sixth
+	"d7", "m7", "M7", "A7",	 // seventh
+	"d8", "P8", "A8"		 // octave
+};
+
+inline constexpr std::array<std::string_view, Interval::numDenseIndices> intervalLongNamesByDenseIndex {
+	"Perfect unison", "Augmented unison",
+	"Diminished second", "Minor second", "Major second", "Augmented second",
+	"Diminished third", "Minor third", "Major third", "Augmented third",
+	"Diminished fourth", "Perfect fourth", "Augmented fourth",
+	"Diminished fifth", "Perfect fifth", "Augmented fifth",
+	"Diminished sixth", "Minor sixth", "Major sixth", "Augmented sixth",
+	"Diminished seventh", "Minor seventh", "Major seventh", "Augmented seventh",
+	"Diminished octave", "Perfect octave", "Augmented octave"
+};
+
+// check that the names above are in the same order as the spellings
+static_assert (
+	[]
+	{
+		for (auto index = 0UL; index < intervalsByDenseIndex.size(); ++index)
+		{
+			const auto [kind, quality] = intervalsByDenseIndex[index];
+
+			const auto shortName   = intervalShortNamesByDenseIndex[index];
+			const auto longName	   = intervalLongNamesByDenseIndex[index];
+			const auto qualityName = intervalQualityLongNames[static_cast<std::size_t> (quality)];
+
+			if (shortName[0] != intervalQualityShortNames[static_cast<std::size_t> (quality)][0] || shortName[1] != '0' + kind
+				|| ! longName.starts_with (qualityName) || longName[qualityName.size()] != ' ')
+				return false;
+		}
+
+		return true;
+	}(),
+	"The interval name tables do not match the spelling table");
+
+// the inverse of the table above, indexed by packed value
+inline constexpr auto intervalDenseIndicesByPackedValue = []
+{
+	std::array<std::uint8_t, 9 * 8> indices {};
+
+	for (auto index = 0UL; index < intervalsByDenseIndex.size(); ++index)
+	{
+		const auto [kind, quality] = intervalsByDenseIndex[index];
+
+		indices[static_cast<std::size_t> ((kind << 3) | static_cast<int> (quality))] = static_cast<std::uint8_t> (index);
+	}
+
+	return indices;
+}();
+
+// the number of semitones spanned by each interval, indexed by dense index
+inline constexpr auto intervalSemitonesByDenseIndex = []
+{
+	using Q = Interval::Quality;
+
+	// the size of the perfect or major interval of each kind
+	constexpr std::array<int, 9> baseSemitones { 0, 0, 2, 4, 5, 7, 9, 11, 12 };
+
+	std::array<std::uint8_t, Interval::numDenseIndices> semitones {};
+
+	for (auto index = 0UL; index < intervalsByDenseIndex.size(); ++index)
+	{
+		const auto [kind, quality] = intervalsByDenseIndex[index];
+
+		const auto isPerfectKind = kind == 0 || kind == 4 || kind == 5 || kind == 8;
+
+		auto numSemitones = baseSemitones[static_cast<std::size_t> (kind)];
+
+		if (quality == Q::Augmented)
+			++numSemitones;
+		else if (quality == Q::Minor)
+			--numSemitones;
+		else if (quality == Q::Diminished)
+			numSemitones -= isPerfectKind ? 1 : 2;
+
+		semitones[index] = static_cast<std::uint8_t> (numSemitones);
+	}
+
+	return semitones;
+}();
+
+// the dense index of the interval with the given kind and number of semitones, or numDenseIndices if there isn't one
+[[nodiscard]] constexpr std::size_t findIntervalDenseIndex (int kind, int semitones) noexcept
+{
+	for (auto index = 0UL; index < intervalsByDenseIndex.size(); ++index)
+		if (intervalsByDenseIndex[index].kind == kind && static_cast<int> (intervalSemitonesByDenseIndex[index]) == semitones)
+			return index;
+
+	return Interval::numDenseIndices;
+}
+
+// the interval spanning each number of diatonic steps from 0 (a unison) to 7 (an octave) and each number of semitones from 0 to 13,
+// or numDenseIndices if there is no such interval
+inline constexpr auto intervalDenseIndicesByStepsAndSemitones = []
+{
+	std::array<std::array<std::uint8_t, semitonesInOctave + 2>, 8> indices {};
+
+	for (auto steps = 0; steps < 8; ++steps)
+		for (auto semitones = 0; semitones < semitonesInOctave + 2; ++semitones)
+			indices[static_cast<std::size_t> (steps)][static_cast<std::size_t> (semitones)] = static_cast<std::uint8_t> (findIntervalDenseIndex (steps == 0 ? 0 : steps + 1, semitones));
+
+	return indices;
+}();
+
+// the default spelling of each number of semitones from 0 to 13, preferring perfect, major and minor intervals
+inline constexpr auto intervalDenseIndicesBySemitones = []
+{
+	using Q = Interval::Quality;
+
+	std::array<std::uint8_t, semitonesInOctave + 2> indices {};
+
+	for (auto semitones = 0; semitones < static_cast<int> (indices.size()); ++semitones)
+	{
+		auto best = Interval::numDenseIndices;
+
+		for (auto index = 0UL; index < intervalsByDenseIndex.size(); ++index)
+		{
+			if (static_cast<int> (intervalSemitonesByDenseIndex[index]) != semitones)
+				continue;
+
+			const auto quality = intervalsByDenseIndex[index].quality;
+
+			if (best == Interval::numDenseIndices || (quality != Q::Augmented && quality != Q::Diminished))
+				best = index;
+
+			if (quality != Q::Augmented && quality != Q::Diminished)
+				break;
+		}
+
+		indices[static_cast<std::size_t> (semitones)] = static_cast<std::uint8_t> (best);
+	}
+
+	return indices;
+}();
+
+// the dense index of the default spelling of a number of semitones; see Interval::fromNumSemitones()
+[[nodiscard]] constexpr std::size_t intervalDenseIndexForSemitones (int semitones) noexcept
+{
+	if (semitones < 0)
+		semitones = -semitones;
+
+	if (semitones != semitonesInOctave + 1)
+		semitones %= semitonesInOctave + 1;
+
+	return intervalDenseIndicesBySemitones[static_cast<std::size_t> (semitones)];
+}
+
+// each interval incremented by a semitone, keeping its kind where possible
+inline constexpr auto intervalIncrementsByDenseIndex = []
+{
+	std::array<std::uint8_t, Interval::numDenseIndices> increments {};
+
+	for (auto index = 0UL; index < intervalsByDenseIndex.size(); ++index)
+	{
+		const auto kind		 = intervalsByDenseIndex[index].kind;
+		const auto semitones = static_cast<int> (intervalSemitonesByDenseIndex[index]) + 1;
+
+		auto next = findIntervalDenseIndex (kind, semitones);
+
+		if (next == Interval::numDenseIndices)
+			next = findIntervalDenseIndex (kind == 0 ? 2 : kind + 1, semitones);
+
+		// an augmented octave can't be incremented
+		if (next == Interval::numDenseIndices)
+			next = index;
+
+		increments[index] = static_cast<std::uint8_t> (next);
+	}
+
+	return increments;
+}();
+
+// each interval decremented by a semitone, keeping its kind where possible
+inline constexpr auto intervalDecrementsByDenseIndex = []
+{
+	std::array<std::uint8_t, Interval::numDenseIndices> decrements {};
+
+	for (auto index = 0UL; index < intervalsByDenseIndex.size(); ++index)
+	{
+		const auto kind		 = intervalsByDenseIndex[index].kind;
+		const auto semitones = static_cast<int> (intervalSemitonesByDenseIndex[index]) - 1;
+
+		auto next = findIntervalDenseIndex (kind, semitones);
+
+		if (next == Interval::numDenseIndices)
+			next = findIntervalDenseIndex (kind == 2 ? 0 : kind - 1, semitones);
+
+		// a perfect unison can't be decremented, and a diminished second decrements to a perfect unison
+		if (next == Interval::numDenseIndices)
+			next = 0;
+
+		decrements[index] = static_cast<std::uint8_t> (next);
+	}
+
+	return decrements;
+}();
+
+// the inverse of each interval, which spans the rest of the octave with the complementary kind
+inline constexpr auto intervalInversesByDenseIndex = []
+{
+	std::array<std::uint8_t, Interval::numDenseIndices> inverses {};
+
+	for (auto index = 0UL; index < intervalsByDenseIndex.size(); ++index)
+	{
+		const auto kind = intervalsByDenseIndex[index].kind;
+
+		const auto inverseKind = [kind]
+		{
+			if (kind == 0)
+				return 8;
+
+			if (kind == 8)
+				return 0;
+
+			return 9 - kind;
+		}();
+
+		auto inverse = findIntervalDenseIndex (inverseKind, semitonesInOctave - static_cast<int> (intervalSemitonesByDenseIndex[index]));
+
+		// the inverse of an augmented octave is an augmented unison
+		if (inverse == Interval::numDenseIndices)
+			inverse = 1;
+
+		inverses[index] = static_cast<std::uint8_t> (inverse);
+	}
+
+	return inverses;
+}();
+
+using IntervalPairTable = std::array<std::array<std::uint8_t, Interval::numDenseIndices>, Interval::numDenseIndices>;
+
+// the sum and difference of every pair of intervals, spelled as by Interval::fromNumSemitones()
+inline constexpr auto intervalSumsByDenseIndex = []
+{
+	IntervalPairTable sums {};
+
+	for (auto first = 0UL; first < Interval::numDenseIndices; ++first)
+		for (auto second = 0UL; second < Interval::numDenseIndices; ++second)
+			sums[first][second] = static_cast<std::uint8_t> (intervalDenseIndexForSemitones (intervalSemitonesByDenseIndex[first] + intervalSemitonesByDenseIndex[second]));
+
+	return sums;
+}();
+
+inline constexpr auto intervalDifferencesByDenseIndex = []
+{
+	IntervalPairTable differences {};
+
+	for (auto first = 0UL; first < Interval::numDenseIndices; ++first)
+		for (auto second = 0UL; second < Interval::numDenseIndices; ++second)
+			differences[first][second] = static_cast<std::uint8_t> (intervalDenseIndexForSemitones (intervalSemitonesByDenseIndex[first] - intervalSemitonesByDenseIndex[second]));
+
+	return differences;
+}();
+
+// the just intonation ratios of each interval, ordered by dense index and then from smallest to largest
+inline constexpr std::array<JustRatio, 73> justRatios { {
+	{ 1, 1 }, // perfect unison
+	{ 25, 24 }, { 2187, 2048 }, // augmented unison
+	{ 128, 125 }, // diminished second
+	{ 256, 243 }, { 16, 15 }, // minor second
+	{ 10, 9 }, { 9, 8 }, // major second
+	{ 125, 108 }, { 75, 64 }, { 19, 16 }, { 19683, 16384 }, // augmented second
+	{ 65536, 59049 }, { 256, 225 }, { 144, 125 }, // diminished third
+	{ 32, 27 }, { 19, 16 }, { 6, 5 }, // minor third
+	{ 5, 4 }, { 81, 64 }, { 9, 7 }, // major third
+	{ 125, 96 }, // augmented third
+	{ 8192, 6561 }, { 32, 25 }, // diminished fourth
+	{ 4, 3 }, // perfect fourth
+	{ 18, 13 }, { 25, 18 }, { 7, 5 }, { 1024, 729 }, { 45, 32 }, { 64, 45 }, { 729, 512 }, { 10, 7 }, { 36, 25 }, { 13, 9 }, // augmented fourth
+	{ 18, 13 }, { 25, 18 }, { 7, 5 }, { 1024, 729 }, { 45, 32 }, { 64, 45 }, { 729, 512 }, { 10, 7 }, { 36, 25 }, { 13, 9 }, // diminished fifth
+	{ 3, 2 }, // perfect fifth
+	{ 25, 16 }, { 6561, 4096 }, // augmented fifth
+	{ 192, 125 }, // diminished sixth
+	{ 11, 7 }, { 128, 81 }, { 8, 5 }, // minor sixth
+	{ 5, 3 }, { 27, 16 }, { 12, 7 }, // major sixth
+	{ 125, 72 }, { 7, 4 }, { 225, 128 }, { 59049, 32768 }, // augmented sixth
+	{ 32768, 19683 }, { 128, 75 }, { 216, 125 }, // diminished seventh
+	{ 16, 9 }, { 9, 5 }, // minor seventh
+	{ 50, 27 }, { 15, 8 }, // major seventh
+	{ 125, 64 }, { 2025, 1024 }, // augmented seventh
+	{ 4096, 2187 }, { 256, 135 }, { 48, 25 }, // diminished octave
+	{ 2, 1 }, // perfect octave
+	{ 25, 12 } // augmented octave
+} };
+
+// the number of ratios in the table above for each interval, by dense index
+inline constexpr std::array<std::uint8_t, Interval::numDenseIndices> numJustRatiosByDenseIndex { 1, 2, 1, 2, 2, 4, 3, 3, 3, 1, 2, 1, 10, 10, 1, 2, 1, 3, 3, 4, 3, 2, 2, 2, 3, 1, 1 };
+
+// the index of each interval's first ratio in the table above, by dense index, with the total at the end
+inline constexpr auto justRatioOffsetsByDenseIndex = []
+{
+	std::array<std::uint8_t, Interval::numDenseIndices + 1> offsets {};
+
+	for (auto index = 0UL; index < Interval::numDenseIndices; ++index)
+		offsets[index + 1] = static_cast<std::uint8_t> (offsets[index] + numJustRatiosByDenseIndex[index]);
+
+	return offsets;
+}();
+
+static_assert (justRatioOffsetsByDenseIndex.back() == justRatios.size());
+
+// the exact size in cents of each ratio in the table above
+inline constexpr auto justRatioCents = []
+{
+	std::array<double, justRatios.size()> cents {};
+
+	for (auto index = 0UL; index < justRatios.size(); ++index)
+		cents[index] = justRatios[index].getCents();
+
+	return cents;
+}();
+
+}  // namespace detail
+
+constexpr Interval::Interval (int kindToUse, Quality qualityToUse)
+{
+	const auto result = tryMake (kindToUse, qualityToUse);
+
+	if (! result)
+		throwInvalidKindOrQuality (kindToUse % 9, qualityToUse);
+
+	denseIndex = result->denseIndex;
+}
+
+constexpr IntervalResult<Interval> Interval::tryMake (int kindToUse, Quality qualityToUse) noexcept
+{
+	const auto kind = kindToUse % 9;
+
+	if (kind < 0 || kind == 1)
+		return IntervalError::InvalidKind;
+
+	if (qualityToUse < Quality::Diminished || qualityToUse > Quality::Perfect)
+		return IntervalError::InvalidQuality;
+
+	if (! isValidQualityForKind (qualityToUse, kind))
+		return IntervalError::InvalidQualityForKind;
+
+	return fromDenseIndex (getDenseIndex (kind, qualityToUse));
+}
+
+constexpr std::string_view Interval::getQualityName (Quality q, bool useShort) noexcept
+{
+	assert (q >= Quality::Diminished && q <= Quality::Perfect);
+
+	const auto index = static_cast<std::size_t> (q);
+
+	return useShort ? detail::intervalQualityShortNames[index] : detail::intervalQualityLongNames[index];
+}
+
+constexpr std::string_view Interval::getName (bool useShort) const noexcept
+{
+	return useShort ? detail::intervalShortNamesByDenseIndex[denseIndex] : detail::intervalLongNamesByDenseIndex[denseIndex];
+}
+
+constexpr Interval Interval::fromDenseIndex (std::size_t index) noexcept
+{
+	assert (index < numDenseIndices);
+
+	Interval interval;
+
+	interval.denseIndex = static_cast<std::uint8_t> (index);
+
+	return interval;
+}
+
+constexpr Interval Interval::fromPackedValue (std::uint8_t packedValue)
+{
+	return Interval { packedValue >> 3, static_cast<Quality> (packedValue & 7) };
+}
+
+constexpr Interval Interval::fromNumSemitones (int semitones) noexcept
+{
+	return fromDenseIndex (detail::intervalDenseIndexForSemitones (semitones));
+}
+
+constexpr Interval Interval::fromPitches (Pitch pitch1, Pitch pitch2) noexcept
+{
+	return fromNumSemitones (pitch1.getRoundedMidiPitch() - pitch2.getRoundedMidiPitch());
+}
+
+constexpr Interval Interval::fromPitches (int midiPitch1, int midiPitch2) noexcept
+{
+	return fromNumSemitones (midiPitch1 - midiPitch2);
+}
+
+constexpr std::uint8_t Interval::getPackedValue() const noexcept
+{
+	const auto [kind, quality] = detail::intervalsByDenseIndex[denseIndex];
+
+	return static_cast<std::uint8_t> ((kind << 3) | static_cast<int> (quality));
+}
+
+constexpr std::size_t Interval::getDenseIndex() const noexcept
+{
+	return denseIndex;
+}
+
+constexpr std::size_t Interval::getDenseIndex (int kind, Quality quality) noexcept
+{
+	return detail::intervalDenseIndicesByPackedValue[static_cast<std::size_t> ((kind << 3) | static_cast<int> (quality))];
+}
+
+constexpr int Interval::getNumSemitones() const noexcept
+{
+	return detail::intervalSemitonesByDenseIndex[denseIndex];
+}
+
+constexpr int Interval::getKind() const noexcept
+{
+	return detail::intervalsByDenseIndex[denseIndex].kind;
+}
+
+constexpr Interval::Quality Interval::getQuality() const noexcept
+{
+	return detail::intervalsByDenseIndex[denseIndex].quality;
+}
+
+namespace detail
+{
+
+// the position in the spelling table below of the first spelling of each number of semitones from 0 to 13, followed by the size of the table
+inline constexpr auto intervalSpellingOffsetsBySemitones = []
+{
+	std::array<std::uint8_t, Interval::numEnharmonicClasses + 1> offsets {};
+
+	for (const auto semitones : intervalSemitonesByDenseIndex)
+		++offsets[static_cast<std::size_t> (semitones) + 1];
+
+	for (auto index = 1UL; index < offsets.size(); ++index)
+		offsets[index] = static_cast<std::uint8_t> (offsets[index] + offsets[index - 1]);
+
+	return offsets;
+}();
+
+// every interval, ordered by number of semitones and then by kind
+inline constexpr auto intervalsBySemitones = []
+{
+	std::array<Interval, Interval::numDenseIndices> intervals {};
+
+	std::size_t position = 0;
+
+	for (auto semitones = 0UL; semitones < Interval::numEnharmonicClasses; ++semitones)
+		for (auto index = 0UL; index < intervalSemitonesByDenseIndex.size(); ++index)
+			if (intervalSemitonesByDenseIndex[index] == semitones)
+				intervals[position++] = Interval::fromDenseIndex (index);
+
+	return intervals;
+}();
+
+static_assert (intervalSpellingOffsetsBySemitones.back() == intervalsBySemitones.size(),
+			   "The interval spelling offsets do not cover every interval");
+
+}  // namespace detail
+
+constexpr std::size_t Interval::getEnharmonicClass() const noexcept
+{
+	return detail::intervalSemitonesByDenseIndex[denseIndex];
+}
+
+constexpr std::span<const Interval> Interval::getSpellings (int semitones) noexcept
+{
+	if (semitones < 0 || semitones >= static_cast<int> (numEnharmonicClasses))
+		return {};
+
+	const auto index = static_cast<std::size_t> (semitones);
+
+	const auto first = detail::intervalSpellingOffsetsBySemitones[index];
+	const auto last	 = detail::intervalSpellingOffsetsBySemitones[index + 1];
+
+	return std::span<const Interval> { detail::intervalsBySemitones }.subspan (first, static_cast<std::size_t> (last - first));
+}
+
+constexpr std::span<const Interval> Interval::getEnharmonicSpellings() const noexcept
+{
+	return getSpellings (static_cast<int> (getEnharmonicClass()));
+}
+
+constexpr bool Interval::isEnharmonicTo (const Interval& other) const noexcept
+{
+	return getEnharmonicClass() == other.getEnharmonicClass();
+}
+
+constexpr bool Interval::operator> (const Interval& other) const noexcept
+{
+	return other < *this;
+}
+
+constexpr bool Interval::operator<(const Interval& other) const noexcept
+{
+	const auto semitones	  = detail::intervalSemitonesByDenseIndex[denseIndex];
+	const auto otherSemitones = detail::intervalSemitonesByDenseIndex[other.denseIndex];
+
+	if (semitones != otherSemitones)
+		return semitones < otherSemitones;
+
+	return detail::intervalsByDenseIndex[denseIndex].kind < detail::intervalsByDenseIndex[other.denseIndex].kind;
+}
+
+constexpr bool Interval::operator>= (const Interval& other) const noexcept
+{
+	return ! (*this < other);
+}
+
+constexpr bool Interval::operator<= (const Interval& other) const noexcept
+{
+	return ! (other < *this);
+}
+
+constexpr Interval Interval::operator+ (const Interval& other) const noexcept
+{
+	return fromDenseIndex (detail::intervalSumsByDenseIndex[denseIndex][other.denseIndex]);
+}
+
+constexpr Interval Interval::operator- (const Interval& other) const noexcept
+{
+	return fromDenseIndex (detail::intervalDifferencesByDenseIndex[denseIndex][other.denseIndex]);
+}
+
+constexpr Interval Interval::operator+ (int semitonesToAdd) const noexcept
+{
+	return fromNumSemitones (detail::intervalSemitonesByDenseIndex[denseIndex] + semitonesToAdd);
+}
+
+constexpr Interval Interval::operator- (int semitonesToSubtract) const noexcept
+{
+	return fromNumSemitones (detail::intervalSemitonesByDenseIndex[denseIndex] - semitonesToSubtract);
+}
 
+constexpr Interval& Interval::operator+= (const Interval& other) noexcept
+{
+	denseIndex = detail::intervalSumsByDenseIndex[denseIndex][other.denseIndex];
+	return *this;
+}
+
+constexpr Interval& Interval::operator+= (int semitonesToAdd) noexcept
+{
+	*this = *this + semitonesToAdd;
+	return *this;
+}
+
+constexpr Interval& Interval::operator-= (const Interval& other) noexcept
+{
+	denseIndex = detail::intervalDifferencesByDenseIndex[denseIndex][other.denseIndex];
+	return *this;
+}
+
+constexpr Interval& Interval::operator-= (int semitonesToSubtract) noexcept
+{
+	*this = *this - semitonesToSubtract;
+	return *this;
+}
+
+constexpr Interval& Interval::operator++() noexcept
+{
+	denseIndex = detail::intervalIncrementsByDenseIndex[denseIndex];
+	return *this;
+}
+
+constexpr Interval& Interval::operator--() noexcept
+{
+	denseIndex = detail::intervalDecrementsByDenseIndex[denseIndex];
+	return *this;
+}
+
+constexpr Interval Interval::getInverse() const noexcept
+{
+	return fromDenseIndex (detail::intervalInversesByDenseIndex[denseIndex]);
+}
+
+constexpr std::span<const double> Interval::getCents_JustIntonation() const noexcept
+{
+	return std::span<const double> { detail::justRatioCents }.subspan (detail::justRatioOffsetsByDenseIndex[denseIndex], detail::numJustRatiosByDenseIndex[denseIndex]);
+}
+
+constexpr std::span<const JustRatio> Interval::getJustRatios() const noexcept
+{
+	return std::span<const JustRatio> { detail::justRatios }.subspan (detail::justRatioOffsetsByDenseIndex[denseIndex], detail::numJustRatiosByDenseIndex[denseIndex]);
+}
+
+constexpr int Interval::getCents_EqualTemperament() const noexcept
+{
+	constexpr auto centsPerSemitone = 100;
+
+	return getNumSemitones() * centsPerSemitone;
+}
+
+constexpr Pitch Interval::applyToPitch (Pitch other, bool above) const noexcept
+{
+	const auto semitones = getNumSemitones();
+	const auto starting	 = other.getRoundedMidiPitch();
+
+	if (above)
+		return Pitch { starting + semitones };
+
+	return Pitch { starting - semitones };
+}
+
+constexpr Pitch operator+ (const Pitch& pitch, const Interval& interval) noexcept
+{
+	return Pitch { pitch.getRoundedMidiPitch() + interval.getNumSemitones() };
+}
+
+constexpr Pitch operator- (const Pitch& pitch, const Interval& interval) noexcept
+{
+	return Pitch { pitch.getRoundedMidiPitch() - interval.getNumSemitones() };
+}
 
 }  // namespace limes::harmony
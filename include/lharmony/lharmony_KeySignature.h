@@ -14,10 +14,14 @@
 
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
+#include <functional>
 #include <vector>
 #include "lharmony/lharmony_Export.h"
 #include "lharmony/lharmony_Scale.h"
 #include "lharmony/lharmony_PitchClass.h"
+#include "lharmony/lharmony_PitchClassSet.h"
 
 /** @file
 	This file defines the KeySignature %scale class.
@@ -226,12 +230,42 @@ class LHARM_EXPORT KeySignature final : public Scale
 	/** Returns the set of intervals that make up this key signature. */
 	[[nodiscard]] std::vector<int> getIntervalsAsSemitones() const final;
 
+	/** Returns the %pitch classes that make up this key signature. */
+	[[nodiscard]] PitchClassSet getPitchClassSet() const noexcept final;
+
 	/** Returns 8. */
 	[[nodiscard]] int notesPerOctave() const noexcept final;
 
 	/** Returns a key signature with the same root as this one, but a different type. */
 	[[nodiscard]] KeySignature withType (Type newType) const noexcept;
 
+	/** @name Packed encodings */
+	///@{
+
+	/** The number of distinct key signatures: 8 numbers of accidentals, sharps or flats, and 3 types.
+		Dense indices run from 0 to 47.
+	 */
+	static constexpr std::size_t numDenseIndices = 48;
+
+	/** Returns a unique index between 0 and 47 for this key signature, which can be used as a perfect hash into an array of size numDenseIndices.
+		Key signatures with no accidentals count as distinct if they were created as sharp or flat keys, to match operator==.
+		@see fromDenseIndex()
+	 */
+	[[nodiscard]] constexpr std::size_t getDenseIndex() const noexcept;
+
+	/** Returns the key signature with the given dense index. */
+	[[nodiscard]] static constexpr KeySignature fromDenseIndex (std::size_t index) noexcept;
+
+	/** Returns this key signature packed into a single byte. This is the same value as getDenseIndex().
+		@see fromPackedValue()
+	 */
+	[[nodiscard]] constexpr std::uint8_t getPackedValue() const noexcept;
+
+	/** Recreates a key signature from a value returned by getPackedValue(). */
+	[[nodiscard]] static constexpr KeySignature fromPackedValue (std::uint8_t packedValue) noexcept;
+
+	///@}
+
 private:
 	[[nodiscard]] static constexpr bool useSharpsForRootByDefault (PitchClass root, Type type) noexcept;
 
@@ -249,3 +283,20 @@ class LHARM_EXPORT KeySignature final : public Scale
 }  // namespace limes::harmony::scales
 
 #include "./lharmony_KeySignature_impl.h"  // IWYU pragma: export
+
+namespace std
+{
+
+/** A specialization of \c std::hash for KeySignature objects.
+	@ingroup lharmony_scales
+ */
+template <>
+struct hash<limes::harmony::scales::KeySignature> final
+{
+	[[nodiscard]] size_t operator() (const limes::harmony::scales::KeySignature& key) const noexcept
+	{
+		return key.getDenseIndex();
+	}
+};
+
+}  // namespace std
@@ -195,4 +195,24 @@ constexpr KeySignature::Type KeySignature::getKeyType() const noexcept
 	return type;
 }
 
+constexpr std::size_t KeySignature::getDenseIndex() const noexcept
+{
+	return static_cast<std::size_t> (type) * 16 + (isFlat ? 8 : 0) + static_cast<std::size_t> (numAccidentals);
+}
+
+constexpr KeySignature KeySignature::fromDenseIndex (std::size_t index) noexcept
+{
+	return KeySignature { static_cast<int> (index % 8), (index / 8) % 2 == 0, static_cast<Type> (index / 16) };
+}
+
+constexpr std::uint8_t KeySignature::getPackedValue() const noexcept
+{
+	return static_cast<std::uint8_t> (getDenseIndex());
+}
+
+constexpr KeySignature KeySignature::fromPackedValue (std::uint8_t packedValue) noexcept
+{
+	return fromDenseIndex (packedValue);
+}
+
 }  // namespace limes::harmony::scales
@@ -0,0 +1,321 @@
+/*
+ * ======================================================================================
+ *  __    ____  __  __  ____  ___
+ * (  )  (_  _)(  \/  )( ___)/ __)
+ *  )(__  _)(_  )    (  )__) \__ \
+ * (____)(____)(_/\/\_)(____)(___/
+ *
+ *  This file is part of the Limes open source library and is licensed under the terms of the GNU Public License.
+ *
+ *  Commercial licenses are available; contact the maintainers at ben.the.vining@gmail.com to inquire for details.
+ *
+ * ======================================================================================
+ */
+
+#pragma once
+
+#include <bit>
+#include <cassert>
+#include <cstdint>
+#include <cstddef>
+#include <iterator>
+#include <initializer_list>
+#include "lharmony/lharmony_Export.h"
+#include "lharmony/lharmony_PitchClassSet.h"
+
+/** @file
+	This file defines the KeyboardState class.
+
+	@ingroup limes_harmony
+ */
+
+namespace limes::harmony
+{
+
+/** The set of MIDI notes currently held down on a keyboard, stored as a 128-bit mask.
+
+	Bit \c n of the mask is set if MIDI note \c n is on. The mask is stored as two 64-bit words: the low word holds notes 0 to 63, and the high word holds notes 64 to 127.
+	Turning a note on or off is a single bitwise operation, the lowest and highest notes are found with a bit scan, and folding the notes into a PitchClassSet
+	takes a handful of shifts, so this class is suitable for tracking live MIDI input without ever allocating.
+
+	Iterating over a state yields the MIDI numbers of its active notes in ascending order.
+
+	@ingroup limes_harmony
+	@see PitchClassSet, Chord::getKeyboardState()
+ */
+class LHARM_EXPORT KeyboardState final
+{
+public:
+	/** The underlying integer type used to store each half of the mask. */
+	using Word = std::uint64_t;
+
+	/** The number of MIDI notes that a KeyboardState can represent. */
+	static constexpr int numNotes = 128;
+
+	/** @name Constructors */
+	///@{
+	/** Creates a state with no notes on. */
+	constexpr KeyboardState() noexcept = default;
+
+	/** Creates a state with the given MIDI notes on. Notes outside the range 0 to 127 are ignored. */
+	constexpr KeyboardState (std::initializer_list<int> midiNotes) noexcept
+	{
+		for (const auto note : midiNotes)
+			noteOn (note);
+	}
+
+	/** Creates a state from its raw bitmask.
+		@param lowNotesMask The mask for MIDI notes 0 to 63, where bit 0 is note 0.
+		@param highNotesMask The mask for MIDI notes 64 to 127, where bit 0 is note 64.
+	 */
+	[[nodiscard]] static constexpr KeyboardState fromMasks (Word lowNotesMask, Word highNotesMask) noexcept
+	{
+		KeyboardState state;
+		state.low  = lowNotesMask;
+		state.high = highNotesMask;
+		return state;
+	}
+	///@}
+
+	constexpr KeyboardState (const KeyboardState&) = default;
+	constexpr KeyboardState& operator=(const KeyboardState&) = default;
+
+	constexpr KeyboardState (KeyboardState&&) = default;
+	constexpr KeyboardState& operator=(KeyboardState&&) = default;
+
+	/** @name Equality comparisons */
+	///@{
+	/** Returns true if the two states have exactly the same notes on. */
+	[[nodiscard]] constexpr bool operator== (const KeyboardState& other) const noexcept
+	{
+		return low == other.low && high == other.high;
+	}
+
+	/** Returns true if the two states do not have exactly the same notes on. */
+	[[nodiscard]] constexpr bool operator!= (const KeyboardState& other) const noexcept
+	{
+		return ! (*this == other);
+	}
+	///@}
+
+	/** @name Modification */
+	///@{
+	/** Turns on a MIDI note. Turning on a note that is already on does nothing, and notes outside the range 0 to 127 are ignored. */
+	constexpr KeyboardState& noteOn (int midiNote) noexcept
+	{
+		if (midiNote >= 0 && midiNote < numNotes)
+			wordFor (midiNote) |= bitFor (midiNote);
+
+		return *this;
+	}
+
+	/** Turns off a MIDI note. Turning off a note that is already off does nothing, and notes outside the range 0 to 127 are ignored. */
+	constexpr KeyboardState& noteOff (int midiNote) noexcept
+	{
+		if (midiNote >= 0 && midiNote < numNotes)
+			wordFor (midiNote) &= ~bitFor (midiNote);
+
+		return *this;
+	}
+
+	/** Turns a MIDI note on or off. */
+	constexpr KeyboardState& setNote (int midiNote, bool isOn) noexcept
+	{
+		return isOn ? noteOn (midiNote) : noteOff (midiNote);
+	}
+
+	/** Turns off all notes. */
+	constexpr void allNotesOff() noexcept
+	{
+		low	 = 0;
+		high = 0;
+	}
+	///@}
+
+	/** @name Queries */
+	///@{
+	/** Returns true if the given MIDI note is on. Notes outside the range 0 to 127 are never on. */
+	[[nodiscard]] constexpr bool isNoteOn (int midiNote) const noexcept
+	{
+		if (midiNote < 0 || midiNote >= numNotes)
+			return false;
+
+		return ((midiNote < 64 ? low : high) & bitFor (midiNote)) != 0;
+	}
+
+	/** Returns true if no notes are on. */
+	[[nodiscard]] constexpr bool isEmpty() const noexcept
+	{
+		return (low | high) == 0;
+	}
+
+	/** Returns the number of notes that are on. */
+	[[nodiscard]] constexpr int getNumNotesOn() const noexcept
+	{
+		return std::popcount (low) + std::popcount (high);
+	}
+
+	/** Returns the lowest MIDI note that is on. The state must not be empty. */
+	[[nodiscard]] constexpr int getLowestNote() const noexcept
+	{
+		assert (! isEmpty());
+
+		if (low != 0)
+			return std::countr_zero (low);
+
+		return 64 + std::countr_zero (high);
+	}
+
+	/** Returns the highest MIDI note that is on. The state must not be empty. */
+	[[nodiscard]] constexpr int getHighestNote() const noexcept
+	{
+		assert (! isEmpty());
+
+		if (high != 0)
+			return 64 + static_cast<int> (std::bit_width (high)) - 1;
+
+		return static_cast<int> (std::bit_width (low)) - 1;
+	}
+
+	/** Returns the %pitch classes of all the notes that are on. */
+	[[nodiscard]] constexpr PitchClassSet getPitchClassSet() const noexcept
+	{
+		// note 64 is an E, so the high word's %pitch classes are rotated up by 4 semitones
+		return PitchClassSet::fromMask (foldToPitchClasses (low)) | PitchClassSet::fromMask (foldToPitchClasses (high)).transposed (4);
+	}
+
+	/** Returns the mask for MIDI notes 0 to 63, where bit 0 is note 0. */
+	[[nodiscard]] constexpr Word getLowNotesMask() const noexcept
+	{
+		return low;
+	}
+
+	/** Returns the mask for MIDI notes 64 to 127, where bit 0 is note 64. */
+	[[nodiscard]] constexpr Word getHighNotesMask() const noexcept
+	{
+		return high;
+	}
+	///@}
+
+	/** @name Set operations */
+	///@{
+	/** Returns the notes that are on in either state. */
+	[[nodiscard]] constexpr KeyboardState operator| (const KeyboardState& other) const noexcept
+	{
+		return fromMasks (low | other.low, high | other.high);
+	}
+
+	/** Returns the notes that are on in both states. */
+	[[nodiscard]] constexpr KeyboardState operator& (const KeyboardState& other) const noexcept
+	{
+		return fromMasks (low & other.low, high & other.high);
+	}
+
+	/** Returns the notes that are on in exactly one of the two states. */
+	[[nodiscard]] constexpr KeyboardState operator^ (const KeyboardState& other) const noexcept
+	{
+		return fromMasks (low ^ other.low, high ^ other.high);
+	}
+
+	/** Returns the notes that are on in this state but not in the other one. */
+	[[nodiscard]] constexpr KeyboardState operator- (const KeyboardState& other) const noexcept
+	{
+		return fromMasks (low & ~other.low, high & ~other.high);
+	}
+	///@}
+
+	/** A forward iterator over the active notes in a state, in ascending order. */
+	class Iterator final
+	{
+	public:
+		using iterator_category = std::forward_iterator_tag;
+		using value_type		= int;
+		using difference_type	= std::ptrdiff_t;
+		using pointer			= void;
+		using reference			= int;
+
+		constexpr Iterator() noexcept = default;
+
+		constexpr Iterator (Word remainingLowBits, Word remainingHighBits) noexcept
+			: remainingLow (remainingLowBits), remainingHigh (remainingHighBits)
+		{
+		}
+
+		[[nodiscard]] constexpr int operator*() const noexcept
+		{
+			if (remainingLow != 0)
+				return std::countr_zero (remainingLow);
+
+			return 64 + std::countr_zero (remainingHigh);
+		}
+
+		constexpr Iterator& operator++() noexcept
+		{
+			// clear the lowest set bit
+			if (remainingLow != 0)
+				remainingLow &= remainingLow - 1U;
+			else
+				remainingHigh &= remainingHigh - 1U;
+
+			return *this;
+		}
+
+		constexpr Iterator operator++ (int) noexcept
+		{
+			auto copy = *this;
+			++(*this);
+			return copy;
+		}
+
+		[[nodiscard]] constexpr bool operator== (const Iterator& other) const noexcept
+		{
+			return remainingLow == other.remainingLow && remainingHigh == other.remainingHigh;
+		}
+
+		[[nodiscard]] constexpr bool operator!= (const Iterator& other) const noexcept
+		{
+			return ! (*this == other);
+		}
+
+	private:
+		Word remainingLow { 0 }, remainingHigh { 0 };
+	};
+
+	/** Returns an iterator to the lowest active note. */
+	[[nodiscard]] constexpr Iterator begin() const noexcept
+	{
+		return Iterator { low, high };
+	}
+
+	/** Returns an iterator past the highest active note. */
+	[[nodiscard]] constexpr Iterator end() const noexcept
+	{
+		return Iterator {};
+	}
+
+private:
+	[[nodiscard]] constexpr Word& wordFor (int midiNote) noexcept
+	{
+		assert (midiNote >= 0 && midiNote < numNotes);
+
+		return midiNote < 64 ? low : high;
+	}
+
+	[[nodiscard]] static constexpr Word bitFor (int midiNote) noexcept
+	{
+		return Word { 1 } << (static_cast<unsigned> (midiNote) & 63U);
+	}
+
+	// ORs together the 12-bit groups of a word, so that bit n of the result is set if any bit n + 12k of the word is set
+	[[nodiscard]] static constexpr PitchClassSet::Mask foldToPitchClasses (Word word) noexcept
+	{
+		// the groups starting at bits 36, 48 and 60 land on the groups starting at bits 0, 12 and 24
+		const auto folded = word | (word >> 36);
+
+		return static_cast<PitchClassSet::Mask> ((folded | (folded >> 12) | (folded >> 24)) & PitchClassSet::allPitchClassesMask);
+	}
+
+	Word low { 0 }, high { 0 };
+};
+
+}  // namespace limes::harmony
@@ -0,0 +1,224 @@
+/*
+ * ======================================================================================
+ *  __    ____  __  __  ____  ___
+ * (  )  (_  _)(  \/  )( ___)/ __)
+ *  )(__  _)(_  )    (  )__) \__ \
+ * (____)(____)(_/\/\_)(____)(___/
+ *
+ *  This file is part of the Limes open source library and is licensed under the terms of the GNU Public License.
+ *
+ *  Commercial licenses are available; contact the maintainers at ben.the.vining@gmail.com to inquire for details.
+ *
+ * ======================================================================================
+ */
+
+#pragma once
+
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include "lharmony/lharmony_Export.h"
+#include "lharmony/lharmony_CompoundInterval.h"
+#include "lharmony/lharmony_Interval.h"
+#include "lharmony/lharmony_Pitch.h"
+
+/** @file
+	This file defines the \c MelodicInterval and \c MelodicIntervalHistogram classes, and a batch function for finding the intervals of a melody.
+
+	@ingroup lharmony_intervals
+ */
+
+namespace limes::harmony
+{
+
+/** The signed distance from one note of a melody to the next, together with its spelling.
+
+	This packs the number of semitones and the simple %interval into 4 bytes, so the intervals of a long melody can be stored compactly and
+	analysed without recomputing their spellings. The spelling is the same as CompoundInterval::fromPitches() gives for the two notes.
+
+	@ingroup lharmony_intervals
+	@see getMelodicIntervals(), MelodicIntervalHistogram
+ */
+class LHARM_EXPORT MelodicInterval final
+{
+public:
+	/** Creates a repeated note, a melodic unison. */
+	constexpr MelodicInterval() noexcept = default;
+
+	/** Creates a melodic %interval of the given number of semitones, which is positive for an ascending %interval and negative for a descending one.
+		The number of semitones must fit in a signed 16-bit integer.
+	 */
+	constexpr explicit MelodicInterval (int numSemitones) noexcept
+		: semitones (static_cast<std::int16_t> (numSemitones)),
+		  interval (Interval::fromNumSemitones ((numSemitones < 0 ? -numSemitones : numSemitones) % semitonesInOctave))
+	{
+		assert (numSemitones >= std::numeric_limits<std::int16_t>::min() && numSemitones <= std::numeric_limits<std::int16_t>::max());
+	}
+
+	/** Returns the melodic %interval from one %pitch to the next. Both pitches are rounded to the nearest semitone. */
+	[[nodiscard]] static constexpr MelodicInterval fromPitches (const Pitch& from, const Pitch& to) noexcept
+	{
+		return MelodicInterval { to.getRoundedMidiPitch() - from.getRoundedMidiPitch() };
+	}
+
+	/** Returns true if the two intervals are the same distance in the same direction. */
+	[[nodiscard]] constexpr bool operator== (const MelodicInterval& other) const noexcept
+	{
+		return semitones == other.semitones;
+	}
+
+	/** Returns true if the two intervals are not the same distance in the same direction. */
+	[[nodiscard]] constexpr bool operator!= (const MelodicInterval& other) const noexcept
+	{
+		return semitones != other.semitones;
+	}
+
+	/** Returns the same %interval in the opposite direction, keeping its spelling. */
+	[[nodiscard]] constexpr MelodicInterval operator-() const noexcept
+	{
+		assert (semitones > std::numeric_limits<std::int16_t>::min());
+
+		MelodicInterval inverted { *this };
+
+		inverted.semitones = static_cast<std::int16_t> (-semitones);
+
+		return inverted;
+	}
+
+	/** Returns the number of semitones of this %interval, which is positive for an ascending %interval and negative for a descending one. */
+	[[nodiscard]] constexpr int getNumSemitones() const noexcept
+	{
+		return semitones;
+	}
+
+	/** Returns true if the second note is higher than the first. */
+	[[nodiscard]] constexpr bool isAscending() const noexcept
+	{
+		return semitones > 0;
+	}
+
+	/** Returns true if the second note is lower than the first. */
+	[[nodiscard]] constexpr bool isDescending() const noexcept
+	{
+		return semitones < 0;
+	}
+
+	/** Returns true if both notes are the same. */
+	[[nodiscard]] constexpr bool isRepeatedNote() const noexcept
+	{
+		return semitones == 0;
+	}
+
+	/** Returns the spelling of this %interval reduced to within an octave, ignoring its direction. */
+	[[nodiscard]] constexpr Interval getSimpleInterval() const noexcept
+	{
+		return interval;
+	}
+
+	/** Returns the spelling of this %interval, ignoring its direction. */
+	[[nodiscard]] constexpr CompoundInterval getCompoundInterval() const noexcept
+	{
+		return CompoundInterval { (semitones < 0 ? -semitones : semitones) / semitonesInOctave, interval };
+	}
+
+private:
+	std::int16_t semitones { 0 };
+	Interval	 interval;
+};
+
+/** Counts how often each melodic %interval occurs, by its signed number of semitones.
+
+	Intervals of up to maxSemitones in each direction each have their own count; larger leaps are counted with the intervals of exactly maxSemitones
+	in the same direction.
+
+	@ingroup lharmony_intervals
+	@see getMelodicIntervals()
+ */
+class LHARM_EXPORT MelodicIntervalHistogram final
+{
+public:
+	/** The largest %interval, in semitones, that has its own count in each direction. */
+	static constexpr int maxSemitones = 2 * semitonesInOctave;
+
+	/** Counts one occurrence of an %interval. */
+	constexpr void add (const MelodicInterval& interval) noexcept
+	{
+		++counts[getBin (interval.getNumSemitones())];
+	}
+
+	/** Adds the counts of another histogram to this one. */
+	constexpr MelodicIntervalHistogram& operator+= (const MelodicIntervalHistogram& other) noexcept
+	{
+		for (auto i = 0UL; i < counts.size(); ++i)
+			counts[i] += other.counts[i];
+
+		return *this;
+	}
+
+	/** Returns the number of occurrences of intervals with the given signed number of semitones. */
+	[[nodiscard]] constexpr std::uint64_t getCount (int numSemitones) const noexcept
+	{
+		return counts[getBin (numSemitones)];
+	}
+
+	/** Returns the number of occurrences of an %interval in either direction. */
+	[[nodiscard]] constexpr std::uint64_t getCount (const CompoundInterval& interval) const noexcept
+	{
+		const auto numSemitones = interval.getNumSemitones();
+
+		if (numSemitones == 0)
+			return getCount (0);
+
+		return getCount (numSemitones) + getCount (-numSemitones);
+	}
+
+	/** Returns the total number of intervals counted. */
+	[[nodiscard]] constexpr std::uint64_t getTotal() const noexcept
+	{
+		std::uint64_t total = 0;
+
+		for (const auto count : counts)
+			total += count;
+
+		return total;
+	}
+
+	/** Resets every count to 0. */
+	constexpr void clear() noexcept
+	{
+		counts = {};
+	}
+
+private:
+	[[nodiscard]] static constexpr std::size_t getBin (int numSemitones) noexcept
+	{
+		if (numSemitones < -maxSemitones)
+			numSemitones = -maxSemitones;
+		else if (numSemitones > maxSemitones)
+			numSemitones = maxSemitones;
+
+		return static_cast<std::size_t> (numSemitones + maxSemitones);
+	}
+
+	std::array<std::uint64_t, 2 * maxSemitones + 1> counts {};
+};
+
+/** Finds the melodic %interval between each pair of consecutive notes of a melody.
+
+	This gives the same results as calling MelodicInterval::fromPitches() on each pair of notes in turn, but rounds the pitches and subtracts them
+	several at a time with SIMD instructions where available, and never allocates.
+	Every MIDI %pitch must be finite and within the range of \c int, and the difference between consecutive notes must fit in a signed 16-bit integer.
+
+	@param melody The notes of the melody, in order.
+	@param intervals Receives the %interval from each note to the next. This must be at least one shorter than the melody.
+	@param histogram If not null, each %interval is also counted in this histogram, in the same pass.
+
+	@ingroup lharmony_intervals
+ */
+LHARM_EXPORT void getMelodicIntervals (std::span<const Pitch> melody, std::span<MelodicInterval> intervals,
+									   MelodicIntervalHistogram* histogram = nullptr) noexcept;
+
+}  // namespace limes::harmony
@@ -14,9 +14,12 @@
 
 #pragma once
 
-#include <cmath>
 #include "lharmony/lharmony_Export.h"
+#include "lharmony/lharmony_CompoundInterval.h"
+#include "lharmony/lharmony_Interval.h"
 #include "lharmony/lharmony_Pitch.h"
+#include "lharmony/lharmony_PitchUtils.h"
+#include "lharmony/lharmony_RatioInterval.h"
 
 /** @file
 	This file defines the \c MicrotonalInterval class.
@@ -29,7 +32,12 @@ namespace limes::harmony
 
 /** A class that can represent intervals that are not whole numbers of semitones.
 
-	@see Interval, CompoundInterval
+	The size is stored as a single-precision number of semitones, so that, like Interval and CompoundInterval, this class is 4 bytes and trivially copyable.
+	This is accurate to better than a thousandth of a cent for intervals of up to ten octaves.
+
+	Simple, compound and ratio intervals can be converted to microtonal intervals with the explicit constructors; getNearestCompoundInterval() converts back, rounding to the nearest semitone.
+
+	@see Interval, CompoundInterval, RatioInterval
 
 	@todo operator<< for std::ostream (toString method)
  */
@@ -37,7 +45,25 @@ class LHARM_EXPORT MicrotonalInterval final
 {
 public:
 	constexpr explicit MicrotonalInterval (double numSemitones)
-		: semitones (numSemitones)
+		: semitones (static_cast<float> (numSemitones))
+	{
+	}
+
+	/** Creates a microtonal %interval with the same number of semitones as a simple %interval. */
+	constexpr explicit MicrotonalInterval (const Interval& interval) noexcept
+		: semitones (static_cast<float> (interval.getNumSemitones()))
+	{
+	}
+
+	/** Creates a microtonal %interval with the same number of semitones as a compound %interval. */
+	constexpr explicit MicrotonalInterval (const CompoundInterval& interval) noexcept
+		: semitones (static_cast<float> (interval.getNumSemitones()))
+	{
+	}
+
+	/** Creates a microtonal %interval with the size of a just intonation ratio. */
+	constexpr explicit MicrotonalInterval (const RatioInterval& interval) noexcept
+		: semitones (static_cast<float> (interval.getSemitones()))
 	{
 	}
 
@@ -62,27 +88,35 @@ class LHARM_EXPORT MicrotonalInterval final
 	}
 
 	/** Returns true if this microtonal %interval is larger than the other one. */
-	[[nodiscard]] inline bool operator> (const MicrotonalInterval& other) const noexcept
+	[[nodiscard]] constexpr bool operator> (const MicrotonalInterval& other) const noexcept
 	{
-		return std::abs (semitones) > std::abs (other.semitones);
+		return getMagnitude() > other.getMagnitude();
 	}
 
 	/** Returns true if this microtonal %interval is smaller than the other one. */
-	[[nodiscard]] inline bool operator<(const MicrotonalInterval& other) const noexcept
+	[[nodiscard]] constexpr bool operator<(const MicrotonalInterval& other) const noexcept
 	{
-		return std::abs (semitones) < std::abs (other.semitones);
+		return getMagnitude() < other.getMagnitude();
 	}
 
 	/** Returns the number of cents this microtonal %interval would represent in equal temperament. */
 	[[nodiscard]] constexpr double getCents() const noexcept
 	{
-		return semitones * 100.;
+		return getSemitones() * 100.;
 	}
 
 	/** Returns the number of semitones this microtonal %interval represents. */
 	[[nodiscard]] constexpr double getSemitones() const noexcept
 	{
-		return semitones;
+		return static_cast<double> (semitones);
+	}
+
+	/** Returns the compound %interval nearest in size to this one, ignoring its direction.
+		@see CompoundInterval::getSimpleInterval()
+	 */
+	[[nodiscard]] constexpr CompoundInterval getNearestCompoundInterval() const noexcept
+	{
+		return CompoundInterval { roundToNearestInt (getMagnitude()) };
 	}
 
 	/** Returns a new pitch object that represents the note this interval's distance above or below the passed pitch object.
@@ -92,13 +126,18 @@ class LHARM_EXPORT MicrotonalInterval final
 	[[nodiscard]] constexpr Pitch applyToPitch (Pitch other, bool above) const noexcept
 	{
 		if (above)
-			return Pitch { other.getMidiPitch() + semitones };
+			return Pitch { other.getMidiPitch() + getSemitones() };
 
-		return Pitch { other.getMidiPitch() - semitones };
+		return Pitch { other.getMidiPitch() - getSemitones() };
 	}
 
 private:
-	double semitones { 0. };
+	[[nodiscard]] constexpr double getMagnitude() const noexcept
+	{
+		return semitones < 0.f ? -getSemitones() : getSemitones();
+	}
+
+	float semitones { 0.f };
 };
 
 
@@ -14,11 +14,15 @@
 
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
+#include <functional>
 #include <vector>
 #include "lharmony/lharmony_Export.h"
 #include "lharmony/lharmony_KeySignature.h"
 #include "lharmony/lharmony_Scale.h"
 #include "lharmony/lharmony_PitchClass.h"
+#include "lharmony/lharmony_PitchClassSet.h"
 
 /** @file
 	This file defines the Mode %scale class.
@@ -105,6 +109,9 @@ class LHARM_EXPORT Mode final : public Scale
 	/** Returns the set of intervals that make up this %mode. */
 	[[nodiscard]] std::vector<int> getIntervalsAsSemitones() const final;
 
+	/** Returns the %pitch classes that make up this %mode. */
+	[[nodiscard]] PitchClassSet getPitchClassSet() const noexcept final;
+
 	/** Returns the %pitch class of the root of this %mode. */
 	[[nodiscard]] PitchClass getPitchClassOfRoot() const noexcept final;
 
@@ -120,6 +127,43 @@ class LHARM_EXPORT Mode final : public Scale
 	/** Returns an equivalent key signature for this mode. The returned key signature contains all the same %pitch classes as this %mode, but may have a different root. */
 	[[nodiscard]] KeySignature getKeySignature() const noexcept;
 
+	/** @name Packed encodings */
+	///@{
+
+	/** The number of distinct modes: 7 types on 12 roots. Dense indices run from 0 to 83. */
+	static constexpr std::size_t numDenseIndices = 84;
+
+	/** Returns a unique index between 0 and 83 for this %mode, which can be used as a perfect hash into an array of size numDenseIndices.
+		The index is <tt>type * 12 + root</tt>, so all the Ionian modes come first, in order of their roots.
+		@see fromDenseIndex()
+	 */
+	[[nodiscard]] constexpr std::size_t getDenseIndex() const noexcept
+	{
+		return static_cast<std::size_t> (type) * semitonesInOctave + rootPitchClass.getDenseIndex();
+	}
+
+	/** Returns the %mode with the given dense index. */
+	[[nodiscard]] static constexpr Mode fromDenseIndex (std::size_t index) noexcept
+	{
+		return Mode { static_cast<Type> (index / semitonesInOctave), PitchClass::fromDenseIndex (index % semitonesInOctave) };
+	}
+
+	/** Returns this %mode packed into a single byte. This is the same value as getDenseIndex().
+		@see fromPackedValue()
+	 */
+	[[nodiscard]] constexpr std::uint8_t getPackedValue() const noexcept
+	{
+		return static_cast<std::uint8_t> (getDenseIndex());
+	}
+
+	/** Recreates a %mode from a value returned by getPackedValue(). */
+	[[nodiscard]] static constexpr Mode fromPackedValue (std::uint8_t packedValue) noexcept
+	{
+		return fromDenseIndex (packedValue);
+	}
+
+	///@}
+
 private:
 	Type type { Type::Ionian };
 
@@ -127,3 +171,20 @@ class LHARM_EXPORT Mode final : public Scale
 };
 
 }  // namespace limes::harmony::scales
+
+namespace std
+{
+
+/** A specialization of \c std::hash for Mode objects.
+	@ingroup lharmony_scales
+ */
+template <>
+struct hash<limes::harmony::scales::Mode> final
+{
+	[[nodiscard]] size_t operator() (const limes::harmony::scales::Mode& mode) const noexcept
+	{
+		return mode.getDenseIndex();
+	}
+};
+
+}  // namespace std
@@ -18,6 +18,7 @@
 #include "lharmony/lharmony_Export.h"
 #include "lharmony/lharmony_Scale.h"
 #include "lharmony/lharmony_PitchClass.h"
+#include "lharmony/lharmony_PitchClassSet.h"
 
 /** @file
 	This file defines the Octatonic %scale class.
@@ -75,6 +76,9 @@ class LHARM_EXPORT Octatonic final : public Scale
 	/** Returns a sequence of alternating 2's and 1's. */
 	[[nodiscard]] std::vector<int> getIntervalsAsSemitones() const final;
 
+	/** Returns the 8 %pitch classes that make up this %scale. */
+	[[nodiscard]] PitchClassSet getPitchClassSet() const noexcept final;
+
 	/** Returns the %pitch class of the root of this %scale. */
 	[[nodiscard]] PitchClass getPitchClassOfRoot() const noexcept final;
 
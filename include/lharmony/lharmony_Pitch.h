@@ -14,10 +14,14 @@
 
 #pragma once
 
-#include <ostream>
+#include <bit>
+#include <cstdint>
+#include <functional>
+#include <iosfwd>
 #include "lharmony/lharmony_Export.h"
 #include "lharmony/lharmony_PitchClass.h"
 #include "lharmony/lharmony_PitchUtils.h"
+#include "lharmony/lharmony_TuningReference.h"
 
 /** @file
 	This file defines the \c Pitch class.
@@ -77,6 +81,16 @@ class LHARM_EXPORT Pitch final
 		return Pitch { freqToMidi (freqHz) };
 	}
 
+	/** Creates a Pitch object from a frequency in Hz, in the given tuning.
+
+		@see TuningReference::getMidiPitch()
+	 */
+	template <ArithmeticType T>
+	[[nodiscard]] static Pitch fromFreq (T freqHz, const TuningReference& tuning) noexcept
+	{
+		return Pitch { tuning.getMidiPitch (static_cast<double> (freqHz)) };
+	}
+
 	/** Creates a Pitch object from a MIDI note number.
 		This is the same as the single-argument constructor, but a bit more explicit with the
 		fact that the argument is a MIDI note number.
@@ -117,7 +131,10 @@ class LHARM_EXPORT Pitch final
 	}
 
 	/** Returns true if the two %pitch objects round to the same nearest MIDI note. */
-	[[nodiscard]] bool approximatelyEqual (Pitch other) const noexcept;
+	[[nodiscard]] constexpr bool approximatelyEqual (Pitch other) const noexcept
+	{
+		return getRoundedMidiPitch() == other.getRoundedMidiPitch();
+	}
 	///@}
 
 	/** Returns true if this %pitch is higher than the other one. */
@@ -138,11 +155,51 @@ class LHARM_EXPORT Pitch final
 	/** Returns this %pitch as a frequency in Hz.
 		@see math::midiToFreq()
 	 */
-	[[nodiscard]] double getFreqHz() const noexcept;
+	[[nodiscard]] double getFreqHz() const noexcept
+	{
+		return midiToFreq (midiPitch);
+	}
 
 	/** Returns this %pitch as a frequency in Hz, rounded to the nearest integer.
 	 */
-	[[nodiscard]] int getRoundedFreqHz() const noexcept;
+	[[nodiscard]] int getRoundedFreqHz() const noexcept
+	{
+		return roundToNearestInt (getFreqHz());
+	}
+
+	/** Returns this %pitch as a frequency in Hz, in the given tuning.
+		For whole-numbered MIDI notes from 0 to 127, this is a table lookup.
+		@see TuningReference::getFreqHz()
+	 */
+	[[nodiscard]] double getFreqHz (const TuningReference& tuning) const noexcept
+	{
+		return tuning.getFreqHz (midiPitch);
+	}
+
+	/** Returns this %pitch as a frequency in Hz in the given tuning, rounded to the nearest integer.
+	 */
+	[[nodiscard]] int getRoundedFreqHz (const TuningReference& tuning) const noexcept
+	{
+		return roundToNearestInt (getFreqHz (tuning));
+	}
+
+	/** @name Packed encodings */
+	///@{
+	/** Returns the bit pattern of this pitch's MIDI %pitch as a 64-bit integer.
+		Negative zero is stored as positive zero, so two pitches that compare equal always have the same packed value.
+		@see fromPackedValue()
+	 */
+	[[nodiscard]] constexpr std::uint64_t getPackedValue() const noexcept
+	{
+		return std::bit_cast<std::uint64_t> (midiPitch + 0.);
+	}
+
+	/** Recreates a %pitch from a value returned by getPackedValue(). */
+	[[nodiscard]] static constexpr Pitch fromPackedValue (std::uint64_t packedValue) noexcept
+	{
+		return Pitch { std::bit_cast<double> (packedValue) };
+	}
+	///@}
 
 	/** Returns the MIDI %pitch that this %pitch object represents. */
 	[[nodiscard]] constexpr double getMidiPitch() const noexcept
@@ -150,31 +207,64 @@ class LHARM_EXPORT Pitch final
 		return midiPitch;
 	}
 
-	/** Returns this %pitch object's MIDI pitch, rounded to the nearest integer MIDI note. */
-	[[nodiscard]] int getRoundedMidiPitch() const noexcept;
+	/** Returns this %pitch object's MIDI pitch, rounded to the nearest integer MIDI note.
+		Halfway values are rounded away from zero, like \c std::round().
+	 */
+	[[nodiscard]] constexpr int getRoundedMidiPitch() const noexcept
+	{
+		return roundToNearestInt (midiPitch);
+	}
 
 	/** Returns this %pitch object's %pitch class.
 		@see PitchClass
 	 */
-	[[nodiscard]] PitchClass getPitchClass() const noexcept;
+	[[nodiscard]] constexpr PitchClass getPitchClass() const noexcept
+	{
+		return PitchClass { getRoundedMidiPitch() };
+	}
 
 	/** Returns this %pitch object's MIDI octave number.
 		@see octaveNumberOfMidiNote()
 	 */
-	[[nodiscard]] int getOctaveNumber() const noexcept;
+	[[nodiscard]] constexpr int getOctaveNumber() const noexcept
+	{
+		return octaveNumberOfMidiNote (getRoundedMidiPitch());
+	}
 
 	/** Returns true if this pitch's nearest integer MIDI note is a black key on a standard keyboard. */
-	[[nodiscard]] bool isBlackKey() const noexcept;
+	[[nodiscard]] constexpr bool isBlackKey() const noexcept
+	{
+		return getPitchClass().isBlackKey();
+	}
 
 	/** Returns true if this pitch's nearest integer MIDI note is a white key on a standard keyboard. */
-	[[nodiscard]] bool isWhiteKey() const noexcept;
+	[[nodiscard]] constexpr bool isWhiteKey() const noexcept
+	{
+		return ! isBlackKey();
+	}
 
 	/** Returns true if this %pitch does not correspond exactly with any of the keys on a piano tuned to equal temperament.
 	 */
-	[[nodiscard]] bool isMicrotone() const noexcept;
+	[[nodiscard]] constexpr bool isMicrotone() const noexcept
+	{
+		// every double of magnitude 2^52 or more (including infinity) is a whole number, and NaN never is;
+		// handling those first also keeps the conversion below in range
+		constexpr auto smallestWholeOnlyValue = 4503599627370496.;
+
+		if (midiPitch != midiPitch)	 // NOLINT
+			return true;
+
+		if (midiPitch >= smallestWholeOnlyValue || midiPitch <= -smallestWholeOnlyValue)
+			return false;
+
+		return static_cast<double> (static_cast<long long> (midiPitch)) != midiPitch;
+	}
 
 	/** Returns the %pitch class of this %pitch, in the desired MIDI octave. */
-	[[nodiscard]] Pitch inOctave (int octaveNumber) const noexcept;
+	[[nodiscard]] constexpr Pitch inOctave (int octaveNumber) const noexcept
+	{
+		return Pitch { getPitchClass(), octaveNumber };
+	}
 
 private:
 	double midiPitch { 60. };
@@ -188,3 +278,20 @@ class LHARM_EXPORT Pitch final
 LHARM_EXPORT std::ostream& operator<< (std::ostream& os, const Pitch& value);
 
 }  // namespace limes::harmony
+
+namespace std
+{
+
+/** A specialization of \c std::hash for Pitch objects.
+	@ingroup limes_harmony
+ */
+template <>
+struct hash<limes::harmony::Pitch> final
+{
+	[[nodiscard]] size_t operator() (const limes::harmony::Pitch& pitch) const noexcept
+	{
+		return hash<std::uint64_t> {}(pitch.getPackedValue());
+	}
+};
+
+}  // namespace std
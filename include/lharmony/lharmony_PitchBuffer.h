@@ -0,0 +1,243 @@
+/*
+ * ======================================================================================
+ *  __    ____  __  __  ____  ___
+ * (  )  (_  _)(  \/  )( ___)/ __)
+ *  )(__  _)(_  )    (  )__) \__ \
+ * (____)(____)(_/\/\_)(____)(___/
+ *
+ *  This file is part of the Limes open source library and is licensed under the terms of the GNU Public License.
+ *
+ *  Commercial licenses are available; contact the maintainers at ben.the.vining@gmail.com to inquire for details.
+ *
+ * ======================================================================================
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <initializer_list>
+#include <new>
+#include <span>
+#include <vector>
+#include "lharmony/lharmony_Export.h"
+#include "lharmony/lharmony_Pitch.h"
+#include "lharmony/lharmony_Interval.h"
+#include "lharmony/lharmony_CompoundInterval.h"
+#include "lharmony/lharmony_MicrotonalInterval.h"
+
+/** @file
+	This file defines the PitchBuffer class.
+
+	@ingroup limes_harmony
+ */
+
+namespace limes::harmony
+{
+
+namespace detail
+{
+
+/** A minimal allocator that returns memory aligned to the given number of bytes.
+	This is not \c final, because standard containers may derive from their allocator.
+ */
+template <typename T, std::size_t Alignment>
+struct AlignedAllocator
+{
+	using value_type = T;
+
+	template <typename U>
+	struct rebind final
+	{
+		using other = AlignedAllocator<U, Alignment>;
+	};
+
+	constexpr AlignedAllocator() noexcept = default;
+
+	template <typename U>
+	constexpr AlignedAllocator (const AlignedAllocator<U, Alignment>&) noexcept  // NOLINT
+	{
+	}
+
+	[[nodiscard]] T* allocate (std::size_t num)
+	{
+		return static_cast<T*> (::operator new (num * sizeof (T), std::align_val_t { Alignment }));
+	}
+
+	void deallocate (T* ptr, std::size_t num) noexcept
+	{
+		::operator delete (ptr, num * sizeof (T), std::align_val_t { Alignment });
+	}
+
+	template <typename U>
+	[[nodiscard]] constexpr bool operator== (const AlignedAllocator<U, Alignment>&) const noexcept
+	{
+		return true;
+	}
+
+	template <typename U>
+	[[nodiscard]] constexpr bool operator!= (const AlignedAllocator<U, Alignment>&) const noexcept
+	{
+		return false;
+	}
+};
+
+}  // namespace detail
+
+/** A contiguous buffer of pitches, designed for analysing large numbers of notes at once.
+
+	A Pitch is a single \c double, so a PitchBuffer stores its MIDI pitches as one contiguous array of doubles, aligned for SIMD loads.
+	The bulk operations below process that array several pitches at a time, and write each derived attribute (%pitch class, octave, key color) into
+	its own caller-provided array, so the results are laid out as a structure of arrays and nothing is allocated per note.
+
+	Every bulk operation gives exactly the same results as calling the corresponding Pitch method on each element in turn.
+	The rounding operations have the same precondition as Pitch::getRoundedMidiPitch(): every MIDI %pitch must be finite and within the range of \c int.
+
+	The elements are ordinary Pitch objects, so the buffer can be iterated, indexed, and viewed as a \c std::span<Pitch> .
+
+	@ingroup limes_harmony
+	@see Pitch
+ */
+class LHARM_EXPORT PitchBuffer final
+{
+public:
+	/** The alignment of the buffer's storage, in bytes. This is one cache line, and is enough for any SIMD instruction set. */
+	static constexpr std::size_t alignment = 64;
+
+	/** The type of container used to store the pitches. */
+	using Storage = std::vector<Pitch, detail::AlignedAllocator<Pitch, alignment>>;
+
+	/** @name Constructors */
+	///@{
+	/** Creates an empty buffer. */
+	PitchBuffer() = default;
+
+	/** Creates a buffer holding the given number of copies of a %pitch. */
+	explicit PitchBuffer (std::size_t numPitches, Pitch initialPitch = Pitch { 60 });
+
+	/** Creates a buffer holding the given pitches. */
+	PitchBuffer (std::initializer_list<Pitch> pitchesToUse);
+
+	/** Creates a buffer holding copies of the given pitches. */
+	explicit PitchBuffer (std::span<const Pitch> pitchesToUse);
+
+	/** Creates a buffer holding pitches with the given MIDI pitches. */
+	explicit PitchBuffer (std::span<const double> midiPitches);
+	///@}
+
+	/** @name Equality comparisons */
+	///@{
+	/** Returns true if the two buffers hold the same pitches in the same order. */
+	[[nodiscard]] bool operator== (const PitchBuffer& other) const noexcept;
+
+	/** Returns true if the two buffers do not hold the same pitches in the same order. */
+	[[nodiscard]] bool operator!= (const PitchBuffer& other) const noexcept;
+	///@}
+
+	/** @name Size */
+	///@{
+	/** Returns the number of pitches in the buffer. */
+	[[nodiscard]] std::size_t size() const noexcept;
+
+	/** Returns true if the buffer holds no pitches. */
+	[[nodiscard]] bool isEmpty() const noexcept;
+
+	/** Preallocates storage for the given number of pitches. */
+	void reserve (std::size_t numPitches);
+
+	/** Changes the number of pitches in the buffer. New elements are set to the given %pitch. */
+	void resize (std::size_t numPitches, Pitch newPitch = Pitch { 60 });
+
+	/** Removes all pitches from the buffer, without freeing its storage. */
+	void clear() noexcept;
+
+	/** Appends a %pitch to the end of the buffer. */
+	void add (Pitch pitch);
+	///@}
+
+	/** @name Element access */
+	///@{
+	/** Returns the %pitch at the given index. */
+	[[nodiscard]] Pitch& operator[] (std::size_t index) noexcept;
+
+	/** Returns the %pitch at the given index. */
+	[[nodiscard]] const Pitch& operator[] (std::size_t index) const noexcept;
+
+	/** Returns a view of all the pitches in the buffer. */
+	[[nodiscard]] std::span<Pitch> getPitches() noexcept;
+
+	/** Returns a view of all the pitches in the buffer. */
+	[[nodiscard]] std::span<const Pitch> getPitches() const noexcept;
+
+	/** Returns a view of the MIDI pitches of all the pitches in the buffer. */
+	[[nodiscard]] std::span<const double> getMidiPitches() const noexcept;
+
+	[[nodiscard]] Pitch*	   begin() noexcept;
+	[[nodiscard]] const Pitch* begin() const noexcept;
+	[[nodiscard]] Pitch*	   end() noexcept;
+	[[nodiscard]] const Pitch* end() const noexcept;
+	///@}
+
+	/** @name Transposition */
+	///@{
+	/** Moves every %pitch in the buffer up by the given number of semitones, or down if the number is negative. */
+	void transpose (double semitones) noexcept;
+
+	/** Moves every %pitch in the buffer up or down by the given %interval.
+		@see Interval::applyToPitch()
+	 */
+	void transpose (const Interval& interval, bool above = true) noexcept;
+
+	/** Moves every %pitch in the buffer up or down by the given compound %interval.
+		@see CompoundInterval::applyToPitch()
+	 */
+	void transpose (const CompoundInterval& interval, bool above = true) noexcept;
+
+	/** Moves every %pitch in the buffer up or down by the given microtonal %interval.
+		@see MicrotonalInterval::applyToPitch()
+	 */
+	void transpose (const MicrotonalInterval& interval, bool above = true) noexcept;
+	///@}
+
+	/** @name Rounding */
+	///@{
+	/** Rounds every %pitch in the buffer to its nearest integer MIDI note.
+		@see Pitch::getRoundedMidiPitch()
+	 */
+	void round() noexcept;
+
+	/** Writes the nearest integer MIDI note of each %pitch into the output array, which must be at least as long as this buffer.
+		@see Pitch::getRoundedMidiPitch()
+	 */
+	void getRoundedMidiPitches (std::span<int> output) const noexcept;
+	///@}
+
+	/** @name Analysis
+		Each of these functions writes one value per %pitch into the output array, which must be at least as long as this buffer.
+	 */
+	///@{
+	/** Writes the %pitch class of each %pitch, as an integer between 0 and 11.
+		@see Pitch::getPitchClass()
+	 */
+	void getPitchClasses (std::span<int> output) const noexcept;
+
+	/** Writes the MIDI octave number of each %pitch.
+		@see Pitch::getOctaveNumber()
+	 */
+	void getOctaveNumbers (std::span<int> output) const noexcept;
+
+	/** Writes true for each %pitch whose nearest integer MIDI note is a black key.
+		@see Pitch::isBlackKey()
+	 */
+	void getBlackKeyFlags (std::span<bool> output) const noexcept;
+
+	/** Writes true for each %pitch whose nearest integer MIDI note is a white key.
+		@see Pitch::isWhiteKey()
+	 */
+	void getWhiteKeyFlags (std::span<bool> output) const noexcept;
+	///@}
+
+private:
+	Storage pitches;
+};
+
+}  // namespace limes::harmony
@@ -0,0 +1,241 @@
+/*
+ * ======================================================================================
+ *  __    ____  __  __  ____  ___
+ * (  )  (_  _)(  \/  )( ___)/ __)
+ *  )(__  _)(_  )    (  )__) \__ \
+ * (____)(____)(_/\/\_)(____)(___/
+ *
+ *  This file is part of the Limes open source library and is licensed under the terms of the GNU Public License.
+ *
+ *  Commercial licenses are available; contact the maintainers at ben.the.vining@gmail.com to inquire for details.
+ *
+ * ======================================================================================
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <functional>
+#include "lharmony/lharmony_Export.h"
+#include "lharmony/lharmony_Pitch.h"
+#include "lharmony/lharmony_PitchClass.h"
+#include "lharmony/lharmony_PitchUtils.h"
+#include "lharmony/lharmony_MicrotonalInterval.h"
+
+/** @file
+	This file defines the PitchCents class.
+
+	@ingroup limes_harmony
+ */
+
+namespace limes::harmony
+{
+
+/** A %pitch stored as a whole number of cents above MIDI note 0.
+
+	Unlike Pitch, which stores a floating-point MIDI %pitch, this class stores a single 32-bit integer, so equality is exact, ordering is an integer comparison, and values can be hashed and used as keys in hash maps without any floating-point surprises.
+	The resolution is one cent; MIDI note 60 is stored as 6000, and a quarter-tone above it as 6050.
+
+	Converting a PitchCents to a Pitch and back is lossless. Converting a Pitch to a PitchCents rounds it to the nearest cent.
+
+	@ingroup limes_harmony
+	@see Pitch, MicrotonalInterval
+ */
+class LHARM_EXPORT PitchCents final
+{
+public:
+	/** The number of cents in one semitone. */
+	static constexpr std::int32_t centsPerSemitone = 100;
+
+	/** The number of cents in one octave. */
+	static constexpr std::int32_t centsPerOctave = centsPerSemitone * semitonesInOctave;
+
+	/** @name Constructors */
+	///@{
+	/** Creates a PitchCents representing middle C (MIDI note 60). */
+	constexpr PitchCents() noexcept = default;
+
+	/** Creates a PitchCents from a number of cents above MIDI note 0. */
+	constexpr explicit PitchCents (std::int32_t centsAboveMidiZero) noexcept
+		: cents (centsAboveMidiZero)
+	{
+	}
+
+	/** Creates a PitchCents from a Pitch, rounding to the nearest cent. */
+	constexpr explicit PitchCents (const Pitch& pitch) noexcept
+		: cents (roundToNearestInt (pitch.getMidiPitch() * static_cast<double> (centsPerSemitone)))
+	{
+	}
+
+	/** Creates a PitchCents from an integer MIDI note. */
+	[[nodiscard]] static constexpr PitchCents fromMidiNote (int midiNote) noexcept
+	{
+		return PitchCents { midiNote * centsPerSemitone };
+	}
+
+	/** Creates a PitchCents from a Pitch, rounding to the nearest cent. */
+	[[nodiscard]] static constexpr PitchCents fromPitch (const Pitch& pitch) noexcept
+	{
+		return PitchCents { pitch };
+	}
+	///@}
+
+	constexpr PitchCents (const PitchCents&) = default;
+	constexpr PitchCents& operator=(const PitchCents&) = default;
+
+	constexpr PitchCents (PitchCents&&) = default;
+	constexpr PitchCents& operator=(PitchCents&&) = default;
+
+	/** @name Comparisons */
+	///@{
+	/** Returns true if the two pitches are exactly equal. */
+	[[nodiscard]] constexpr bool operator== (const PitchCents& other) const noexcept { return cents == other.cents; }
+
+	/** Returns true if the two pitches are not exactly equal. */
+	[[nodiscard]] constexpr bool operator!= (const PitchCents& other) const noexcept { return cents != other.cents; }
+
+	/** Returns true if this %pitch is lower than the other one. */
+	[[nodiscard]] constexpr bool operator<(const PitchCents& other) const noexcept { return cents < other.cents; }
+
+	/** Returns true if this %pitch is higher than the other one. */
+	[[nodiscard]] constexpr bool operator> (const PitchCents& other) const noexcept { return cents > other.cents; }
+
+	/** Returns true if this %pitch is lower than or equal to the other one. */
+	[[nodiscard]] constexpr bool operator<= (const PitchCents& other) const noexcept { return cents <= other.cents; }
+
+	/** Returns true if this %pitch is higher than or equal to the other one. */
+	[[nodiscard]] constexpr bool operator>= (const PitchCents& other) const noexcept { return cents >= other.cents; }
+	///@}
+
+	/** @name Arithmetic */
+	///@{
+	/** Returns a new %pitch this many cents higher than this one. */
+	[[nodiscard]] constexpr PitchCents operator+ (std::int32_t centsToAdd) const noexcept
+	{
+		return PitchCents { cents + centsToAdd };
+	}
+
+	/** Returns a new %pitch this many cents lower than this one. */
+	[[nodiscard]] constexpr PitchCents operator- (std::int32_t centsToSubtract) const noexcept
+	{
+		return PitchCents { cents - centsToSubtract };
+	}
+
+	/** Raises this %pitch by a number of cents. */
+	constexpr PitchCents& operator+= (std::int32_t centsToAdd) noexcept
+	{
+		cents += centsToAdd;
+		return *this;
+	}
+
+	/** Lowers this %pitch by a number of cents. */
+	constexpr PitchCents& operator-= (std::int32_t centsToSubtract) noexcept
+	{
+		cents -= centsToSubtract;
+		return *this;
+	}
+
+	/** Returns the signed distance from the other %pitch to this one, in cents. */
+	[[nodiscard]] constexpr std::int32_t operator- (const PitchCents& other) const noexcept
+	{
+		return cents - other.cents;
+	}
+
+	/** Returns a new %pitch shifted by the given %interval, rounded to the nearest cent. */
+	[[nodiscard]] constexpr PitchCents operator+ (const MicrotonalInterval& interval) const noexcept
+	{
+		return *this + intervalToCents (interval);
+	}
+
+	/** Returns a new %pitch shifted down by the given %interval, rounded to the nearest cent. */
+	[[nodiscard]] constexpr PitchCents operator- (const MicrotonalInterval& interval) const noexcept
+	{
+		return *this - intervalToCents (interval);
+	}
+
+	/** Returns the %interval from the other %pitch to this one. */
+	[[nodiscard]] constexpr MicrotonalInterval intervalFrom (const PitchCents& other) const noexcept
+	{
+		return MicrotonalInterval { static_cast<double> (cents - other.cents) / static_cast<double> (centsPerSemitone) };
+	}
+	///@}
+
+	/** Returns the number of cents above MIDI note 0 that this %pitch represents. */
+	[[nodiscard]] constexpr std::int32_t getCents() const noexcept
+	{
+		return cents;
+	}
+
+	/** Returns this %pitch as a Pitch object. This conversion is exact. */
+	[[nodiscard]] constexpr Pitch toPitch() const noexcept
+	{
+		return Pitch { static_cast<double> (cents) / static_cast<double> (centsPerSemitone) };
+	}
+
+	/** Returns the nearest integer MIDI note to this %pitch.
+		Pitches halfway between two notes are rounded away from zero, the same as Pitch::getRoundedMidiPitch(), so 6050 cents is note 61 and -50 cents is note -1.
+	 */
+	[[nodiscard]] constexpr int getNearestMidiNote() const noexcept
+	{
+		// integer division truncates towards zero, so offsetting by half a semitone away from zero rounds halfway values away from zero
+		if (cents < 0)
+			return (cents - centsPerSemitone / 2) / centsPerSemitone;
+
+		return (cents + centsPerSemitone / 2) / centsPerSemitone;
+	}
+
+	/** Returns the deviation of this %pitch from its nearest MIDI note, in cents, between -50 and 50.
+		Because halfway values are rounded away from zero, the offset is -50 for pitches above MIDI note 0 and 50 for pitches below it.
+	 */
+	[[nodiscard]] constexpr std::int32_t getCentsOffset() const noexcept
+	{
+		return cents - getNearestMidiNote() * centsPerSemitone;
+	}
+
+	/** Returns the %pitch class of the nearest MIDI note to this %pitch. */
+	[[nodiscard]] constexpr PitchClass getPitchClass() const noexcept
+	{
+		return PitchClass { getNearestMidiNote() };
+	}
+
+	/** Returns the MIDI octave number of the nearest MIDI note to this %pitch. */
+	[[nodiscard]] constexpr int getOctaveNumber() const noexcept
+	{
+		return octaveNumberOfMidiNote (getNearestMidiNote());
+	}
+
+	/** Returns true if this %pitch is not exactly on a key of an equal-tempered piano. */
+	[[nodiscard]] constexpr bool isMicrotone() const noexcept
+	{
+		return cents % centsPerSemitone != 0;
+	}
+
+	/** Returns a MicrotonalInterval's size as a whole number of cents, rounded to the nearest cent. */
+	[[nodiscard]] static constexpr std::int32_t intervalToCents (const MicrotonalInterval& interval) noexcept
+	{
+		return roundToNearestInt (interval.getCents());
+	}
+
+private:
+	std::int32_t cents { 60 * centsPerSemitone };
+};
+
+}  // namespace limes::harmony
+
+namespace std
+{
+
+/** A specialization of \c std::hash for PitchCents objects.
+	@ingroup limes_harmony
+ */
+template <>
+struct hash<limes::harmony::PitchCents> final
+{
+	[[nodiscard]] size_t operator() (const limes::harmony::PitchCents& pitch) const noexcept
+	{
+		return hash<std::int32_t> {}(pitch.getCents());
+	}
+};
+
+}  // namespace std
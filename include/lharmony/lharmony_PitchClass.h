@@ -15,13 +15,17 @@
 #pragma once
 
 #include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <ostream>
 #include <string_view>
-#include <iostream>
+#include <utility>
 #include "lharmony/lharmony_Export.h"
 #include "lharmony/lharmony_PitchUtils.h"
 
 /** @file
-	This file defines the PitchClass class.
+	This file defines the BasicPitchClass class and the PitchClass alias.
 
 	@ingroup limes_harmony
  */
@@ -29,111 +33,202 @@
 namespace limes::harmony
 {
 
-/** A struct that represents a %pitch class.
-	This class is agnostic to the octave the %pitch class appears in, and also to enharmonic spellings -- thus, C-sharp and D-flat are considered the same %pitch class.
-	A %pitch class is represented as an integer between 0 and 11, with 0 being C, 1 being C-sharp/D-flat, and 11 being B natural.
+/** A struct that represents a %pitch class in an equal division of the octave.
 
-	Here are all possible %pitch classes:
+	A %pitch class is represented as an integer step number between 0 and <code>EDO - 1</code>, where 0 is C.
+	This class is agnostic to the octave the %pitch class appears in, and also to enharmonic spellings.
 
-	Integer value | Note name
-	------------- | -----------------
-	0             | C
-	1             | C-sharp / D-flat
-	2             | D
-	3             | D-sharp / E-flat
-	4             | E
-	5             | F
-	6             | F-sharp / G-flat
-	7             | G
-	8             | G-sharp / A-flat
-	9             | A
-	10            | A-sharp / B-flat
-	11            | B
+	The template parameter is the number of equal steps in the octave, so <code>BasicPitchClass<31></code> is a 31-EDO %pitch class.
+	Most code uses the PitchClass alias for 12-tone equal temperament; the functions that only make sense for a standard keyboard, such as isBlackKey() and getString(), are only
+	available for 12 divisions of the octave.
 
-	@ingroup limes_harmony
-	@see Pitch
+	@tparam EDO The number of equal divisions of the octave. This must be between 1 and 256, so that each step fits in a single byte.
 
-	@todo to/from string
-	@todo get solfege syllable
-	@todo provide literals?
+	@ingroup limes_harmony
+	@see PitchClass, BasicPitchClassSet
  */
-struct LHARM_EXPORT PitchClass final
+template <int EDO>
+struct BasicPitchClass final
 {
-	/** Creates a %pitch class from an integer, where 0 is C, 1 is C#/Db, and 11 is B.
+	static_assert (EDO > 0 && EDO <= 256, "The number of divisions of the octave must be between 1 and 256");
+
+	/** The number of equal steps in one octave. */
+	static constexpr int stepsPerOctave = EDO;
+
+	/** The number of distinct %pitch classes, as a size. */
+	static constexpr auto numPitchClasses = static_cast<std::size_t> (EDO);
+
+	/** Creates a %pitch class from an integer step number, where 0 is C.
+		Any integer is accepted, including negative numbers; it is wrapped into the range 0 to <code>EDO - 1</code>.
+		In 12-TET, the step number is the same as the MIDI note number.
+		@see pitchClassOfMidiNote()
 	 */
-	constexpr explicit PitchClass (int midiPitch) noexcept
-		: pitchClass (midiPitch % semitonesInOctave)
+	constexpr explicit BasicPitchClass (int stepNumber) noexcept
+		: pitchClass (wrap (stepNumber))
 	{
 	}
 
-	constexpr PitchClass (const PitchClass&) = default;
-	constexpr PitchClass& operator=(const PitchClass&) = default;
+	constexpr BasicPitchClass (const BasicPitchClass&) = default;
+	constexpr BasicPitchClass& operator=(const BasicPitchClass&) = default;
 
-	constexpr PitchClass (PitchClass&&) = default;
-	constexpr PitchClass& operator=(PitchClass&&) = default;
+	constexpr BasicPitchClass (BasicPitchClass&&) = default;
+	constexpr BasicPitchClass& operator=(BasicPitchClass&&) = default;
 
 	/** Returns true if the two %pitch classes are equal. */
-	[[nodiscard]] constexpr bool operator== (const PitchClass& other) const noexcept
+	[[nodiscard]] constexpr bool operator== (const BasicPitchClass& other) const noexcept
 	{
 		return pitchClass == other.pitchClass;
 	}
 
 	/** Returns true if the two %pitch classes are not equal. */
-	[[nodiscard]] constexpr bool operator!= (const PitchClass& other) const noexcept
+	[[nodiscard]] constexpr bool operator!= (const BasicPitchClass& other) const noexcept
 	{
 		return pitchClass != other.pitchClass;
 	}
 
-	constexpr PitchClass& operator+= (int numSemitones) noexcept
+	constexpr BasicPitchClass& operator+= (int numSteps) noexcept
 	{
-		pitchClass = (pitchClass + numSemitones) % semitonesInOctave;
+		pitchClass = wrap (pitchClass + numSteps);
 		return *this;
 	}
 
-	constexpr PitchClass& operator-= (int numSemitones) noexcept
+	constexpr BasicPitchClass& operator-= (int numSteps) noexcept
 	{
-		pitchClass = (pitchClass - numSemitones) % semitonesInOctave;
+		pitchClass = wrap (pitchClass - numSteps);
 		return *this;
 	}
 
 	/** Returns true if this %pitch class represents a black key on a standard keyboard. */
 	[[nodiscard]] constexpr bool isBlackKey() const noexcept
+		requires (EDO == semitonesInOctave)
 	{
 		return pitchClass == 1 || pitchClass == 3 || pitchClass == 6 || pitchClass == 8 || pitchClass == 10;
 	}
 
 	/** Returns true if this %pitch class represents a white key on a standard keyboard. */
 	[[nodiscard]] constexpr bool isWhiteKey() const noexcept
+		requires (EDO == semitonesInOctave)
 	{
 		return ! isBlackKey();
 	}
 
-	/** Returns this %pitch class as an integer between 0 and 11, where 0 is C and 11 is B. */
+	/** Returns this %pitch class as an integer between 0 and <code>EDO - 1</code>, where 0 is C. */
 	constexpr operator int() const noexcept
 	{
 		return pitchClass;
 	}
 
-	/** Returns this %pitch class as an integer between 0 and 11, where 0 is C and 11 is B. */
+	/** Returns this %pitch class as an integer between 0 and <code>EDO - 1</code>, where 0 is C. */
 	[[nodiscard]] constexpr int getAsInt() const noexcept
 	{
 		return pitchClass;
 	}
 
+	/** Returns the size of the %interval from C up to this %pitch class, in cents. */
+	[[nodiscard]] constexpr double getCents() const noexcept
+	{
+		return 1200. * static_cast<double> (pitchClass) / static_cast<double> (EDO);
+	}
+
+	/** @name Packed encodings */
+	///@{
+	/** The number of distinct %pitch classes. Dense indices run from 0 to <code>EDO - 1</code>. */
+	static constexpr std::size_t numDenseIndices = numPitchClasses;
+
+	/** Returns this %pitch class packed into a single byte. This is the same value as getAsInt().
+		@see fromPackedValue()
+	 */
+	[[nodiscard]] constexpr std::uint8_t getPackedValue() const noexcept
+	{
+		return static_cast<std::uint8_t> (pitchClass);
+	}
+
+	/** Recreates a %pitch class from a value returned by getPackedValue(). */
+	[[nodiscard]] static constexpr BasicPitchClass fromPackedValue (std::uint8_t packedValue) noexcept
+	{
+		return BasicPitchClass { static_cast<int> (packedValue) };
+	}
+
+	/** Returns a unique index between 0 and <code>EDO - 1</code> for this %pitch class, which can be used as a perfect hash into an array of size numDenseIndices.
+		@see fromDenseIndex()
+	 */
+	[[nodiscard]] constexpr std::size_t getDenseIndex() const noexcept
+	{
+		return static_cast<std::size_t> (pitchClass);
+	}
+
+	/** Returns the %pitch class with the given dense index. */
+	[[nodiscard]] static constexpr BasicPitchClass fromDenseIndex (std::size_t index) noexcept
+	{
+		return BasicPitchClass { static_cast<int> (index) };
+	}
+	///@}
+
 	/** Returns a string description of this pitch class. */
-	[[nodiscard]] std::string_view getString (bool useSharps = true) const noexcept;
+	[[nodiscard]] constexpr std::string_view getString (bool useSharps = true) const noexcept
+		requires (EDO == semitonesInOctave)
+	{
+		// TODO: could use unicode flat/sharp characters...
+		constexpr std::array<std::string_view, semitonesInOctave> sharpNames { "C", "C#", "D", "D#", "E", "F", "F#", "G", "G#", "A", "A#", "B" };
+		constexpr std::array<std::string_view, semitonesInOctave> flatNames { "C", "Db", "D", "Eb", "E", "F", "Gb", "G", "Ab", "A", "Bb", "B" };
+
+		const auto idx = static_cast<std::size_t> (pitchClass);
 
-	/** Returns an iterable list of all the %pitch classes, starting from 0 and ending with 11. */
-	[[nodiscard]] static constexpr std::array<PitchClass, 12> getAll()
+		if (useSharps)
+			return sharpNames[idx];
+
+		return flatNames[idx];
+	}
+
+	/** Returns an iterable list of all the %pitch classes, starting from 0 and ending with <code>EDO - 1</code>. */
+	[[nodiscard]] static constexpr std::array<BasicPitchClass, numPitchClasses> getAll()
 	{
-		using PC = PitchClass;
-		return { PC { 0 }, PC { 1 }, PC { 2 }, PC { 3 }, PC { 4 }, PC { 5 }, PC { 6 }, PC { 7 }, PC { 8 }, PC { 9 }, PC { 10 }, PC { 11 } };
+		return []<std::size_t... Steps> (std::index_sequence<Steps...>)
+		{
+			return std::array<BasicPitchClass, numPitchClasses> { BasicPitchClass { static_cast<int> (Steps) }... };
+		}(std::make_index_sequence<numPitchClasses> {});
 	}
 
 private:
+	[[nodiscard]] static constexpr int wrap (int stepNumber) noexcept
+	{
+		const auto remainder = stepNumber % EDO;
+
+		return remainder < 0 ? remainder + EDO : remainder;
+	}
+
 	int pitchClass { 0 };
 };
 
+/** A %pitch class in 12-tone equal temperament.
+	This class is agnostic to the octave the %pitch class appears in, and also to enharmonic spellings -- thus, C-sharp and D-flat are considered the same %pitch class.
+	A %pitch class is represented as an integer between 0 and 11, with 0 being C, 1 being C-sharp/D-flat, and 11 being B natural.
+
+	Here are all possible %pitch classes:
+
+	Integer value | Note name
+	------------- | -----------------
+	0             | C
+	1             | C-sharp / D-flat
+	2             | D
+	3             | D-sharp / E-flat
+	4             | E
+	5             | F
+	6             | F-sharp / G-flat
+	7             | G
+	8             | G-sharp / A-flat
+	9             | A
+	10            | A-sharp / B-flat
+	11            | B
+
+	@ingroup limes_harmony
+	@see Pitch, fromChars(), toChars()
+
+	@todo get solfege syllable
+	@todo provide literals?
+ */
+using PitchClass = BasicPitchClass<semitonesInOctave>;
+
 /** Writes a string description of the PitchClass to the output stream.
 
 	@ingroup music_harmony
@@ -142,4 +237,32 @@ struct LHARM_EXPORT PitchClass final
  */
 LHARM_EXPORT std::ostream& operator<< (std::ostream& os, const PitchClass& value);
 
+/** Writes the step number of a %pitch class in any other equal division of the octave to the output stream.
+	@ingroup limes_harmony
+ */
+template <int EDO>
+	requires (EDO != semitonesInOctave)
+std::ostream& operator<< (std::ostream& os, const BasicPitchClass<EDO>& value)
+{
+	os << value.getAsInt();
+	return os;
+}
+
 }  // namespace limes::harmony
+
+namespace std
+{
+
+/** A specialization of \c std::hash for %pitch class objects.
+	@ingroup limes_harmony
+ */
+template <int EDO>
+struct hash<limes::harmony::BasicPitchClass<EDO>> final
+{
+	[[nodiscard]] size_t operator() (const limes::harmony::BasicPitchClass<EDO>& pitchClass) const noexcept
+	{
+		return pitchClass.getDenseIndex();
+	}
+};
+
+}  // namespace std
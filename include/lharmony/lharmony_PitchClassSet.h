@@ -0,0 +1,362 @@
+/*
+ * ======================================================================================
+ *  __    ____  __  __  ____  ___
+ * (  )  (_  _)(  \/  )( ___)/ __)
+ *  )(__  _)(_  )    (  )__) \__ \
+ * (____)(____)(_/\/\_)(____)(___/
+ *
+ *  This file is part of the Limes open source library and is licensed under the terms of the GNU Public License.
+ *
+ *  Commercial licenses are available; contact the maintainers at ben.the.vining@gmail.com to inquire for details.
+ *
+ * ======================================================================================
+ */
+
+#pragma once
+
+#include <bit>
+#include <cstdint>
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <initializer_list>
+#include <type_traits>
+#include "lharmony/lharmony_Export.h"
+#include "lharmony/lharmony_PitchClass.h"
+#include "lharmony/lharmony_PitchUtils.h"
+
+/** @file
+	This file defines the BasicPitchClassSet class and the PitchClassSet alias.
+
+	@ingroup limes_harmony
+ */
+
+namespace limes::harmony
+{
+
+namespace detail
+{
+
+/** The smallest unsigned integer type with at least the given number of bits, up to 64. */
+template <int NumBits>
+using SmallestMask = std::conditional_t<(NumBits <= 16), std::uint16_t, std::conditional_t<(NumBits <= 32), std::uint32_t, std::uint64_t>>;
+
+}  // namespace detail
+
+/** A set of %pitch classes in an equal division of the octave, stored as a bitmask.
+
+	Bit \c n of the mask is set if the %pitch class with step number \c n is present in the set, so C is the least significant bit.
+	The mask is the smallest unsigned integer type with at least \c EDO bits, so a 12-TET set is 16 bits wide and a 53-EDO set is 64 bits wide.
+	Because the whole set fits in a single integer, membership tests, unions and intersections are single bitwise operations and never allocate,
+	in any tuning.
+
+	Iterating over a set yields its %pitch classes in ascending order, starting from C.
+
+	@tparam EDO The number of equal divisions of the octave. This must be between 1 and 64.
+
+	@ingroup limes_harmony
+	@see BasicPitchClass, PitchClassSet
+ */
+template <int EDO>
+class BasicPitchClassSet final
+{
+public:
+	static_assert (EDO > 0 && EDO <= 64, "Pitch class sets support up to 64 divisions of the octave");
+
+	/** The type of %pitch class stored in the set. */
+	using PitchClassType = BasicPitchClass<EDO>;
+
+	/** The underlying integer type used to store the set. */
+	using Mask = detail::SmallestMask<EDO>;
+
+	/** A mask with all \c EDO %pitch class bits set. */
+	static constexpr Mask allPitchClassesMask = static_cast<Mask> (std::numeric_limits<Mask>::max() >> (std::numeric_limits<Mask>::digits - EDO));
+
+	/** @name Constructors */
+	///@{
+	/** Creates an empty set. */
+	constexpr BasicPitchClassSet() noexcept = default;
+
+	/** Creates a set containing the given %pitch classes. */
+	constexpr BasicPitchClassSet (std::initializer_list<PitchClassType> pitchClasses) noexcept
+	{
+		for (const auto pc : pitchClasses)
+			add (pc);
+	}
+
+	/** Creates a set from a raw bitmask, where bit 0 is C and bit <code>EDO - 1</code> is the highest %pitch class.
+		Any bits above bit <code>EDO - 1</code> are ignored.
+	 */
+	[[nodiscard]] static constexpr BasicPitchClassSet fromMask (Mask mask) noexcept
+	{
+		BasicPitchClassSet set;
+		set.bits = static_cast<Mask> (mask & allPitchClassesMask);
+		return set;
+	}
+
+	/** Returns a set containing all \c EDO %pitch classes. */
+	[[nodiscard]] static constexpr BasicPitchClassSet all() noexcept
+	{
+		return fromMask (allPitchClassesMask);
+	}
+	///@}
+
+	constexpr BasicPitchClassSet (const BasicPitchClassSet&) = default;
+	constexpr BasicPitchClassSet& operator=(const BasicPitchClassSet&) = default;
+
+	constexpr BasicPitchClassSet (BasicPitchClassSet&&) = default;
+	constexpr BasicPitchClassSet& operator=(BasicPitchClassSet&&) = default;
+
+	/** @name Equality comparisons */
+	///@{
+	/** Returns true if the two sets contain exactly the same %pitch classes. */
+	[[nodiscard]] constexpr bool operator== (const BasicPitchClassSet& other) const noexcept
+	{
+		return bits == other.bits;
+	}
+
+	/** Returns true if the two sets do not contain exactly the same %pitch classes. */
+	[[nodiscard]] constexpr bool operator!= (const BasicPitchClassSet& other) const noexcept
+	{
+		return bits != other.bits;
+	}
+	///@}
+
+	/** @name Modification */
+	///@{
+	/** Adds a %pitch class to the set. Adding a %pitch class that is already present does nothing. */
+	constexpr BasicPitchClassSet& add (PitchClassType pitchClass) noexcept
+	{
+		bits = static_cast<Mask> (bits | bitFor (pitchClass));
+		return *this;
+	}
+
+	/** Removes a %pitch class from the set. Removing a %pitch class that is not present does nothing. */
+	constexpr BasicPitchClassSet& remove (PitchClassType pitchClass) noexcept
+	{
+		bits = static_cast<Mask> (bits & ~bitFor (pitchClass));
+		return *this;
+	}
+
+	/** Removes all %pitch classes from the set. */
+	constexpr void clear() noexcept
+	{
+		bits = 0;
+	}
+	///@}
+
+	/** @name Queries */
+	///@{
+	/** Returns true if the set contains the given %pitch class. */
+	[[nodiscard]] constexpr bool contains (PitchClassType pitchClass) const noexcept
+	{
+		return (bits & bitFor (pitchClass)) != 0;
+	}
+
+	/** Returns true if every %pitch class in the other set is also in this one. */
+	[[nodiscard]] constexpr bool containsAll (const BasicPitchClassSet& other) const noexcept
+	{
+		return (bits & other.bits) == other.bits;
+	}
+
+	/** Returns true if this set and the other one have at least one %pitch class in common. */
+	[[nodiscard]] constexpr bool intersects (const BasicPitchClassSet& other) const noexcept
+	{
+		return (bits & other.bits) != 0;
+	}
+
+	/** Returns true if this set contains no %pitch classes. */
+	[[nodiscard]] constexpr bool isEmpty() const noexcept
+	{
+		return bits == 0;
+	}
+
+	/** Returns the number of %pitch classes in this set. */
+	[[nodiscard]] constexpr int size() const noexcept
+	{
+		return std::popcount (bits);
+	}
+
+	/** Returns the raw bitmask of this set, where bit 0 is C and bit <code>EDO - 1</code> is the highest %pitch class. */
+	[[nodiscard]] constexpr Mask getMask() const noexcept
+	{
+		return bits;
+	}
+	///@}
+
+	/** @name Set operations */
+	///@{
+	/** Returns the union of this set and the other one. */
+	[[nodiscard]] constexpr BasicPitchClassSet operator| (const BasicPitchClassSet& other) const noexcept
+	{
+		return fromMask (static_cast<Mask> (bits | other.bits));
+	}
+
+	/** Returns the intersection of this set and the other one. */
+	[[nodiscard]] constexpr BasicPitchClassSet operator& (const BasicPitchClassSet& other) const noexcept
+	{
+		return fromMask (static_cast<Mask> (bits & other.bits));
+	}
+
+	/** Returns the symmetric difference of this set and the other one. */
+	[[nodiscard]] constexpr BasicPitchClassSet operator^ (const BasicPitchClassSet& other) const noexcept
+	{
+		return fromMask (static_cast<Mask> (bits ^ other.bits));
+	}
+
+	/** Returns the %pitch classes in this set that are not in the other one. */
+	[[nodiscard]] constexpr BasicPitchClassSet operator- (const BasicPitchClassSet& other) const noexcept
+	{
+		return fromMask (static_cast<Mask> (bits & ~other.bits));
+	}
+
+	/** Returns the complement of this set -- that is, all the %pitch classes not in this set. */
+	[[nodiscard]] constexpr BasicPitchClassSet operator~() const noexcept
+	{
+		return fromMask (static_cast<Mask> (~bits));
+	}
+
+	/** Replaces this set with its union with the other one. */
+	constexpr BasicPitchClassSet& operator|= (const BasicPitchClassSet& other) noexcept
+	{
+		bits = static_cast<Mask> (bits | other.bits);
+		return *this;
+	}
+
+	/** Replaces this set with its intersection with the other one. */
+	constexpr BasicPitchClassSet& operator&= (const BasicPitchClassSet& other) noexcept
+	{
+		bits = static_cast<Mask> (bits & other.bits);
+		return *this;
+	}
+
+	/** Replaces this set with its symmetric difference with the other one. */
+	constexpr BasicPitchClassSet& operator^= (const BasicPitchClassSet& other) noexcept
+	{
+		bits = static_cast<Mask> (bits ^ other.bits);
+		return *this;
+	}
+
+	/** Removes the other set's %pitch classes from this one. */
+	constexpr BasicPitchClassSet& operator-= (const BasicPitchClassSet& other) noexcept
+	{
+		bits = static_cast<Mask> (bits & ~other.bits);
+		return *this;
+	}
+	///@}
+
+	/** Returns a copy of this set with every %pitch class transposed by the given number of steps.
+		This is a rotation of the \c EDO -bit mask, so transposing by \c EDO (or any multiple of it) returns an identical set. Negative values transpose downwards.
+	 */
+	[[nodiscard]] constexpr BasicPitchClassSet transposed (int steps) const noexcept
+	{
+		const auto shift = static_cast<unsigned> (((steps % EDO) + EDO) % EDO);
+
+		if (shift == 0)
+			return *this;
+
+		const auto wide = static_cast<Wide> (bits);
+
+		return fromMask (static_cast<Mask> ((wide << shift) | (wide >> (static_cast<unsigned> (EDO) - shift))));
+	}
+
+	/** Returns the lowest %pitch class in this set, counting upwards from C.
+		The set must not be empty.
+	 */
+	[[nodiscard]] constexpr PitchClassType getLowest() const noexcept
+	{
+		return PitchClassType { std::countr_zero (bits) };
+	}
+
+	/** Returns the highest %pitch class in this set, counting upwards from C.
+		The set must not be empty.
+	 */
+	[[nodiscard]] constexpr PitchClassType getHighest() const noexcept
+	{
+		return PitchClassType { static_cast<int> (std::bit_width (bits)) - 1 };
+	}
+
+	/** A forward iterator over the %pitch classes in a set, in ascending order. */
+	class Iterator final
+	{
+	public:
+		using iterator_category = std::forward_iterator_tag;
+		using value_type		= PitchClassType;
+		using difference_type	= std::ptrdiff_t;
+		using pointer			= void;
+		using reference			= PitchClassType;
+
+		constexpr Iterator() noexcept = default;
+
+		constexpr explicit Iterator (Mask remainingBits) noexcept
+			: remaining (remainingBits)
+		{
+		}
+
+		[[nodiscard]] constexpr PitchClassType operator*() const noexcept
+		{
+			return PitchClassType { std::countr_zero (remaining) };
+		}
+
+		constexpr Iterator& operator++() noexcept
+		{
+			// clear the lowest set bit
+			remaining = static_cast<Mask> (remaining & (remaining - 1U));
+			return *this;
+		}
+
+		constexpr Iterator operator++ (int) noexcept
+		{
+			auto copy = *this;
+			++(*this);
+			return copy;
+		}
+
+		[[nodiscard]] constexpr bool operator== (const Iterator& other) const noexcept
+		{
+			return remaining == other.remaining;
+		}
+
+		[[nodiscard]] constexpr bool operator!= (const Iterator& other) const noexcept
+		{
+			return remaining != other.remaining;
+		}
+
+	private:
+		Mask remaining { 0 };
+	};
+
+	/** Returns an iterator to the lowest %pitch class in the set. */
+	[[nodiscard]] constexpr Iterator begin() const noexcept
+	{
+		return Iterator { bits };
+	}
+
+	/** Returns an iterator past the highest %pitch class in the set. */
+	[[nodiscard]] constexpr Iterator end() const noexcept
+	{
+		return Iterator {};
+	}
+
+private:
+	// the mask type, promoted to at least unsigned int so that shifts don't overflow
+	using Wide = std::common_type_t<Mask, unsigned>;
+
+	[[nodiscard]] static constexpr Mask bitFor (PitchClassType pitchClass) noexcept
+	{
+		return static_cast<Mask> (Wide { 1 } << static_cast<unsigned> (pitchClass.getAsInt()));
+	}
+
+	Mask bits { 0 };
+};
+
+/** A set of %pitch classes in 12-tone equal temperament, stored as a 12-bit mask.
+
+	Bit \c n of the mask is set if the %pitch class \c n is present in the set, so C is the least significant bit and B is bit 11.
+
+	@ingroup limes_harmony
+	@see PitchClass, scales::Scale::getPitchClassSet(), Chord::getPitchClassSet()
+ */
+using PitchClassSet = BasicPitchClassSet<semitonesInOctave>;
+
+}  // namespace limes::harmony
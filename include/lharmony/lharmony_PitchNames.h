@@ -0,0 +1,199 @@
+/*
+ * ======================================================================================
+ *  __    ____  __  __  ____  ___
+ * (  )  (_  _)(  \/  )( ___)/ __)
+ *  )(__  _)(_  )    (  )__) \__ \
+ * (____)(____)(_/\/\_)(____)(___/
+ *
+ *  This file is part of the Limes open source library and is licensed under the terms of the GNU Public License.
+ *
+ *  Commercial licenses are available; contact the maintainers at ben.the.vining@gmail.com to inquire for details.
+ *
+ * ======================================================================================
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <cstddef>
+#include <version>
+#include "lharmony/lharmony_Export.h"
+#include "lharmony/lharmony_Pitch.h"
+#include "lharmony/lharmony_PitchClass.h"
+#include "lharmony/lharmony_PitchSpelling.h"
+
+#ifdef __cpp_lib_format
+#	include <format>
+#endif
+
+/** @file
+	This file defines functions for converting pitches, %pitch classes and spellings to and from their names, such as "C#4", "Bb-1" or "A4+25c".
+
+	These functions follow the conventions of \c std::from_chars() and \c std::to_chars() : they work on caller-provided character ranges,
+	never allocate, never throw, and report errors through the \c ec member of their result.
+
+	@ingroup limes_harmony
+ */
+
+namespace limes::harmony
+{
+
+/** An upper bound on the length of the names that toChars() writes for a Pitch, such as "Cbb-178956971-50c".
+	A buffer of this many characters is always large enough.
+	@ingroup limes_harmony
+ */
+inline constexpr std::size_t maxPitchNameLength = 18;
+
+/** @name Parsing
+	Each of these functions parses the longest name at the start of the range <code>[first, last)</code> .
+	Letter names may be upper or lower case, and are followed by up to two sharps (\c # ) or flats (\c b ); \c x is also accepted as a double sharp.
+	Leading whitespace is not skipped.
+
+	On success, the returned \c ptr points to the first character that is not part of the name, and \c ec is value-initialized.
+	If no name could be parsed, \c ptr is \c first , \c ec is \c std::errc::invalid_argument , and the output value is not modified.
+ */
+///@{
+
+/** Parses a spelling such as "C", "F#", "Bb", "Ex" or "Dbb".
+	@ingroup limes_harmony
+ */
+LHARM_EXPORT std::from_chars_result fromChars (const char* first, const char* last, PitchSpelling& value) noexcept;
+
+/** Parses a %pitch class name such as "C", "F#", "Bb" or "B#". Enharmonic spellings parse to the same %pitch class.
+	@ingroup limes_harmony
+ */
+LHARM_EXPORT std::from_chars_result fromChars (const char* first, const char* last, PitchClass& value) noexcept;
+
+/** Parses a %pitch in scientific %pitch notation, such as "C4", "C#4", "Bb-1" or "B#3".
+	The octave number is required, and middle C is C4. The octave is written as in PitchSpelling::getOctaveNumber(), so "B#3" and "C4" are both MIDI note 60.
+	The name may be followed by a signed offset in cents, such as "A4+25c" or "Eb2-12.5c"; if the characters after the octave are not a valid offset,
+	they are not part of the name. If the octave number or the resulting MIDI note does not fit in an \c int , \c ec is \c std::errc::result_out_of_range .
+	@ingroup limes_harmony
+ */
+LHARM_EXPORT std::from_chars_result fromChars (const char* first, const char* last, Pitch& value) noexcept;
+
+///@}
+
+/** @name Formatting
+	Each of these functions writes a name into the range <code>[first, last)</code> , without a null terminator.
+
+	On success, the returned \c ptr points one past the last character written, and \c ec is value-initialized.
+	If the range is too small, \c ptr is \c last , \c ec is \c std::errc::value_too_large , and the contents of the range are unspecified.
+ */
+///@{
+
+/** Writes a spelling, such as "F#" or "Dbb".
+	@ingroup limes_harmony
+	@see PitchSpelling::getString()
+ */
+LHARM_EXPORT std::to_chars_result toChars (char* first, char* last, const PitchSpelling& value) noexcept;
+
+/** Writes a %pitch class name, spelled with sharps or flats.
+	@ingroup limes_harmony
+	@see PitchClass::getString()
+ */
+LHARM_EXPORT std::to_chars_result toChars (char* first, char* last, const PitchClass& value, bool useSharps = true) noexcept;
+
+/** Writes a %pitch in scientific %pitch notation, spelled with sharps or flats, such as "C#4" or "Bb-1".
+	Microtones are written as their nearest MIDI note followed by an offset rounded to the nearest cent, such as "A4+25c".
+	No offset is written if it rounds to zero.
+	@ingroup limes_harmony
+ */
+LHARM_EXPORT std::to_chars_result toChars (char* first, char* last, const Pitch& value, bool useSharps = true) noexcept;
+
+/** Writes a %pitch in scientific %pitch notation, spelled as in the speller's key, such as "E#4" in C# major.
+	The octave is the written octave of the spelling, so MIDI note 60 spelled as B# is written "B#3".
+	@ingroup limes_harmony
+	@see PitchSpeller::spell()
+ */
+LHARM_EXPORT std::to_chars_result toChars (char* first, char* last, const Pitch& value, const PitchSpeller& speller) noexcept;
+
+///@}
+
+}  // namespace limes::harmony
+
+#ifdef __cpp_lib_format
+
+namespace limes::harmony::detail
+{
+
+/** Implements \c std::formatter for the types that toChars() accepts.
+	The format specification may be empty, or \c # to spell with sharps (the default), or \c b to spell with flats.
+ */
+template <typename T, bool AcceptsSpelling>
+struct NameFormatter
+{
+	constexpr auto parse (std::format_parse_context& ctx)
+	{
+		auto it = ctx.begin();
+
+		if constexpr (AcceptsSpelling)
+		{
+			if (it != ctx.end() && (*it == '#' || *it == 'b'))
+			{
+				useSharps = *it == '#';
+				++it;
+			}
+		}
+
+		if (it != ctx.end() && *it != '}')
+			throw std::format_error ("Invalid format specification for a pitch name");
+
+		return it;
+	}
+
+	template <typename FormatContext>
+	auto format (const T& value, FormatContext& ctx) const
+	{
+		std::array<char, maxPitchNameLength> buffer;
+
+		const auto result = [this, &value, &buffer]
+		{
+			if constexpr (AcceptsSpelling)
+				return toChars (buffer.data(), buffer.data() + buffer.size(), value, useSharps);
+			else
+				return toChars (buffer.data(), buffer.data() + buffer.size(), value);
+		}();
+
+		return std::copy (buffer.data(), result.ptr, ctx.out());
+	}
+
+	bool useSharps { true };
+};
+
+}  // namespace limes::harmony::detail
+
+namespace std
+{
+
+/** A specialization of \c std::formatter for Pitch objects, which writes the same names as toChars().
+	Use <code>{:b}</code> to spell with flats.
+	@ingroup limes_harmony
+ */
+template <>
+struct formatter<limes::harmony::Pitch, char> final : limes::harmony::detail::NameFormatter<limes::harmony::Pitch, true>
+{
+};
+
+/** A specialization of \c std::formatter for PitchClass objects, which writes the same names as toChars().
+	Use <code>{:b}</code> to spell with flats.
+	@ingroup limes_harmony
+ */
+template <>
+struct formatter<limes::harmony::PitchClass, char> final : limes::harmony::detail::NameFormatter<limes::harmony::PitchClass, true>
+{
+};
+
+/** A specialization of \c std::formatter for PitchSpelling objects, which writes the same names as toChars().
+	@ingroup limes_harmony
+ */
+template <>
+struct formatter<limes::harmony::PitchSpelling, char> final : limes::harmony::detail::NameFormatter<limes::harmony::PitchSpelling, false>
+{
+};
+
+}  // namespace std
+
+#endif
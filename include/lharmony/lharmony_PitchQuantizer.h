@@ -0,0 +1,127 @@
+/*
+ * ======================================================================================
+ *  __    ____  __  __  ____  ___
+ * (  )  (_  _)(  \/  )( ___)/ __)
+ *  )(__  _)(_  )    (  )__) \__ \
+ * (____)(____)(_/\/\_)(____)(___/
+ *
+ *  This file is part of the Limes open source library and is licensed under the terms of the GNU Public License.
+ *
+ *  Commercial licenses are available; contact the maintainers at ben.the.vining@gmail.com to inquire for details.
+ *
+ * ======================================================================================
+ */
+
+#pragma once
+
+#include <array>
+#include <span>
+#include "lharmony/lharmony_Export.h"
+#include "lharmony/lharmony_Pitch.h"
+#include "lharmony/lharmony_PitchBuffer.h"
+#include "lharmony/lharmony_PitchClassSet.h"
+#include "lharmony/lharmony_PitchUtils.h"
+#include "lharmony/lharmony_Scale.h"
+
+/** @file
+	This file defines the PitchQuantizer class.
+
+	@ingroup limes_harmony
+ */
+
+namespace limes::harmony
+{
+
+/** Snaps microtonal pitches to a grid, such as the steps of an equal division of the octave or the notes of a scale.
+
+	A quantizer either rounds to the nearest step of an equal division of the octave, where step 0 is C, or to the nearest note whose %pitch class is in a set.
+	Values exactly halfway between two targets are quantized upwards.
+
+	The batch functions take spans of fractional MIDI pitches and write the quantized pitches, and optionally each input's deviation from its quantized %pitch in cents.
+	They process several pitches at a time with SIMD instructions where available, never allocate, and give exactly the same results as quantize(double).
+	Every MIDI %pitch must be finite, with a magnitude less than 2^50.
+
+	To stop a slowly varying %pitch from flipping between two targets every frame when it sits near the boundary between them, quantizeWithHysteresis() only moves
+	away from the previous frame's target once the new target is nearer to the input by more than the hysteresis amount.
+
+	@ingroup limes_harmony
+	@see Pitch::isMicrotone(), BasicPitchClass
+ */
+class LHARM_EXPORT PitchQuantizer final
+{
+public:
+	/** @name Constructors */
+	///@{
+	/** Creates a quantizer that rounds to the nearest step of an equal division of the octave.
+		The default of 12 rounds to the nearest semitone.
+		@param divisionsOfOctave The number of equal steps in an octave. This must be greater than 0.
+	 */
+	explicit PitchQuantizer (int divisionsOfOctave = semitonesInOctave) noexcept;
+
+	/** Creates a quantizer that rounds to the nearest note with one of the given %pitch classes. The set must not be empty. */
+	explicit PitchQuantizer (const PitchClassSet& pitchClasses) noexcept;
+
+	/** Creates a quantizer that rounds to the nearest note of the given scale. */
+	explicit PitchQuantizer (const scales::Scale& scale);
+	///@}
+
+	/** @name Hysteresis */
+	///@{
+	/** Sets the hysteresis used by quantizeWithHysteresis(), in cents. This must not be negative. The default is 0. */
+	void setHysteresis (double cents) noexcept;
+
+	/** Returns the hysteresis used by quantizeWithHysteresis(), in cents. */
+	[[nodiscard]] double getHysteresis() const noexcept;
+	///@}
+
+	/** @name Single pitches */
+	///@{
+	/** Returns the nearest target to a MIDI %pitch. */
+	[[nodiscard]] double quantize (double midiPitch) const noexcept;
+
+	/** Returns the nearest target to a %pitch. */
+	[[nodiscard]] Pitch quantize (Pitch pitch) const noexcept;
+	///@}
+
+	/** @name Batches
+		Each of these functions writes one value per input %pitch into each output array, which must be at least as long as the input.
+		If the array of deviations is empty, no deviations are written. Each deviation is the input minus its quantized %pitch, in cents,
+		so a positive deviation means that the input was sharp.
+	 */
+	///@{
+	/** Quantizes each MIDI %pitch to its nearest target. */
+	void quantize (std::span<const double> midiPitches, std::span<double> quantizedPitches, std::span<double> deviationsInCents = {}) const noexcept;
+
+	/** Quantizes every %pitch in a buffer in place. */
+	void quantize (PitchBuffer& pitches, std::span<double> deviationsInCents = {}) const noexcept;
+
+	/** Quantizes each MIDI %pitch, keeping the previous frame's target unless a new target is nearer by more than the hysteresis.
+		Each input is treated as a separate voice, so this is called once per frame with the same arrays of quantized pitches.
+		@param midiPitches The current frame's MIDI pitches.
+		@param quantizedPitches On input, the previous frame's quantized pitches; on output, this frame's. Set an element to NaN to quantize that voice without hysteresis,
+		for example on its first frame.
+		@param deviationsInCents If not empty, receives each input's deviation from its quantized %pitch.
+	 */
+	void quantizeWithHysteresis (std::span<const double> midiPitches, std::span<double> quantizedPitches, std::span<double> deviationsInCents = {}) const noexcept;
+	///@}
+
+private:
+	// the nearest scale target to each half-semitone cell of the octave, in semitones above the octave's C
+	using ScaleTable = std::array<double, 2 * semitonesInOctave>;
+
+	template <bool UseScale, bool UseHysteresis>
+	void process (const double* input, double* output, double* deviations, std::size_t num) const noexcept;
+
+	template <bool UseScale>
+	[[nodiscard]] double getNearestTarget (double midiPitch) const noexcept;
+
+	double stepsPerSemitone { 1. }, semitonesPerStep { 1. };
+
+	ScaleTable scaleTargets {};
+
+	bool usesScale { false };
+
+	double hysteresisSemitones { 0. };
+};
+
+}  // namespace limes::harmony
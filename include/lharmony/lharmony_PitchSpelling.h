@@ -0,0 +1,347 @@
+/*
+ * ======================================================================================
+ *  __    ____  __  __  ____  ___
+ * (  )  (_  _)(  \/  )( ___)/ __)
+ *  )(__  _)(_  )    (  )__) \__ \
+ * (____)(____)(_/\/\_)(____)(___/
+ *
+ *  This file is part of the Limes open source library and is licensed under the terms of the GNU Public License.
+ *
+ *  Commercial licenses are available; contact the maintainers at ben.the.vining@gmail.com to inquire for details.
+ *
+ * ======================================================================================
+ */
+
+#pragma once
+
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <span>
+#include <string_view>
+#include "lharmony/lharmony_Export.h"
+#include "lharmony/lharmony_Pitch.h"
+#include "lharmony/lharmony_PitchBuffer.h"
+#include "lharmony/lharmony_PitchClass.h"
+#include "lharmony/lharmony_PitchUtils.h"
+#include "lharmony/lharmony_KeySignature.h"
+#include "lharmony/lharmony_Mode.h"
+
+/** @file
+	This file defines the PitchSpelling and PitchSpeller classes.
+
+	@ingroup limes_harmony
+ */
+
+namespace limes::harmony
+{
+
+/** A way of writing a %pitch class: a letter name plus a number of sharps or flats.
+
+	Unlike PitchClass, which only knows which key of the keyboard a note is, a spelling distinguishes enharmonic equivalents such as F# and Gb, or E# and F.
+	Spellings with up to two sharps or flats are supported.
+
+	@ingroup limes_harmony
+	@see PitchSpeller, PitchClass
+ */
+class LHARM_EXPORT PitchSpelling final
+{
+public:
+	/** The seven letter names. */
+	enum class Letter : std::uint8_t
+	{
+		C,
+		D,
+		E,
+		F,
+		G,
+		A,
+		B
+	};
+
+	/** The largest number of sharps or flats a spelling can have. */
+	static constexpr int maxAccidentals = 2;
+
+	/** @name Constructors */
+	///@{
+	/** Creates a spelling representing C natural. */
+	constexpr PitchSpelling() noexcept = default;
+
+	/** Creates a spelling from a letter name and a number of accidentals.
+		@param letterToUse The letter name.
+		@param accidentalsToUse The number of sharps, or the negated number of flats. This must be between -2 and 2.
+	 */
+	constexpr PitchSpelling (Letter letterToUse, int accidentalsToUse) noexcept
+		: letter (letterToUse), accidentals (static_cast<std::int8_t> (accidentalsToUse))
+	{
+		assert (accidentalsToUse >= -maxAccidentals && accidentalsToUse <= maxAccidentals);
+	}
+
+	/** Returns the spelling at a position on the line of fifths, where 0 is C, 1 is G, -1 is F, 7 is C# and -7 is Cb.
+		The position must be between -15 (Fbb) and 19 (B##).
+	 */
+	[[nodiscard]] static constexpr PitchSpelling fromLineOfFifths (int position) noexcept
+	{
+		// the naturals are F C G D A E B, at positions -1 to 5; every 7 steps further adds a sharp or a flat
+		constexpr std::array<Letter, 7> letters { Letter::F, Letter::C, Letter::G, Letter::D, Letter::A, Letter::E, Letter::B };
+
+		const auto shifted	 = position + 1 + 7 * (maxAccidentals + 1);
+		const auto numSevens = shifted / 7;
+
+		return PitchSpelling { letters[static_cast<std::size_t> (shifted - numSevens * 7)], numSevens - (maxAccidentals + 1) };
+	}
+	///@}
+
+	/** @name Equality comparisons */
+	///@{
+	/** Returns true if the two spellings have the same letter and accidentals. Enharmonic spellings are not equal. */
+	[[nodiscard]] constexpr bool operator== (const PitchSpelling& other) const noexcept
+	{
+		return letter == other.letter && accidentals == other.accidentals;
+	}
+
+	/** Returns true if the two spellings have a different letter or different accidentals. */
+	[[nodiscard]] constexpr bool operator!= (const PitchSpelling& other) const noexcept
+	{
+		return ! (*this == other);
+	}
+	///@}
+
+	/** Returns the letter name of this spelling. */
+	[[nodiscard]] constexpr Letter getLetter() const noexcept
+	{
+		return letter;
+	}
+
+	/** Returns the number of sharps in this spelling, or the negated number of flats. */
+	[[nodiscard]] constexpr int getAccidentals() const noexcept
+	{
+		return accidentals;
+	}
+
+	/** Returns the %pitch class that this spelling represents. */
+	[[nodiscard]] constexpr PitchClass getPitchClass() const noexcept
+	{
+		return PitchClass { pitchClassOfMidiNote (getUnwrappedPitchClass()) };
+	}
+
+	/** Returns the written octave number of a MIDI note with this spelling.
+		This is usually the same as octaveNumberOfMidiNote(), but notes spelled across the boundary between B and C are written in the neighboring octave:
+		MIDI note 60 spelled as B# is written B#3, and MIDI note 59 spelled as Cb is written Cb4.
+		@param midiNote A MIDI note whose %pitch class is this spelling's %pitch class.
+	 */
+	[[nodiscard]] constexpr int getOctaveNumber (int midiNote) const noexcept
+	{
+		assert (pitchClassOfMidiNote (midiNote) == getPitchClass().getAsInt());
+
+		const auto unwrapped = getUnwrappedPitchClass();
+
+		if (unwrapped < 0)
+			return octaveNumberOfMidiNote (midiNote) + 1;
+
+		if (unwrapped >= semitonesInOctave)
+			return octaveNumberOfMidiNote (midiNote) - 1;
+
+		return octaveNumberOfMidiNote (midiNote);
+	}
+
+	/** Returns the MIDI note of this spelling written in the given octave. This is the inverse of getOctaveNumber(), so B#3 is MIDI note 60 and Cb4 is MIDI note 59. */
+	[[nodiscard]] constexpr int getMidiNote (int writtenOctave) const noexcept
+	{
+		return lowestNoteOfMidiOctave (writtenOctave) + getUnwrappedPitchClass();
+	}
+
+	/** Returns a string such as "C", "F#", "Bb", "E##" or "Dbb". */
+	[[nodiscard]] constexpr std::string_view getString() const noexcept
+	{
+		constexpr std::array<std::string_view, 7 * (2 * maxAccidentals + 1)> names {
+			"Cbb", "Cb", "C", "C#", "C##",
+			"Dbb", "Db", "D", "D#", "D##",
+			"Ebb", "Eb", "E", "E#", "E##",
+			"Fbb", "Fb", "F", "F#", "F##",
+			"Gbb", "Gb", "G", "G#", "G##",
+			"Abb", "Ab", "A", "A#", "A##",
+			"Bbb", "Bb", "B", "B#", "B##"
+		};
+
+		return names[static_cast<std::size_t> (letter) * (2 * maxAccidentals + 1) + static_cast<std::size_t> (accidentals + maxAccidentals)];
+	}
+
+private:
+	// the pitch class of the natural letter plus the accidentals, which may be outside the range 0 to 11
+	[[nodiscard]] constexpr int getUnwrappedPitchClass() const noexcept
+	{
+		constexpr std::array<int, 7> naturals { 0, 2, 4, 5, 7, 9, 11 };
+
+		return naturals[static_cast<std::size_t> (letter)] + accidentals;
+	}
+
+	Letter letter { Letter::C };
+
+	std::int8_t accidentals { 0 };
+};
+
+/** Writes the string representation of a spelling to an output stream.
+	@ingroup limes_harmony
+	@see PitchSpelling::getString()
+ */
+LHARM_EXPORT std::ostream& operator<< (std::ostream& os, const PitchSpelling& spelling);
+
+
+namespace detail
+{
+
+/** The spellings of the 12 %pitch classes in one key, indexed by %pitch class. */
+using PitchClassSpellings = std::array<PitchSpelling, semitonesInOctave>;
+
+// Every key spells its pitch classes with a window of 12 consecutive positions on the line of fifths.
+// The window runs from 5 fifths below the tonic to 6 fifths above it, which is the harmonic chromatic scale: b2, b3, #4, b6 and b7 outside a major key,
+// and b2, #3, #4, #6 and #7 outside a natural minor key. Locrian modes move the window down by one fifth, to spell their fifth as b5.
+
+inline constexpr int minLowestFifth = -12;
+inline constexpr int maxLowestFifth = 5;
+
+inline constexpr auto spellingsByLowestFifth = []
+{
+	std::array<PitchClassSpellings, maxLowestFifth - minLowestFifth + 1> table {};
+
+	for (auto row = 0UL; row < table.size(); ++row)
+	{
+		const auto lowest = static_cast<int> (row) + minLowestFifth;
+
+		for (auto position = lowest; position < lowest + semitonesInOctave; ++position)
+		{
+			const auto spelling = PitchSpelling::fromLineOfFifths (position);
+
+			table[row][static_cast<std::size_t> (spelling.getPitchClass().getAsInt())] = spelling;
+		}
+	}
+
+	return table;
+}();
+
+// indexed by KeySignature::getDenseIndex()
+inline constexpr auto keySignatureLowestFifths = []
+{
+	std::array<std::int8_t, scales::KeySignature::numDenseIndices> table {};
+
+	for (auto index = 0UL; index < table.size(); ++index)
+	{
+		const auto isMinor		  = index / 16 != 0;
+		const auto isFlat		  = (index / 8) % 2 != 0;
+		const auto numAccidentals = static_cast<int> (index % 8);
+
+		// the position of the major tonic is the signed number of sharps, and the relative minor's tonic is 3 fifths above it
+		const auto tonic = (isFlat ? -numAccidentals : numAccidentals) + (isMinor ? 3 : 0);
+
+		table[index] = static_cast<std::int8_t> (tonic - 5);
+	}
+
+	return table;
+}();
+
+// indexed by Mode::getDenseIndex()
+inline constexpr auto modeLowestFifths = []
+{
+	// The position of each root on the line of fifths, spelled as Mode::getKeySignature() does:
+	// Aeolian modes use the default minor key with that root, and all other modes use the default major key
+	constexpr std::array<int, semitonesInOctave> majorRoots { 0, -5, 2, -3, 4, -1, -6, 1, -4, 3, -2, 5 };
+	constexpr std::array<int, semitonesInOctave> minorRoots { 0, 7, 2, -3, 4, -1, 6, 1, 8, 3, -2, 5 };
+
+	std::array<std::int8_t, scales::Mode::numDenseIndices> table {};
+
+	for (auto index = 0UL; index < table.size(); ++index)
+	{
+		const auto type = static_cast<scales::Mode::Type> (index / semitonesInOctave);
+		const auto root = index % semitonesInOctave;
+
+		const auto tonic = type == scales::Mode::Type::Aeolian ? minorRoots[root] : majorRoots[root];
+
+		table[index] = static_cast<std::int8_t> (tonic - (type == scales::Mode::Type::Locrian ? 6 : 5));
+	}
+
+	return table;
+}();
+
+}  // namespace detail
+
+
+/** Spells %pitch classes with letter names and accidentals, according to a key signature or %mode.
+
+	Notes in the key are spelled as they appear in the key signature, so E# is spelled as such in C# major.
+	Notes outside the key are spelled as in the harmonic chromatic scale, which is the same ascending and descending: the flattened second, third, sixth and seventh
+	and the sharpened fourth of the tonic, with natural minor keys using the sharpened third, sixth and seventh instead, which gives the leading tone of harmonic minor.
+	Modes are spelled the same way from their root, which is spelled as it is in Mode::getKeySignature(); Locrian modes use a flattened fifth instead of a sharpened fourth.
+
+	All spellings are precomputed in constant tables, so creating a speller and spelling a note are both lookups, and the batch functions never allocate.
+
+	@ingroup limes_harmony
+	@see PitchSpelling
+ */
+class LHARM_EXPORT PitchSpeller final
+{
+public:
+	/** @name Constructors */
+	///@{
+	/** Creates a speller for C major. */
+	constexpr PitchSpeller() noexcept
+		: PitchSpeller (-5)
+	{
+	}
+
+	/** Creates a speller for the given key signature, which must have 7 or fewer sharps or flats. */
+	constexpr explicit PitchSpeller (const scales::KeySignature& keySignature) noexcept
+		: PitchSpeller (detail::keySignatureLowestFifths[keySignature.getDenseIndex()])
+	{
+	}
+
+	/** Creates a speller for the given %mode. */
+	constexpr explicit PitchSpeller (const scales::Mode& mode) noexcept
+		: PitchSpeller (detail::modeLowestFifths[mode.getDenseIndex()])
+	{
+	}
+	///@}
+
+	/** @name Spelling */
+	///@{
+	/** Returns the spelling of a %pitch class in this speller's key. */
+	[[nodiscard]] constexpr PitchSpelling spell (PitchClass pitchClass) const noexcept
+	{
+		return spellings[static_cast<std::size_t> (pitchClass.getAsInt())];
+	}
+
+	/** Returns the spelling of a %pitch's nearest MIDI note in this speller's key.
+		@see PitchSpelling::getOctaveNumber()
+	 */
+	[[nodiscard]] constexpr PitchSpelling spell (Pitch pitch) const noexcept
+	{
+		return spell (pitch.getPitchClass());
+	}
+
+	/** Spells a sequence of pitches into the output array, which must be at least as long as the input. */
+	void spell (std::span<const Pitch> pitches, std::span<PitchSpelling> output) const noexcept;
+
+	/** Spells every %pitch in a buffer into the output array, which must be at least as long as the buffer. */
+	void spell (const PitchBuffer& pitches, std::span<PitchSpelling> output) const noexcept;
+	///@}
+
+	/** Returns the spellings of all 12 %pitch classes in this speller's key, indexed by %pitch class. */
+	[[nodiscard]] constexpr const detail::PitchClassSpellings& getSpellings() const noexcept
+	{
+		return spellings;
+	}
+
+private:
+	// lowestFifth is the position on the line of fifths of the first spelling in this key's window
+	constexpr explicit PitchSpeller (int lowestFifth) noexcept
+		: spellings (detail::spellingsByLowestFifth[static_cast<std::size_t> (lowestFifth - detail::minLowestFifth)])
+	{
+		assert (lowestFifth >= detail::minLowestFifth && lowestFifth <= detail::maxLowestFifth);
+	}
+
+	detail::PitchClassSpellings spellings;
+};
+
+}  // namespace limes::harmony
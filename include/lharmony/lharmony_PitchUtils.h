@@ -15,9 +15,14 @@
 #pragma once
 
 #include <array>
+#include <bit>
 #include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
 #include <type_traits>
 #include <cmath>
+#include <span>
 #include "lharmony/lharmony_Export.h"
 
 /** @file
@@ -34,12 +39,23 @@ namespace limes::harmony
  */
 
 /** Integer constant representing the number of semitones in an octave (12). */
-LHARM_EXPORT constinit const auto semitonesInOctave = 12;
+inline constexpr auto semitonesInOctave = 12;
+
+/** Returns the %pitch class of a given MIDI note, as an integer between 0 and 11.
+	This uses floored modulo, so negative notes wrap around correctly -- for example, note -1 is a B (11).
+	@see PitchClass
+ */
+LHARM_EXPORT constexpr int pitchClassOfMidiNote (int midiNote) noexcept
+{
+	const auto remainder = midiNote % semitonesInOctave;
+
+	return remainder < 0 ? remainder + semitonesInOctave : remainder;
+}
 
 /** Returns the octave number of a given MIDI pitch.
 
-	The formula is @f$ O=\lfloor\frac{note}{12}-1\rfloor @f$.
-	This formula puts note 69 in octave 4.
+	The formula is @f$ O=\lfloor\frac{note}{12}\rfloor-1 @f$.
+	This formula puts note 69 in octave 4. Only integer arithmetic is used, and the division rounds towards negative infinity, so negative notes are placed in negative octaves.
 
 	Here are the MIDI octaves, as defined by this formula:
 
@@ -56,9 +72,9 @@ LHARM_EXPORT constinit const auto semitonesInOctave = 12;
 
 	@see lowestNoteOfMidiOctave
  */
-LHARM_EXPORT static inline int octaveNumberOfMidiNote (int midiNote) noexcept
+LHARM_EXPORT constexpr int octaveNumberOfMidiNote (int midiNote) noexcept
 {
-	return static_cast<int> (std::floor (static_cast<float> (midiNote) / 12.f - 1.f));
+	return (midiNote - pitchClassOfMidiNote (midiNote)) / semitonesInOctave - 1;
 }
 
 /** Returns the lowest note of a given MIDI octave number (that octave's C key).
@@ -116,6 +132,188 @@ LHARM_EXPORT constexpr int highestNoteOfMidiOctave (int octaveNumber) noexcept
 template<typename T>
 concept ArithmeticType = std::is_arithmetic_v<T>;
 
+/** Rounds a floating point value to the nearest integer, with halfway values rounded away from zero.
+	This gives the same results as \c std::round() for every value an \c int can hold, but can be used in constant expressions.
+ */
+LHARM_EXPORT constexpr int roundToNearestInt (double value) noexcept
+{
+	const auto truncated = static_cast<int> (value);
+
+	// this subtraction is exact, so there is no rounding error in the comparisons below
+	const auto fraction = value - static_cast<double> (truncated);
+
+	if (fraction >= 0.5)
+		return truncated + 1;
+
+	if (fraction <= -0.5)
+		return truncated - 1;
+
+	return truncated;
+}
+
+/** Selects the trade-off between speed and accuracy made by the %pitch/frequency conversion functions.
+	@see midiToFreq(), freqToMidi()
+ */
+enum class ConversionAccuracy
+{
+	Exact,		  ///< Uses the C library's @c pow and @c log2, so results are as accurate as a double allows.
+	TenthOfCent,  ///< Uses polynomial approximations whose results are always within 0.1 cent of the exact values.
+	Cent		  ///< Uses lower-degree polynomial approximations whose results are always within 1 cent of the exact values.
+};
+
+namespace detail
+{
+
+// Taylor series of 2^x = e^(x ln2) around 0, highest power first.
+// Evaluated on [-0.5, 0.5], the truncation error of the degree-13 series is below 1e-17, so results are within 2 ULP.
+inline constexpr std::array<double, 14> exp2ExactCoefficients {
+	1.3691488853904124e-12,	 // ln2^13 / 13!
+	2.5678435993488196e-11,	 // ln2^12 / 12!
+	4.44553827187081e-10,	 // ln2^11 / 11!
+	7.054911620801121e-09,	 // ln2^10 / 10!
+	1.0178086009239696e-07,	 // ln2^9 / 9!
+	1.3215486790144305e-06,	 // ln2^8 / 8!
+	1.5252733804059838e-05,	 // ln2^7 / 7!
+	0.00015403530393381606,	 // ln2^6 / 6!
+	0.0013333558146428441,	 // ln2^5 / 5!
+	0.009618129107628477,	 // ln2^4 / 4!
+	0.055504108664821576,	 // ln2^3 / 3!
+	0.2402265069591007,		 // ln2^2 / 2!
+	0.6931471805599453,		 // ln2
+	1.0
+};
+
+// Minimax polynomials for 2^x on [-0.5, 0.5], highest power first, fitted for relative error.
+// The cubic's worst error is 0.13 cents; the quartic's is 0.0045 cents.
+inline constexpr std::array<double, 4> exp2CentCoefficients { 0.055171669074864, 0.2426111221943308, 0.6932609854573362, 0.9999280735404956 };
+
+inline constexpr std::array<double, 5> exp2TenthOfCentCoefficients { 0.009570101908081146, 0.055917860319303916, 0.24024744827944053,
+																	  0.6931218147367708, 0.9999992614457144 };
+
+// Minimax polynomials for log2 (1 + x) on [sqrt(0.5) - 1, sqrt(2) - 1], highest power first.
+// The cubic's worst error is 0.77 cents; the quintic's is 0.015 cents.
+inline constexpr std::array<double, 4> log2CentCoefficients { 0.4475949233565242, -0.7609652748358927, 1.4456437789063774, 0.0005832660682840478 };
+
+inline constexpr std::array<double, 6> log2TenthOfCentCoefficients { 0.25384347310289757, -0.39703738366659425, 0.4870011483830849,
+																	  -0.719923378405321, 1.4425493859922898, -9.26585499563701e-06 };
+
+// 1.5 * 2^52: adding this to a double rounds it to an integer
+inline constexpr auto roundingMagic = 6755399441055744.0;
+
+// beyond this many octaves, 2^x leaves the range of normal doubles
+inline constexpr auto maxExp2Argument = 1000.;
+
+inline constexpr auto sqrt2 = 1.4142135623730951;
+
+inline constexpr auto log2Of440 = 8.78135971352466;
+
+template <ConversionAccuracy Accuracy>
+[[nodiscard]] constexpr const auto& exp2Coefficients() noexcept
+{
+	if constexpr (Accuracy == ConversionAccuracy::Cent)
+		return exp2CentCoefficients;
+	else if constexpr (Accuracy == ConversionAccuracy::TenthOfCent)
+		return exp2TenthOfCentCoefficients;
+	else
+		return exp2ExactCoefficients;
+}
+
+template <ConversionAccuracy Accuracy>
+[[nodiscard]] constexpr const auto& log2Coefficients() noexcept
+{
+	static_assert (Accuracy != ConversionAccuracy::Exact);
+
+	if constexpr (Accuracy == ConversionAccuracy::Cent)
+		return log2CentCoefficients;
+	else
+		return log2TenthOfCentCoefficients;
+}
+
+template <std::size_t NumCoefficients>
+[[nodiscard]] constexpr double evaluatePolynomial (double x, const std::array<double, NumCoefficients>& coefficients) noexcept
+{
+	auto result = coefficients[0];
+
+	for (auto i = 1UL; i < NumCoefficients; ++i)
+		result = result * x + coefficients[i];
+
+	return result;
+}
+
+// With ConversionAccuracy::Exact, this evaluates the full-precision series, which is within 2 ULP of std::exp2
+template <ConversionAccuracy Accuracy>
+[[nodiscard]] constexpr double approximateExp2 (double x) noexcept
+{
+	// also catches NaN
+	if (! (x >= -maxExp2Argument && x <= maxExp2Argument))
+		return std::exp2 (x);
+
+	const auto integer	= (x + roundingMagic) - roundingMagic;
+	const auto fraction = x - integer;
+
+	const auto exponentBits = static_cast<std::uint64_t> (static_cast<std::int64_t> (integer) + 1023) << 52;
+
+	return evaluatePolynomial (fraction, exp2Coefficients<Accuracy>()) * std::bit_cast<double> (exponentBits);
+}
+
+template <ConversionAccuracy Accuracy>
+[[nodiscard]] constexpr double approximateLog2 (double x) noexcept
+{
+	// zero, negative, subnormal, infinite and NaN values
+	if (! (x >= std::numeric_limits<double>::min() && x <= std::numeric_limits<double>::max()))
+		return std::log2 (x);
+
+	const auto bits = std::bit_cast<std::uint64_t> (x);
+
+	auto exponent = static_cast<double> (static_cast<std::int64_t> (bits >> 52) - 1023);
+
+	// mantissa in [1, 2), then reduced to [sqrt(0.5), sqrt(2))
+	auto mantissa = std::bit_cast<double> ((bits & 0x000FFFFFFFFFFFFFULL) | std::bit_cast<std::uint64_t> (1.));
+
+	if (mantissa > sqrt2)
+	{
+		mantissa *= 0.5;
+		exponent += 1.;
+	}
+
+	return exponent + evaluatePolynomial (mantissa - 1., log2Coefficients<Accuracy>());
+}
+
+// log2 (x) for positive normal values, usable in constant expressions, using the series ln (m) = 2 atanh ((m - 1) / (m + 1)) on the reduced mantissa.
+// With the mantissa in [sqrt(0.5), sqrt(2)), the series converges to within an ULP after 12 terms.
+[[nodiscard]] constexpr double seriesLog2 (double x) noexcept
+{
+	const auto bits = std::bit_cast<std::uint64_t> (x);
+
+	auto exponent = static_cast<double> (static_cast<std::int64_t> (bits >> 52) - 1023);
+
+	auto mantissa = std::bit_cast<double> ((bits & 0x000FFFFFFFFFFFFFULL) | std::bit_cast<std::uint64_t> (1.));
+
+	if (mantissa > sqrt2)
+	{
+		mantissa *= 0.5;
+		exponent += 1.;
+	}
+
+	const auto z		= (mantissa - 1.) / (mantissa + 1.);
+	const auto zSquared = z * z;
+
+	auto power = z;
+	auto sum   = 0.;
+
+	for (auto n = 1; n < 24; n += 2)
+	{
+		sum += power / static_cast<double> (n);
+		power *= zSquared;
+	}
+
+	constexpr auto ln2 = 0.6931471805599453;
+
+	return exponent + 2. * sum / ln2;
+}
+
+}  // namespace detail
+
 /** Converts a MIDI note to a frequency in Hz.
 	The formula is @f$ f=440*2^{\frac{midiNote-69}{12}} @f$.
 	@see freqToMidi
@@ -138,6 +336,86 @@ template <ArithmeticType T>
 	return 69. + 12. * std::log2 (static_cast<double> (freqHz) / 440.);
 }
 
+/** Converts a MIDI note to a frequency in Hz, with the given accuracy.
+
+	With ConversionAccuracy::Exact, this is the same as the other midiToFreq() overload. The other settings replace @c pow with a polynomial approximation of @f$ 2^x @f$, which is several times faster and can be evaluated at compile time.
+	For example, @c midiToFreq<ConversionAccuracy::Cent>(note) returns a frequency within 1 cent of the exact one.
+
+	@see freqToMidi, ConversionAccuracy
+ */
+template <ConversionAccuracy Accuracy, ArithmeticType T>
+[[nodiscard]] constexpr double midiToFreq (T midiNote) noexcept
+{
+	if constexpr (Accuracy == ConversionAccuracy::Exact)
+		return midiToFreq (midiNote);
+	else
+		return 440. * detail::approximateExp2<Accuracy> ((static_cast<double> (midiNote) - 69.) / 12.);
+}
+
+/** Converts a frequency in Hz to a MIDI note, with the given accuracy.
+
+	With ConversionAccuracy::Exact, this is the same as the other freqToMidi() overload. The other settings replace @c log2 with a polynomial approximation, which is several times faster and can be evaluated at compile time.
+	For example, @c freqToMidi<ConversionAccuracy::Cent>(freq) returns a MIDI %pitch within 1 cent of the exact one.
+
+	@see midiToFreq, ConversionAccuracy
+ */
+template <ConversionAccuracy Accuracy, ArithmeticType T>
+[[nodiscard]] constexpr double freqToMidi (T freqHz) noexcept
+{
+	if constexpr (Accuracy == ConversionAccuracy::Exact)
+		return freqToMidi (freqHz);
+	else
+		return 69. + 12. * (detail::approximateLog2<Accuracy> (static_cast<double> (freqHz)) - detail::log2Of440);
+}
+
+/** Converts a block of MIDI notes to frequencies in Hz.
+
+	This computes the same formula as the scalar midiToFreq(), but is vectorized with SSE2, or AVX2 if the library is compiled with AVX2 enabled.
+	On other platforms, this simply calls the scalar version for each element.
+
+	With ConversionAccuracy::Exact, the vectorized kernel uses a high-degree polynomial approximation of @f$ 2^x @f$. For MIDI notes within 1000 octaves of A4, its results are within 2 ULP of the scalar version (a relative error below @f$ 3 \times 10^{-16} @f$).
+	The other accuracy settings use the same polynomials as the scalar midiToFreq<Accuracy>(), and give the same error bounds.
+	Values outside that range, and NaNs, are passed to the scalar version.
+
+	@param midiNotes The MIDI notes to convert.
+	@param freqsHz The buffer to write the frequencies to. This must be at least as long as \c midiNotes, and may be the same buffer.
+	@param accuracy The trade-off between speed and accuracy to make.
+
+	@see freqToMidi()
+ */
+LHARM_EXPORT void midiToFreq (std::span<const double> midiNotes, std::span<double> freqsHz,
+							  ConversionAccuracy accuracy = ConversionAccuracy::Exact) noexcept;
+
+/** Converts a block of frequencies in Hz to MIDI notes.
+
+	This computes the same formula as the scalar freqToMidi(), but is vectorized with SSE2, or AVX2 if the library is compiled with AVX2 enabled.
+	On other platforms, this simply calls the scalar version for each element. With ConversionAccuracy::Exact, SSE2 builds also use the scalar version, because a two-lane kernel of that precision is no faster than the C library's @c log2.
+
+	With ConversionAccuracy::Exact, the vectorized kernel uses a high-degree approximation of @f$ \log_2 x @f$. For frequencies between 1 Hz and 30 kHz, its results are within @f$ 3 \times 10^{-14} @f$ semitones of the scalar version; across the whole range of positive normal doubles, they are within @f$ 2 \times 10^{-12} @f$ semitones.
+	The other accuracy settings use the same polynomials as the scalar freqToMidi<Accuracy>(), and give the same error bounds.
+	Zero, negative, subnormal, infinite and NaN frequencies are passed to the scalar version.
+
+	@param freqsHz The frequencies to convert.
+	@param midiNotes The buffer to write the MIDI notes to. This must be at least as long as \c freqsHz, and may be the same buffer.
+	@param accuracy The trade-off between speed and accuracy to make.
+
+	@see midiToFreq()
+ */
+LHARM_EXPORT void freqToMidi (std::span<const double> freqsHz, std::span<double> midiNotes,
+							  ConversionAccuracy accuracy = ConversionAccuracy::Exact) noexcept;
+
+/** Returns the size in cents of a frequency ratio, @f$ 1200 \log_2 ratio @f$.
+	The ratio must be a positive normal number. This can be used in constant expressions, such as when building tables of just intonation intervals.
+	@see Interval::getJustRatios()
+ */
+[[nodiscard]] LHARM_EXPORT constexpr double ratioToCents (double ratio) noexcept
+{
+	if (std::is_constant_evaluated())
+		return 1200. * detail::seriesLog2 (ratio);
+
+	return 1200. * std::log2 (ratio);
+}
+
 /** @} */
 
 }  // namespace limes::harmony
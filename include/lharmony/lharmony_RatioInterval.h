@@ -0,0 +1,241 @@
+/*
+ * ======================================================================================
+ *  __    ____  __  __  ____  ___
+ * (  )  (_  _)(  \/  )( ___)/ __)
+ *  )(__  _)(_  )    (  )__) \__ \
+ * (____)(____)(_/\/\_)(____)(___/
+ *
+ *  This file is part of the Limes open source library and is licensed under the terms of the GNU Public License.
+ *
+ *  Commercial licenses are available; contact the maintainers at ben.the.vining@gmail.com to inquire for details.
+ *
+ * ======================================================================================
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <iosfwd>
+#include <string>
+#include "lharmony/lharmony_Export.h"
+#include "lharmony/lharmony_Interval.h"
+#include "lharmony/lharmony_PitchUtils.h"
+
+/** @file
+	This file defines the \c RatioInterval class.
+
+	@ingroup lharmony_intervals
+ */
+
+namespace limes::harmony
+{
+
+/** A class that represents an %interval as an exact frequency ratio, such as 3/2 or 81/80.
+
+	Just intonation intervals are points on a lattice whose axes are the prime numbers, and walking the lattice means multiplying and dividing ratios.
+	Doing this with cents values accumulates rounding error; this class keeps the numerator and denominator as 64-bit unsigned integers, so stacking and comparing intervals is exact.
+
+	Ratios are always stored in lowest terms, so two objects are equal exactly when they represent the same ratio.
+	Normalization uses a binary GCD, and multiplying two ratios cross-cancels their factors before multiplying, so the results only overflow when the reduced ratio itself does not fit in 64 bits.
+	Comparisons use 128-bit products, and never overflow.
+
+	Ratios may be smaller than 1/1, which represent descending intervals. Use getOctaveReduced() to bring a ratio into the range [1/1, 2/1).
+
+	Every member function except the string functions can be used in constant expressions.
+	Operations that would overflow throw an exception, which is a compile error in a constant expression.
+
+	@ingroup lharmony_intervals
+	@see JustRatio, MicrotonalInterval
+ */
+class LHARM_EXPORT RatioInterval final
+{
+public:
+	/** The primes that getMonzo() and fromMonzo() use, in order. */
+	static constexpr std::array<std::uint64_t, 16> monzoPrimes { 2, 3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37, 41, 43, 47, 53 };
+
+	/** A vector of prime exponents, where the ratio is the product of each prime in monzoPrimes raised to its exponent.
+		For example, 81/80 is [-4, 4, -1, 0, ...].
+	 */
+	using Monzo = std::array<std::int8_t, monzoPrimes.size()>;
+
+	/** @name Constructors */
+	///@{
+	/** Creates a unison, 1/1. */
+	constexpr RatioInterval() noexcept = default;
+
+	/** Creates a ratio %interval, reducing the ratio to lowest terms.
+		@throws std::invalid_argument An exception is thrown if either the numerator or denominator is 0.
+	 */
+	constexpr RatioInterval (std::uint64_t numeratorToUse, std::uint64_t denominatorToUse);
+
+	/** Creates a ratio %interval from one of the ratios returned by Interval::getJustRatios(). */
+	constexpr explicit RatioInterval (const JustRatio& ratio);
+
+	/** Creates a ratio %interval from a vector of prime exponents.
+		@throws std::overflow_error An exception is thrown if the numerator or denominator does not fit in 64 bits.
+		@see getMonzo()
+	 */
+	[[nodiscard]] static constexpr RatioInterval fromMonzo (const Monzo& monzo);
+	///@}
+
+	constexpr RatioInterval (const RatioInterval&) = default;
+	constexpr RatioInterval& operator= (const RatioInterval&) = default;
+
+	constexpr RatioInterval (RatioInterval&&) = default;
+	constexpr RatioInterval& operator= (RatioInterval&&) = default;
+
+	~RatioInterval() = default;
+
+	/** @name Comparisons */
+	///@{
+	/** Returns true if the two intervals represent the same ratio. */
+	[[nodiscard]] constexpr bool operator== (const RatioInterval& other) const noexcept;
+
+	/** Returns true if the two intervals do not represent the same ratio. */
+	[[nodiscard]] constexpr bool operator!= (const RatioInterval& other) const noexcept;
+
+	/** Returns true if this %interval's ratio is larger than the other one. This comparison is exact. */
+	[[nodiscard]] constexpr bool operator> (const RatioInterval& other) const noexcept;
+
+	/** Returns true if this %interval's ratio is smaller than the other one. This comparison is exact. */
+	[[nodiscard]] constexpr bool operator< (const RatioInterval& other) const noexcept;
+	///@}
+
+	/** @name Stacking */
+	///@{
+	/** Returns the %interval formed by stacking the other %interval on top of this one, which multiplies the ratios.
+		@throws std::overflow_error An exception is thrown if the resulting ratio does not fit in 64 bits.
+	 */
+	[[nodiscard]] constexpr RatioInterval operator* (const RatioInterval& other) const;
+
+	/** Returns the %interval formed by taking the other %interval away from this one, which divides the ratios.
+		@throws std::overflow_error An exception is thrown if the resulting ratio does not fit in 64 bits.
+	 */
+	[[nodiscard]] constexpr RatioInterval operator/ (const RatioInterval& other) const;
+
+	/** Stacks the other %interval on top of this one. */
+	constexpr RatioInterval& operator*= (const RatioInterval& other);
+
+	/** Takes the other %interval away from this one. */
+	constexpr RatioInterval& operator/= (const RatioInterval& other);
+
+	/** Returns this %interval stacked on itself the given number of times. Negative powers return the reciprocal's powers, and a power of 0 returns 1/1.
+		@throws std::overflow_error An exception is thrown if the resulting ratio does not fit in 64 bits.
+	 */
+	[[nodiscard]] constexpr RatioInterval pow (int power) const;
+
+	/** Returns the reciprocal of this ratio, the same %interval in the opposite direction. */
+	[[nodiscard]] constexpr RatioInterval getReciprocal() const noexcept;
+	///@}
+
+	/** @name Octaves */
+	///@{
+	/** Returns the number of whole octaves in this %interval, the floor of its base-2 logarithm. This is negative for ratios smaller than 1/1. */
+	[[nodiscard]] constexpr int getNumOctaves() const noexcept;
+
+	/** Returns this %interval moved by whole octaves into the range [1/1, 2/1).
+		@throws std::overflow_error An exception is thrown if the resulting ratio does not fit in 64 bits, which can only happen for ratios smaller than 1/1.
+	 */
+	[[nodiscard]] constexpr RatioInterval getOctaveReduced() const;
+	///@}
+
+	/** @name Prime factorization */
+	///@{
+	/** Returns the largest prime factor of the numerator and denominator, or 1 for the unison.
+		For example, 5/4 is 5-limit and 7/4 is 7-limit.
+		This uses trial division, so it is fast for the small primes that just intonation uses, but slow for ratios with very large prime factors.
+	 */
+	[[nodiscard]] constexpr std::uint64_t getPrimeLimit() const noexcept;
+
+	/** Returns true if every prime factor of the ratio is less than or equal to the given prime limit. */
+	[[nodiscard]] constexpr bool isWithinPrimeLimit (std::uint64_t primeLimit) const noexcept;
+
+	/** Returns this ratio's vector of prime exponents, or an empty optional if it has a prime factor larger than the last of monzoPrimes.
+		@see fromMonzo()
+	 */
+	[[nodiscard]] constexpr std::optional<Monzo> getMonzo() const noexcept;
+	///@}
+
+	/** @name Accessors */
+	///@{
+	/** Returns the numerator of the ratio in lowest terms. */
+	[[nodiscard]] constexpr std::uint64_t getNumerator() const noexcept;
+
+	/** Returns the denominator of the ratio in lowest terms. */
+	[[nodiscard]] constexpr std::uint64_t getDenominator() const noexcept;
+
+	/** Returns the ratio as a floating-point number. */
+	[[nodiscard]] constexpr double getRatio() const noexcept;
+
+	/** Returns the size of this %interval in cents. This is negative for ratios smaller than 1/1. */
+	[[nodiscard]] constexpr double getCents() const noexcept;
+
+	/** Returns the size of this %interval as a (possibly fractional) number of semitones. */
+	[[nodiscard]] constexpr double getSemitones() const noexcept;
+
+	/** Returns a string description of this ratio, such as "3/2". */
+	[[nodiscard]] std::string getStringDescription() const;
+	///@}
+
+	/** Returns a new pitch object that represents the note this interval's distance above or below the passed pitch object.
+		@param other The pitch object to start from.
+		@param above When true, the returned pitch will be this interval's distance above the passed pitch. When false, the returned pitch will be this interval's distance below the passed pitch.
+	 */
+	[[nodiscard]] constexpr Pitch applyToPitch (const Pitch& other, bool above) const noexcept;
+
+private:
+	struct Normalized final
+	{
+	};
+
+	constexpr RatioInterval (std::uint64_t numeratorToUse, std::uint64_t denominatorToUse, Normalized) noexcept;
+
+	[[noreturn]] static void throwInvalidRatio (std::uint64_t numeratorToUse, std::uint64_t denominatorToUse);
+
+	[[noreturn]] static void throwOverflow (const char* operation);
+
+	std::uint64_t numerator { 1 }, denominator { 1 };
+};
+
+/** Writes a string description of the ratio %interval to the output stream.
+
+	@ingroup lharmony_intervals
+	@relates RatioInterval
+	@see RatioInterval::getStringDescription()
+ */
+LHARM_EXPORT std::ostream& operator<< (std::ostream& os, const RatioInterval& value);
+
+/** Adds a ratio %interval to the given pitch and returns a new pitch object at the resulting pitch.
+	@ingroup lharmony_intervals
+ */
+constexpr Pitch operator+ (const Pitch& pitch, const RatioInterval& interval) noexcept;
+
+/** Subtracts a ratio %interval from the given pitch and returns a new pitch object at the resulting pitch.
+	@ingroup lharmony_intervals
+ */
+constexpr Pitch operator- (const Pitch& pitch, const RatioInterval& interval) noexcept;
+
+}  // namespace limes::harmony
+
+#include "./lharmony_RatioInterval_impl.h"  // IWYU pragma: export
+
+namespace std
+{
+
+/** A specialization of \c std::hash for RatioInterval objects.
+	@ingroup lharmony_intervals
+ */
+template <>
+struct hash<limes::harmony::RatioInterval> final
+{
+	[[nodiscard]] size_t operator() (const limes::harmony::RatioInterval& interval) const noexcept
+	{
+		return hash<std::uint64_t> {}((interval.getNumerator() * 0x9e3779b97f4a7c15ULL) ^ interval.getDenominator());
+	}
+};
+
+}  // namespace std
@@ -0,0 +1,411 @@
+/*
+ * ======================================================================================
+ *  __    ____  __  __  ____  ___
+ * (  )  (_  _)(  \/  )( ___)/ __)
+ *  )(__  _)(_  )    (  )__) \__ \
+ * (____)(____)(_/\/\_)(____)(___/
+ *
+ *  This file is part of the Limes open source library and is licensed under the terms of the GNU Public License.
+ *
+ *  Commercial licenses are available; contact the maintainers at ben.the.vining@gmail.com to inquire for details.
+ *
+ * ======================================================================================
+ */
+
+// IWYU pragma: private
+// IWYU pragma: friend lharmony_RatioInterval.h
+
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <optional>
+#include <utility>
+
+/** @file
+	This file contains implementation details for the \c RatioInterval class.
+
+	@see lharmony_RatioInterval.h
+	@ingroup lharmony_intervals
+ */
+
+namespace limes::harmony
+{
+
+namespace detail
+{
+
+// Stein's algorithm, which only needs shifts and subtractions
+constexpr std::uint64_t binaryGcd (std::uint64_t a, std::uint64_t b) noexcept
+{
+	if (a == 0)
+		return b;
+
+	if (b == 0)
+		return a;
+
+	const auto shift = std::countr_zero (a | b);
+
+	a >>= std::countr_zero (a);
+
+	do
+	{
+		b >>= std::countr_zero (b);
+
+		if (a > b)
+			std::swap (a, b);
+
+		b -= a;
+	} while (b != 0);
+
+	return a << shift;
+}
+
+// the full 128-bit product of two 64-bit integers
+struct WideProduct final
+{
+	std::uint64_t high { 0 }, low { 0 };
+
+	[[nodiscard]] constexpr bool operator< (const WideProduct& other) const noexcept
+	{
+		return high < other.high || (high == other.high && low < other.low);
+	}
+};
+
+constexpr WideProduct multiplyWide (std::uint64_t a, std::uint64_t b) noexcept
+{
+#ifdef __SIZEOF_INT128__
+	// __extension__ keeps -Wpedantic quiet about the non-standard type in every file that includes this header
+	__extension__ using WideInt = unsigned __int128;
+
+	const auto product = static_cast<WideInt> (a) * b;
+
+	return { static_cast<std::uint64_t> (product >> 64U), static_cast<std::uint64_t> (product) };
+#else
+	constexpr std::uint64_t lowMask = 0xffffffffULL;
+
+	const auto aLow	 = a & lowMask;
+	const auto aHigh = a >> 32U;
+	const auto bLow	 = b & lowMask;
+	const auto bHigh = b >> 32U;
+
+	const auto lowLow	= aLow * bLow;
+	const auto lowHigh	= aLow * bHigh;
+	const auto highLow	= aHigh * bLow;
+	const auto highHigh = aHigh * bHigh;
+
+	const auto middle = (lowLow >> 32U) + (lowHigh & lowMask) + highLow;
+
+	return { highHigh + (lowHigh >> 32U) + (middle >> 32U), (middle << 32U) | (lowLow & lowMask) };
+#endif
+}
+
+constexpr std::uint64_t largestPrimeFactor (std::uint64_t value) noexcept
+{
+	std::uint64_t largest = 1;
+
+	if (value > 1 && (value & 1U) == 0)
+	{
+		largest = 2;
+		value >>= std::countr_zero (value);
+	}
+
+	for (std::uint64_t prime = 3; prime <= value / prime; prime += 2)
+	{
+		if (value % prime != 0)
+			continue;
+
+		largest = prime;
+
+		do
+		{
+			value /= prime;
+		} while (value % prime == 0);
+	}
+
+	if (value > 1)
+		return value;
+
+	return largest;
+}
+
+constexpr bool hasNoPrimeFactorAbove (std::uint64_t value, std::uint64_t primeLimit) noexcept
+{
+	if (value <= primeLimit)
+		return true;
+
+	if (primeLimit < 2)
+		return false;
+
+	value >>= std::countr_zero (value);
+
+	for (std::uint64_t prime = 3; prime <= primeLimit; prime += 2)
+	{
+		if (value <= primeLimit)
+			return true;
+
+		// whatever is left is 1 or a prime
+		if (prime > value / prime)
+			return false;
+
+		while (value % prime == 0)
+			value /= prime;
+	}
+
+	return value <= primeLimit;
+}
+
+}  // namespace detail
+
+constexpr RatioInterval::RatioInterval (std::uint64_t numeratorToUse, std::uint64_t denominatorToUse, Normalized) noexcept
+	: numerator (numeratorToUse), denominator (denominatorToUse)
+{
+}
+
+constexpr RatioInterval::RatioInterval (std::uint64_t numeratorToUse, std::uint64_t denominatorToUse)
+{
+	if (numeratorToUse == 0 || denominatorToUse == 0)
+		throwInvalidRatio (numeratorToUse, denominatorToUse);
+
+	const auto gcd = detail::binaryGcd (numeratorToUse, denominatorToUse);
+
+	numerator	= numeratorToUse / gcd;
+	denominator = denominatorToUse / gcd;
+}
+
+constexpr RatioInterval::RatioInterval (const JustRatio& ratio)
+	: RatioInterval (ratio.numerator, ratio.denominator)
+{
+}
+
+constexpr RatioInterval RatioInterval::fromMonzo (const Monzo& monzo)
+{
+	std::uint64_t num = 1, den = 1;
+
+	for (auto index = 0UL; index < monzo.size(); ++index)
+	{
+		const auto exponent = static_cast<int> (monzo[index]);
+
+		auto& target = exponent > 0 ? num : den;
+
+		for (auto count = exponent > 0 ? exponent : -exponent; count > 0; --count)
+		{
+			const auto product = detail::multiplyWide (target, monzoPrimes[index]);
+
+			if (product.high != 0)
+				throwOverflow ("fromMonzo");
+
+			target = product.low;
+		}
+	}
+
+	// the primes are distinct, so the numerator and denominator share no factors
+	return { num, den, Normalized {} };
+}
+
+constexpr bool RatioInterval::operator== (const RatioInterval& other) const noexcept
+{
+	return numerator == other.numerator && denominator == other.denominator;
+}
+
+constexpr bool RatioInterval::operator!= (const RatioInterval& other) const noexcept
+{
+	return ! (*this == other);
+}
+
+constexpr bool RatioInterval::operator> (const RatioInterval& other) const noexcept
+{
+	return other < *this;
+}
+
+constexpr bool RatioInterval::operator< (const RatioInterval& other) const noexcept
+{
+	return detail::multiplyWide (numerator, other.denominator) < detail::multiplyWide (other.numerator, denominator);
+}
+
+constexpr RatioInterval RatioInterval::operator* (const RatioInterval& other) const
+{
+	// both ratios are in lowest terms, so cancelling across them leaves the product in lowest terms too
+	const auto gcd1 = detail::binaryGcd (numerator, other.denominator);
+	const auto gcd2 = detail::binaryGcd (other.numerator, denominator);
+
+	const auto num = detail::multiplyWide (numerator / gcd1, other.numerator / gcd2);
+	const auto den = detail::multiplyWide (denominator / gcd2, other.denominator / gcd1);
+
+	if (num.high != 0 || den.high != 0)
+		throwOverflow ("multiply");
+
+	return { num.low, den.low, Normalized {} };
+}
+
+constexpr RatioInterval RatioInterval::operator/ (const RatioInterval& other) const
+{
+	return *this * other.getReciprocal();
+}
+
+constexpr RatioInterval& RatioInterval::operator*= (const RatioInterval& other)
+{
+	*this = *this * other;
+	return *this;
+}
+
+constexpr RatioInterval& RatioInterval::operator/= (const RatioInterval& other)
+{
+	*this = *this / other;
+	return *this;
+}
+
+constexpr RatioInterval RatioInterval::pow (int power) const
+{
+	auto base = power < 0 ? getReciprocal() : *this;
+
+	auto remaining = power < 0 ? 0U - static_cast<unsigned> (power) : static_cast<unsigned> (power);
+
+	RatioInterval result;
+
+	while (remaining > 0)
+	{
+		if ((remaining & 1U) != 0)
+			result *= base;
+
+		remaining >>= 1U;
+
+		if (remaining > 0)
+			base *= base;
+	}
+
+	return result;
+}
+
+constexpr RatioInterval RatioInterval::getReciprocal() const noexcept
+{
+	return { denominator, numerator, Normalized {} };
+}
+
+constexpr int RatioInterval::getNumOctaves() const noexcept
+{
+	const auto octaves = static_cast<int> (std::bit_width (numerator)) - static_cast<int> (std::bit_width (denominator));
+
+	if (octaves >= 0)
+		return (denominator << octaves) > numerator ? octaves - 1 : octaves;
+
+	return (numerator << -octaves) < denominator ? octaves - 1 : octaves;
+}
+
+constexpr RatioInterval RatioInterval::getOctaveReduced() const
+{
+	const auto octaves = getNumOctaves();
+
+	auto num = numerator;
+	auto den = denominator;
+
+	if (octaves >= 0)
+	{
+		den <<= octaves;
+	}
+	else
+	{
+		if (static_cast<int> (std::bit_width (num)) - octaves > 64)
+			throwOverflow ("getOctaveReduced");
+
+		num <<= -octaves;
+	}
+
+	// only powers of 2 were added, so those are the only common factors
+	const auto commonTwos = std::countr_zero (num | den);
+
+	return { num >> commonTwos, den >> commonTwos, Normalized {} };
+}
+
+constexpr std::uint64_t RatioInterval::getPrimeLimit() const noexcept
+{
+	return std::max (detail::largestPrimeFactor (numerator), detail::largestPrimeFactor (denominator));
+}
+
+constexpr bool RatioInterval::isWithinPrimeLimit (std::uint64_t primeLimit) const noexcept
+{
+	return detail::hasNoPrimeFactorAbove (numerator, primeLimit) && detail::hasNoPrimeFactorAbove (denominator, primeLimit);
+}
+
+constexpr std::optional<RatioInterval::Monzo> RatioInterval::getMonzo() const noexcept
+{
+	Monzo monzo {};
+
+	auto num = numerator;
+	auto den = denominator;
+
+	monzo[0] = static_cast<std::int8_t> (std::countr_zero (num) - std::countr_zero (den));
+
+	num >>= std::countr_zero (num);
+	den >>= std::countr_zero (den);
+
+	for (auto index = 1UL; index < monzoPrimes.size() && (num > 1 || den > 1); ++index)
+	{
+		const auto prime = monzoPrimes[index];
+
+		while (num % prime == 0)
+		{
+			num /= prime;
+			++monzo[index];
+		}
+
+		while (den % prime == 0)
+		{
+			den /= prime;
+			--monzo[index];
+		}
+	}
+
+	if (num != 1 || den != 1)
+		return std::nullopt;
+
+	return monzo;
+}
+
+constexpr std::uint64_t RatioInterval::getNumerator() const noexcept
+{
+	return numerator;
+}
+
+constexpr std::uint64_t RatioInterval::getDenominator() const noexcept
+{
+	return denominator;
+}
+
+constexpr double RatioInterval::getRatio() const noexcept
+{
+	return static_cast<double> (numerator) / static_cast<double> (denominator);
+}
+
+constexpr double RatioInterval::getCents() const noexcept
+{
+	return ratioToCents (getRatio());
+}
+
+constexpr double RatioInterval::getSemitones() const noexcept
+{
+	constexpr auto centsPerSemitone = 100.;
+
+	return getCents() / centsPerSemitone;
+}
+
+constexpr Pitch RatioInterval::applyToPitch (const Pitch& other, bool above) const noexcept
+{
+	if (above)
+		return Pitch { other.getMidiPitch() + getSemitones() };
+
+	return Pitch { other.getMidiPitch() - getSemitones() };
+}
+
+constexpr Pitch operator+ (const Pitch& pitch, const RatioInterval& interval) noexcept
+{
+	return interval.applyToPitch (pitch, true);
+}
+
+constexpr Pitch operator- (const Pitch& pitch, const RatioInterval& interval) noexcept
+{
+	return interval.applyToPitch (pitch, false);
+}
+
+}  // namespace limes::harmony
@@ -0,0 +1,133 @@
+/*
+ * ======================================================================================
+ *  __    ____  __  __  ____  ___
+ * (  )  (_  _)(  \/  )( ___)/ __)
+ *  )(__  _)(_  )    (  )__) \__ \
+ * (____)(____)(_/\/\_)(____)(___/
+ *
+ *  This file is part of the Limes open source library and is licensed under the terms of the GNU Public License.
+ *
+ *  Commercial licenses are available; contact the maintainers at ben.the.vining@gmail.com to inquire for details.
+ *
+ * ======================================================================================
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+#include "lharmony/lharmony_Export.h"
+#include "lharmony/lharmony_CompoundInterval.h"
+#include "lharmony/lharmony_Interval.h"
+#include "lharmony/lharmony_MicrotonalInterval.h"
+#include "lharmony/lharmony_PitchUtils.h"
+#include "lharmony/lharmony_RatioInterval.h"
+
+/** @file
+	This file defines the RatioRecognizer class.
+
+	@ingroup lharmony_intervals
+ */
+
+namespace limes::harmony
+{
+
+/** Finds the nearest simple just intonation ratio to a measured %interval, such as the ratio between two detected frequencies.
+
+	The candidates are every ratio between 1/1 and 2/1 whose numerator and denominator are no larger than a maximum term and have no prime factor above a prime limit.
+	Intervals larger than an octave are matched by their octave-reduced size, and the octaves are added back to the result, so 3/1 is recognized as a 3/2 plus an octave.
+	Only the size of an %interval matters, not its direction, so the recognized ratio is never smaller than 1/1.
+
+	Each result also carries a spelling of the ratio as a CompoundInterval.
+	If the octave-reduced ratio is one of an Interval's just ratios (see Interval::getJustRatios()), the spelling uses that %interval, preferring perfect,
+	major and minor intervals over augmented and diminished ones. Otherwise, the spelling is the %interval nearest in equal temperament.
+
+	The candidates are kept sorted by size, with an index into them for every cent of the octave, so each lookup is a constant-time search of a few neighbouring candidates.
+	The batch function converts frequencies to cents with the same vectorized kernels as freqToMidi(), and never allocates.
+
+	@ingroup lharmony_intervals
+	@see RatioInterval, PitchQuantizer
+ */
+class LHARM_EXPORT RatioRecognizer final
+{
+public:
+	/** The result of recognizing one %interval. */
+	struct Result final
+	{
+		/** The nearest candidate ratio, including any octaves. */
+		RatioInterval ratio;
+
+		/** The spelling of the recognized ratio. */
+		CompoundInterval interval;
+
+		/** The measured size minus the recognized ratio's size, in cents, so a positive error means that the measured %interval was wider. */
+		double errorCents { 0. };
+
+		/** True if the error is within the recognizer's tolerance.
+			This is also false if the measured size was not finite, or too many octaves for the ratio to fit in 64 bits, in which case the ratio is 1/1.
+		 */
+		bool matched { false };
+	};
+
+	/** Creates a recognizer.
+		@param primeLimit The largest prime factor a candidate ratio may have. This must be at least 2.
+		@param toleranceCents The largest error, in cents, for which a result counts as matched. This must not be negative.
+		@param maxTerm The largest numerator or denominator that an octave-reduced candidate ratio may have. This must be at least 2, and no larger than 1024.
+	 */
+	explicit RatioRecognizer (std::uint64_t primeLimit = 5, double toleranceCents = 10., std::uint64_t maxTerm = 64);
+
+	/** @name Single intervals */
+	///@{
+	/** Recognizes the ratio between two frequencies, which must be positive. */
+	[[nodiscard]] Result recognize (double firstFreqHz, double secondFreqHz) const noexcept;
+
+	/** Recognizes the ratio nearest to a microtonal %interval. */
+	[[nodiscard]] Result recognize (const MicrotonalInterval& interval) const noexcept;
+
+	/** Recognizes the ratio nearest to an %interval of the given size in cents. */
+	[[nodiscard]] Result recognizeCents (double cents) const noexcept;
+	///@}
+
+	/** Recognizes the ratio between each pair of frequencies.
+		@param firstFreqsHz The first frequency of each pair.
+		@param secondFreqsHz The second frequency of each pair. This must be at least as long as \c firstFreqsHz.
+		@param results Receives one result per pair. This must be at least as long as \c firstFreqsHz.
+		@param accuracy The accuracy of the conversion from frequencies to cents. With the default, the results differ from the single-pair function's only by rounding.
+	 */
+	void recognize (std::span<const double> firstFreqsHz, std::span<const double> secondFreqsHz, std::span<Result> results,
+					ConversionAccuracy accuracy = ConversionAccuracy::Exact) const noexcept;
+
+	/** @name Accessors */
+	///@{
+	/** Returns the candidate ratios, from 1/1 to 2/1 in ascending order. */
+	[[nodiscard]] std::span<const RatioInterval> getCandidates() const noexcept;
+
+	/** Returns the largest prime factor a candidate ratio may have. */
+	[[nodiscard]] std::uint64_t getPrimeLimit() const noexcept;
+
+	/** Returns the largest error in cents for which a result counts as matched. */
+	[[nodiscard]] double getToleranceCents() const noexcept;
+
+	/** Returns the largest numerator or denominator of an octave-reduced candidate ratio. */
+	[[nodiscard]] std::uint64_t getMaxTerm() const noexcept;
+	///@}
+
+private:
+	static constexpr std::size_t centsPerOctave = 1200;
+
+	std::uint64_t primeLimit, maxTerm;
+
+	double toleranceCents;
+
+	// sorted by size, from 1/1 to 2/1
+	std::vector<RatioInterval> candidates;
+	std::vector<double>		   candidateCents;
+	std::vector<Interval>	   candidateSpellings;
+
+	// the index of the first candidate at least as large as each whole number of cents from 0 to 1200
+	std::vector<std::uint32_t> firstCandidateByCent;
+};
+
+}  // namespace limes::harmony
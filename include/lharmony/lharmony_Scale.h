@@ -18,6 +18,7 @@
 #include "lharmony/lharmony_Export.h"
 #include "lharmony/lharmony_Pitch.h"
 #include "lharmony/lharmony_PitchClass.h"
+#include "lharmony/lharmony_PitchClassSet.h"
 
 /** @defgroup lharmony_scales Scales
 	Utilities for working with musical scales.
@@ -90,6 +91,12 @@ struct LHARM_EXPORT Scale
 	/** Returns the %pitch classes present in one octave of this %scale. */
 	[[nodiscard]] virtual std::vector<PitchClass> getPitchClasses() const;
 
+	/** Returns the %pitch classes present in this %scale as a PitchClassSet.
+		The default implementation builds the set from getIntervalsAsSemitones(); subclasses that know their %pitch class pattern up front override this to avoid allocating.
+		@see containsPitchClass()
+	 */
+	[[nodiscard]] virtual PitchClassSet getPitchClassSet() const;
+
 	/** Returns an array of %pitch objects representing one octave of this %scale, at the given octave number.
 		@param octaveNumber The MIDI octave number to produce pitches for.
 		@see lowestNoteOfMidiOctave()
@@ -0,0 +1,113 @@
+/*
+ * ======================================================================================
+ *  __    ____  __  __  ____  ___
+ * (  )  (_  _)(  \/  )( ___)/ __)
+ *  )(__  _)(_  )    (  )__) \__ \
+ * (____)(____)(_/\/\_)(____)(___/
+ *
+ *  This file is part of the Limes open source library and is licensed under the terms of the GNU Public License.
+ *
+ *  Commercial licenses are available; contact the maintainers at ben.the.vining@gmail.com to inquire for details.
+ *
+ * ======================================================================================
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <span>
+#include "lharmony/lharmony_Export.h"
+#include "lharmony/lharmony_PitchClass.h"
+#include "lharmony/lharmony_PitchUtils.h"
+
+/** @file
+	This file defines the TuningReference class.
+
+	@ingroup limes_harmony
+ */
+
+namespace limes::harmony
+{
+
+/** Describes how MIDI pitches map to frequencies: the frequency of A4, plus an optional offset in cents for each %pitch class.
+
+	With the default settings, this gives the same results as midiToFreq() and freqToMidi(). Setting a different concert %pitch (such as 442 or 415 Hz) transposes the whole tuning;
+	setting %pitch class offsets describes a tempered tuning, where each key is raised or lowered from its equal-tempered %pitch by a fixed number of cents in every octave.
+	Note that a non-zero offset for A moves A4 away from the concert %pitch.
+
+	The constructor precomputes the frequency of every MIDI note from 0 to 127, so converting a whole-numbered MIDI note in that range is a single table lookup.
+	Fractional MIDI pitches are interpolated between the two neighboring keys on a logarithmic scale, using a polynomial instead of a call to \c pow.
+	Pitches outside the table are computed from the table entry with the same %pitch class, scaled by a power of two.
+
+	@ingroup limes_harmony
+	@see Pitch::getFreqHz(), Pitch::fromFreq()
+ */
+class LHARM_EXPORT TuningReference final
+{
+public:
+	/** The number of MIDI notes whose frequencies are precomputed. */
+	static constexpr auto tableSize = std::size_t { 128 };
+
+	/** An offset in cents for each %pitch class, starting from C. */
+	using PitchClassOffsets = std::array<double, semitonesInOctave>;
+
+	/** @name Constructors */
+	///@{
+	/** Creates an equal-tempered tuning with the given frequency for A4. */
+	explicit TuningReference (double concertPitchHz = 440.) noexcept;
+
+	/** Creates a tuning with the given frequency for A4, and the given offset in cents for each %pitch class.
+		Each offset should be smaller than 50 cents in magnitude, so that ascending MIDI notes always have ascending frequencies.
+	 */
+	TuningReference (double concertPitchHz, const PitchClassOffsets& centsOffsets) noexcept;
+	///@}
+
+	/** @name Equality comparisons */
+	///@{
+	/** Returns true if the two tunings have the same concert %pitch and %pitch class offsets. */
+	[[nodiscard]] bool operator== (const TuningReference& other) const noexcept;
+
+	/** Returns true if the two tunings have a different concert %pitch or different %pitch class offsets. */
+	[[nodiscard]] bool operator!= (const TuningReference& other) const noexcept;
+	///@}
+
+	/** Returns the frequency of A4 in equal temperament, before any %pitch class offsets are applied. */
+	[[nodiscard]] double getConcertPitchHz() const noexcept;
+
+	/** Returns the offset in cents of the given %pitch class. */
+	[[nodiscard]] double getPitchClassOffset (PitchClass pitchClass) const noexcept;
+
+	/** Returns the offsets in cents of all 12 %pitch classes. */
+	[[nodiscard]] const PitchClassOffsets& getPitchClassOffsets() const noexcept;
+
+	/** Returns the precomputed frequencies of MIDI notes 0 to 127. */
+	[[nodiscard]] std::span<const double, tableSize> getFrequencyTable() const noexcept;
+
+	/** Returns the frequency in Hz of a MIDI %pitch in this tuning.
+		@see Pitch::getFreqHz()
+	 */
+	[[nodiscard]] double getFreqHz (double midiPitch) const noexcept;
+
+	/** Returns the MIDI %pitch of a frequency in Hz in this tuning.
+		This is the inverse of getFreqHz(). The containing key is found by a binary search of the frequency table, so only one logarithm is computed.
+		@see Pitch::fromFreq()
+	 */
+	[[nodiscard]] double getMidiPitch (double freqHz) const noexcept;
+
+private:
+	[[nodiscard]] double getFreqOfNote (int midiNote) const noexcept;
+
+	[[nodiscard]] double getStepOfNote (int midiNote) const noexcept;
+
+	double concertPitch;
+
+	PitchClassOffsets offsets;
+
+	std::array<double, tableSize> frequencies {};
+
+	// the size of the step from each note to the next one, in octaves
+	std::array<double, semitonesInOctave> stepsInOctaves {};
+};
+
+}  // namespace limes::harmony
@@ -18,6 +18,7 @@
 #include "lharmony/lharmony_Export.h"
 #include "lharmony/lharmony_Scale.h"
 #include "lharmony/lharmony_PitchClass.h"
+#include "lharmony/lharmony_PitchClassSet.h"
 
 /** @file
 	This file defines the WholeTone %scale class.
@@ -68,6 +69,9 @@ class LHARM_EXPORT WholeTone final : public Scale
 	/** Returns an array of 6 2's, since every %interval in this %scale is a whole step. */
 	[[nodiscard]] std::vector<int> getIntervalsAsSemitones() const final;
 
+	/** Returns the 6 %pitch classes that make up this %scale. */
+	[[nodiscard]] PitchClassSet getPitchClassSet() const noexcept final;
+
 	/** Returns the %pitch class of the root of this %scale. */
 	[[nodiscard]] PitchClass getPitchClassOfRoot() const noexcept final;
 
@@ -13,8 +13,11 @@
  */
 
 #include <algorithm>
+#include <iterator>
 #include "lharmony/lharmony_Chord.h"
+#include "lharmony/lharmony_KeyboardState.h"
 #include "lharmony/lharmony_PitchClass.h"
+#include "lharmony/lharmony_PitchClassSet.h"
 #include "lharmony/lharmony_Interval.h"
 #include "lharmony/lharmony_Scale.h"
 #include "lharmony/lharmony_Pitch.h"
@@ -24,20 +27,40 @@ namespace limes::harmony
 
 Chord::Chord (const std::initializer_list<int>& midiNotes)
 {
-	std::transform (std::begin (midiNotes), std::end (midiNotes), std::begin (pitches),
-					[] (const auto midiNote) { return Pitch { midiNote }; });
+	pitches.reserve (midiNotes.size());
 
-	pitches.erase (std::unique (std::begin (pitches), std::end (pitches)), std::end (pitches));
+	std::transform (std::begin (midiNotes), std::end (midiNotes), std::back_inserter (pitches),
+					[] (const auto midiNote) { return Pitch { midiNote }; });
 
 	std::sort (std::begin (pitches), std::end (pitches));
+
+	pitches.erase (std::unique (std::begin (pitches), std::end (pitches)), std::end (pitches));
 }
 
 Chord::Chord (const std::initializer_list<Pitch>& midiNotes)
 	: pitches (midiNotes)
 {
+	std::sort (std::begin (pitches), std::end (pitches));
+
 	pitches.erase (std::unique (std::begin (pitches), std::end (pitches)), std::end (pitches));
+}
 
-	std::sort (std::begin (pitches), std::end (pitches));
+Chord::Chord (const KeyboardState& keyboardState)
+{
+	pitches.reserve (static_cast<std::size_t> (keyboardState.getNumNotesOn()));
+
+	for (const auto note : keyboardState)
+		pitches.emplace_back (note);
+}
+
+bool Chord::operator== (const Chord& other) const noexcept
+{
+	return pitches == other.pitches;
+}
+
+bool Chord::operator!= (const Chord& other) const noexcept
+{
+	return ! (*this == other);
 }
 
 int Chord::getNumPitches() const
@@ -78,9 +101,7 @@ bool Chord::contains (int midiNote) const noexcept
 
 bool Chord::fitsInScale (const scales::Scale& scale) const noexcept
 {
-	return std::all_of (pitches.begin(), pitches.end(),
-						[&scale] (const Pitch p)
-						{ return scale.containsPitch (p); });
+	return scale.getPitchClassSet().containsAll (getPitchClassSet());
 }
 
 std::vector<Interval> Chord::getIntervals() const
@@ -95,21 +116,39 @@ std::vector<Interval> Chord::getIntervals() const
 
 std::vector<PitchClass> Chord::getPitchClasses() const
 {
-	std::vector<PitchClass> pitchClasses;
+	const auto set = getPitchClassSet();
 
-	std::transform (std::begin (pitches), std::end (pitches), std::begin (pitchClasses),
-					[] (const Pitch pitch) { return pitch.getPitchClass(); });
+	return { std::begin (set), std::end (set) };
+}
 
-	pitchClasses.erase (std::unique (std::begin (pitchClasses), std::end (pitchClasses)), std::end (pitchClasses));
+PitchClassSet Chord::getPitchClassSet() const noexcept
+{
+	PitchClassSet set;
 
-	std::sort (std::begin (pitchClasses), std::end (pitchClasses));
+	for (const auto pitch : pitches)
+		set.add (pitch.getPitchClass());
 
-	return pitchClasses;
+	return set;
 }
 
 int Chord::getNumUniquePitchClasses() const
 {
-	return static_cast<int> (getPitchClasses().size());
+	return getPitchClassSet().size();
+}
+
+KeyboardState Chord::getKeyboardState() const noexcept
+{
+	KeyboardState state;
+
+	for (const auto pitch : pitches)
+	{
+		const auto note = pitch.getRoundedMidiPitch();
+
+		if (note >= 0 && note < KeyboardState::numNotes)
+			state.noteOn (note);
+	}
+
+	return state;
 }
 
 std::vector<Pitch> Chord::getPitches() const
@@ -128,3 +167,21 @@ Chord Chord::applyInterval (Interval interval, bool above)
 }
 
 }  // namespace limes::harmony
+
+namespace std
+{
+
+size_t hash<limes::harmony::Chord>::operator() (const limes::harmony::Chord& chord) const noexcept
+{
+	auto seed = chord.pitches.size();
+
+	for (const auto& pitch : chord.pitches)
+	{
+		// the boost::hash_combine mixing step
+		seed ^= hash<limes::harmony::Pitch> {}(pitch) + 0x9e3779b97f4a7c15ULL + (seed << 6) + (seed >> 2);
+	}
+
+	return seed;
+}
+
+}  // namespace std
@@ -15,6 +15,7 @@
 #include "lharmony/lharmony_Chromatic.h"
 #include "lharmony/lharmony_PitchUtils.h"  // for semitonesInOctave
 #include "lharmony/lharmony_PitchClass.h"  // for PitchClass
+#include "lharmony/lharmony_PitchClassSet.h"	// for PitchClassSet
 
 namespace limes::harmony::scales
 {
@@ -41,6 +42,11 @@ std::vector<int> Chromatic::getIntervalsAsSemitones() const
 	return intervals;
 }
 
+PitchClassSet Chromatic::getPitchClassSet() const noexcept
+{
+	return PitchClassSet::all();
+}
+
 PitchClass Chromatic::getPitchClassOfRoot() const noexcept
 {
 	return startingPitchClass;
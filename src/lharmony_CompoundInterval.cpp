@@ -12,114 +12,60 @@
  * ======================================================================================
  */
 
-#include <cmath>
+#include <array>
+#include <cassert>
 #include <sstream>
 #include <stdexcept>
-#include "lharmony/lharmony_Pitch.h"
-#include "lharmony/lharmony_PitchUtils.h"
 #include "lharmony/lharmony_Interval.h"
 #include "lharmony/lharmony_CompoundInterval.h"
+#include "lharmony/lharmony_IntervalNames.h"
 
 namespace limes::harmony
 {
 
-CompoundInterval::CompoundInterval (int octaves, const Interval& simpleInterval) noexcept
-	: interval (simpleInterval), numOctaves (octaves)
+void CompoundInterval::throwInvalidKindOrQuality (IntervalError error, int kind, Interval::Quality quality)
 {
-	constexpr auto octave_kind = 8;
+	std::stringstream str;
 
-	if (interval.getKind() == octave_kind)
-	{
-		const auto quality_ = interval.getQuality();
-
-		if (quality_ != Interval::Quality::Diminished)
-		{
-			++numOctaves;
-			interval = Interval { 0, quality_ };
-		}
-	}
-}
-
-CompoundInterval::CompoundInterval (int kindToUse, Interval::Quality qualityToUse)
-{
-	if (! Interval::isValidQualityForKind (qualityToUse, kindToUse))
-	{
-		std::stringstream str;
-		str << "Cannot construct CompoundInterval - quality " << Interval::qualityToString (qualityToUse) << " is invalid for kind " << kindToUse;
-		throw std::runtime_error { str.str() };
-	}
-
-	if (kindToUse <= 8)
-	{
-		numOctaves = 0;
-		interval   = Interval { kindToUse, qualityToUse };
-		return;
-	}
-
-	numOctaves = (kindToUse - 1) / 7;
-
-	const auto intervalKind = kindToUse - (7 * numOctaves);
-
-	if (intervalKind <= 0)
-		interval = Interval();
+	if (error == IntervalError::InvalidKind)
+		str << "Cannot construct CompoundInterval - invalid kind " << kind;
+	else if (error == IntervalError::InvalidQuality)
+		str << "Cannot construct CompoundInterval - invalid quality " << static_cast<int> (quality) << " for kind " << kind;
 	else
-		interval = Interval { intervalKind, qualityToUse };
-}
+		str << "Cannot construct CompoundInterval - quality " << Interval::qualityToString (quality) << " is invalid for kind " << kind;
 
-CompoundInterval::CompoundInterval (int numSemitones) noexcept
-{
-	numOctaves = numSemitones / semitonesInOctave;
-	interval   = Interval::fromNumSemitones (numSemitones - (numOctaves * 12));
-}
-
-CompoundInterval CompoundInterval::fromPitches (int midiPitch1, int midiPitch2) noexcept
-{
-	return CompoundInterval { std::abs (midiPitch2 - midiPitch1) };
+	throw std::runtime_error { str.str() };
 }
 
-Interval CompoundInterval::getSimpleInterval() const noexcept
+std::string CompoundInterval::getStringDescription (bool useShort) const
 {
-	return interval;
-}
-
-std::vector<double> CompoundInterval::getCents_JustIntonation() const
-{
-	const auto octaveCents = static_cast<double> (numOctaves) * 1200.;
-
-	auto array = interval.getCents_JustIntonation();
+	std::array<char, maxIntervalNameLength> buffer;
 
-	for (auto i = 0; i < static_cast<int> (array.size()); ++i)
-		array[static_cast<std::vector<double>::size_type> (i)] += octaveCents;
+	const auto result = toChars (buffer.data(), buffer.data() + buffer.size(), *this, useShort);
 
-	return array;
+	return { buffer.data(), result.ptr };
 }
 
-CompoundInterval CompoundInterval::fromPitches (const Pitch& pitch1, const Pitch& pitch2) noexcept
+void getCompoundIntervals (std::span<const int> semitones, std::span<CompoundInterval> intervals) noexcept
 {
-	return CompoundInterval { std::abs (pitch2.getRoundedMidiPitch() - pitch1.getRoundedMidiPitch()) };
-}
+	assert (intervals.size() >= semitones.size());
 
-int CompoundInterval::getKind() const noexcept
-{
-	const auto simple = [kind = interval.getKind()]
+	for (auto i = 0UL; i < semitones.size(); ++i)
 	{
-		if (kind > 0)
-			return kind - 1;
+		const auto magnitude = semitones[i] < 0 ? -semitones[i] : semitones[i];
 
-		return kind;
-	}();
-
-	return (numOctaves * 7) + simple + 1;
+		intervals[i] = CompoundInterval { magnitude };
+	}
 }
 
-Interval::Quality CompoundInterval::getQuality() const noexcept
+std::ostream& operator<< (std::ostream& os, const CompoundInterval& value)
 {
-	return interval.getQuality();
-}
+	std::array<char, maxIntervalNameLength> buffer;
 
-int CompoundInterval::getNumSemitones() const noexcept
-{
-	return interval.getNumSemitones() + (numOctaves * semitonesInOctave);
+	const auto result = toChars (buffer.data(), buffer.data() + buffer.size(), value);
+
+	os.write (buffer.data(), result.ptr - buffer.data());
+	return os;
 }
 
 }  // namespace limes::harmony
@@ -0,0 +1,355 @@
+/*
+ * ======================================================================================
+ *  __    ____  __  __  ____  ___
+ * (  )  (_  _)(  \/  )( ___)/ __)
+ *  )(__  _)(_  )    (  )__) \__ \
+ * (____)(____)(_/\/\_)(____)(___/
+ *
+ *  This file is part of the Limes open source library and is licensed under the terms of the GNU Public License.
+ *
+ *  Commercial licenses are available; contact the maintainers at ben.the.vining@gmail.com to inquire for details.
+ *
+ * ======================================================================================
+ */
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <system_error>
+#include "lharmony/lharmony_IntervalNames.h"
+
+namespace limes::harmony
+{
+
+namespace
+{
+
+using Q = Interval::Quality;
+
+[[nodiscard]] constexpr bool isDigit (char c) noexcept
+{
+	return c >= '0' && c <= '9';
+}
+
+[[nodiscard]] constexpr bool isLetter (char c) noexcept
+{
+	return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+}
+
+[[nodiscard]] constexpr char toLower (char c) noexcept
+{
+	return c >= 'A' && c <= 'Z' ? static_cast<char> (c - 'A' + 'a') : c;
+}
+
+// a quality or kind word, such as "major", "aug" or "fifth"
+struct NameWord final
+{
+	std::string_view word;
+
+	int kind { -1 };  // -1 for quality words
+
+	Q quality { Q::Perfect };
+};
+
+inline constexpr std::array<NameWord, 18> nameWords {
+	NameWord { "perfect", -1, Q::Perfect },
+	NameWord { "perf", -1, Q::Perfect },
+	NameWord { "major", -1, Q::Major },
+	NameWord { "maj", -1, Q::Major },
+	NameWord { "minor", -1, Q::Minor },
+	NameWord { "min", -1, Q::Minor },
+	NameWord { "augmented", -1, Q::Augmented },
+	NameWord { "aug", -1, Q::Augmented },
+	NameWord { "diminished", -1, Q::Diminished },
+	NameWord { "dim", -1, Q::Diminished },
+	NameWord { "unison", 0 },
+	NameWord { "second", 2 },
+	NameWord { "third", 3 },
+	NameWord { "fourth", 4 },
+	NameWord { "fifth", 5 },
+	NameWord { "sixth", 6 },
+	NameWord { "seventh", 7 },
+	NameWord { "octave", 8 }
+};
+
+inline constexpr std::size_t nameWordHashSize = 32;
+
+// a perfect hash of the words above, from their first two letters and their length
+[[nodiscard]] constexpr std::size_t hashNameWord (char first, char second, std::size_t length) noexcept
+{
+	return (static_cast<std::size_t> (first) * 3 + static_cast<std::size_t> (second) * 2 + length * 12) % nameWordHashSize;
+}
+
+// the index into nameWords of the word with each hash, or -1 for unused slots
+inline constexpr auto nameWordsByHash = []
+{
+	std::array<std::int8_t, nameWordHashSize> slots {};
+
+	std::fill (slots.begin(), slots.end(), std::int8_t { -1 });
+
+	for (auto index = 0UL; index < nameWords.size(); ++index)
+	{
+		const auto word = nameWords[index].word;
+
+		slots[hashNameWord (word[0], word[1], word.size())] = static_cast<std::int8_t> (index);
+	}
+
+	return slots;
+}();
+
+static_assert (std::count_if (nameWordsByHash.begin(), nameWordsByHash.end(), [] (std::int8_t slot) { return slot >= 0; })
+				   == static_cast<std::ptrdiff_t> (nameWords.size()),
+			   "The interval name word hash has collisions");
+
+// looks up a run of letters, case-insensitively, returning nullptr if it is not a known word
+[[nodiscard]] constexpr const NameWord* findNameWord (const char* first, const char* last) noexcept
+{
+	const auto length = static_cast<std::size_t> (last - first);
+
+	if (length < 3)
+		return nullptr;
+
+	const auto slot = nameWordsByHash[hashNameWord (toLower (first[0]), toLower (first[1]), length)];
+
+	if (slot < 0)
+		return nullptr;
+
+	const auto& candidate = nameWords[static_cast<std::size_t> (slot)];
+
+	if (candidate.word.size() != length)
+		return nullptr;
+
+	for (auto i = 0UL; i < length; ++i)
+		if (toLower (first[i]) != candidate.word[i])
+			return nullptr;
+
+	return &candidate;
+}
+
+[[nodiscard]] constexpr bool parseQualityLetter (char c, Q& quality) noexcept
+{
+	switch (c)
+	{
+		case ('d') : quality = Q::Diminished; return true;
+		case ('m') : quality = Q::Minor; return true;
+		case ('M') : quality = Q::Major; return true;
+		case ('A') : quality = Q::Augmented; return true;
+		case ('P') : quality = Q::Perfect; return true;
+		default : return false;
+	}
+}
+
+[[nodiscard]] constexpr std::string_view getOrdinalSuffix (int number) noexcept
+{
+	const auto magnitude = number < 0 ? -number : number;
+
+	if (magnitude % 100 >= 11 && magnitude % 100 <= 13)
+		return "th";
+
+	switch (magnitude % 10)
+	{
+		case (1) : return "st";
+		case (2) : return "nd";
+		case (3) : return "rd";
+		default : return "th";
+	}
+}
+
+// the kind and quality read from the start of an interval name
+struct ParsedName final
+{
+	const char* end { nullptr };
+
+	int kind { 0 };
+
+	Q quality { Q::Perfect };
+
+	std::errc ec { std::errc::invalid_argument };
+};
+
+// parses a quality, then a kind, such as "M3", "m10", "aug 4", "Perfect fifth" or "Major 10th"
+[[nodiscard]] ParsedName parseName (const char* first, const char* last) noexcept
+{
+	ParsedName name;
+
+	auto ptr = first;
+
+	while (ptr != last && isLetter (*ptr))
+		++ptr;
+
+	if (ptr - first == 1)
+	{
+		if (! parseQualityLetter (*first, name.quality))
+			return name;
+	}
+	else
+	{
+		const auto* word = findNameWord (first, ptr);
+
+		if (word == nullptr || word->kind >= 0)
+			return name;
+
+		name.quality = word->quality;
+
+		if (ptr != last && *ptr == ' ')
+			++ptr;
+	}
+
+	if (ptr == last)
+		return name;
+
+	if (isDigit (*ptr))
+	{
+		const auto result = std::from_chars (ptr, last, name.kind);
+
+		name.end = result.ptr;
+
+		if (result.ec != std::errc {})
+		{
+			name.ec = result.ec;
+			return name;
+		}
+
+		// an ordinal suffix is optional, but must match the number
+		if (last - name.end >= 2)
+		{
+			const auto suffix = getOrdinalSuffix (name.kind);
+
+			if (toLower (name.end[0]) == suffix[0] && toLower (name.end[1]) == suffix[1])
+				name.end += 2;
+		}
+
+		// "1" is the usual number for a unison, and "0" is what this library writes
+		if (name.kind == 1)
+			name.kind = 0;
+	}
+	else
+	{
+		const auto* kindStart = ptr;
+
+		while (ptr != last && isLetter (*ptr))
+			++ptr;
+
+		const auto* word = findNameWord (kindStart, ptr);
+
+		if (word == nullptr || word->kind < 0)
+			return name;
+
+		name.kind = word->kind;
+		name.end  = ptr;
+	}
+
+	name.ec = std::errc {};
+
+	return name;
+}
+
+[[nodiscard]] std::to_chars_result writeString (char* first, char* last, std::string_view string) noexcept
+{
+	if (last - first < static_cast<std::ptrdiff_t> (string.size()))
+		return { last, std::errc::value_too_large };
+
+	return { std::copy (string.begin(), string.end(), first), std::errc {} };
+}
+
+
+}  // namespace
+
+std::from_chars_result fromChars (const char* first, const char* last, Interval& value) noexcept
+{
+	const auto name = parseName (first, last);
+
+	if (name.ec == std::errc::invalid_argument)
+		return { first, name.ec };
+
+	if (name.ec != std::errc {} || name.kind > 8)
+		return { name.end, std::errc::result_out_of_range };
+
+	const auto result = Interval::tryMake (name.kind, name.quality);
+
+	if (! result)
+		return { first, std::errc::invalid_argument };
+
+	value = *result;
+
+	return { name.end, std::errc {} };
+}
+
+std::from_chars_result fromChars (const char* first, const char* last, CompoundInterval& value) noexcept
+{
+	const auto name = parseName (first, last);
+
+	if (name.ec == std::errc::invalid_argument)
+		return { first, name.ec };
+
+	if (name.ec != std::errc {})
+		return { name.end, name.ec };
+
+	if (name.kind <= 8)
+	{
+		const auto result = Interval::tryMake (name.kind, name.quality);
+
+		if (! result)
+			return { first, std::errc::invalid_argument };
+
+		value = CompoundInterval { *result };
+
+		return { name.end, std::errc {} };
+	}
+
+	const auto result = CompoundInterval::tryMake (name.kind, name.quality);
+
+	if (! result)
+	{
+		if (result.error() == IntervalError::InvalidKind)
+			return { name.end, std::errc::result_out_of_range };
+
+		return { first, std::errc::invalid_argument };
+	}
+
+	value = *result;
+
+	return { name.end, std::errc {} };
+}
+
+std::to_chars_result toChars (char* first, char* last, const Interval& value, bool useShort) noexcept
+{
+	return writeString (first, last, value.getName (useShort));
+}
+
+std::to_chars_result toChars (char* first, char* last, const CompoundInterval& value, bool useShort) noexcept
+{
+	const auto kind = value.getKind();
+
+	// intervals up to an octave are named by their total kind, so that an octave stored as one octave and a unison is still a "Perfect octave"
+	if (value.getNumOctaves() >= 0 && kind <= 8)
+	{
+		const auto simpleKind = kind == 1 ? 0 : kind;
+
+		return toChars (first, last, Interval::fromDenseIndex (Interval::getDenseIndex (simpleKind, value.getQuality())), useShort);
+	}
+
+	auto result = writeString (first, last, Interval::getQualityName (value.getQuality(), useShort));
+
+	if (result.ec != std::errc {})
+		return result;
+
+	if (! useShort)
+	{
+		result = writeString (result.ptr, last, " ");
+
+		if (result.ec != std::errc {})
+			return result;
+	}
+
+	result = std::to_chars (result.ptr, last, kind);
+
+	if (result.ec != std::errc {} || useShort)
+		return result;
+
+	return writeString (result.ptr, last, getOrdinalSuffix (kind));
+}
+
+}  // namespace limes::harmony
@@ -12,8 +12,10 @@
  * ======================================================================================
  */
 
+#include <cassert>
 #include "lharmony/lharmony_KeySignature.h"
 #include "lharmony/lharmony_PitchClass.h"
+#include "lharmony/lharmony_PitchClassSet.h"
 
 namespace limes::harmony::scales
 {
@@ -28,6 +30,27 @@ std::vector<int> KeySignature::getIntervalsAsSemitones() const
 	}
 }
 
+PitchClassSet KeySignature::getPitchClassSet() const noexcept
+{
+	const auto pattern = [t = type]() -> PitchClassSet
+	{
+		using PC = PitchClass;
+
+		switch (t)
+		{
+			case (Type::Major) : return { PC { 0 }, PC { 2 }, PC { 4 }, PC { 5 }, PC { 7 }, PC { 9 }, PC { 11 } };
+			case (Type::NaturalMinor) : return { PC { 0 }, PC { 2 }, PC { 3 }, PC { 5 }, PC { 7 }, PC { 8 }, PC { 10 } };
+			case (Type::HarmonicMinor) : return { PC { 0 }, PC { 2 }, PC { 3 }, PC { 5 }, PC { 7 }, PC { 8 }, PC { 11 } };
+		}
+
+		// the switch covers every type, so this is only reached for an invalid value
+		assert (false);
+		return {};
+	}();
+
+	return pattern.transposed (getPitchClassOfRoot().getAsInt());
+}
+
 PitchClass KeySignature::getPitchClassOfRoot() const noexcept
 {
 	struct MajorMinorPair final
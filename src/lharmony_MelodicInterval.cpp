@@ -0,0 +1,120 @@
+/*
+ * ======================================================================================
+ *  __    ____  __  __  ____  ___
+ * (  )  (_  _)(  \/  )( ___)/ __)
+ *  )(__  _)(_  )    (  )__) \__ \
+ * (____)(____)(_/\/\_)(____)(___/
+ *
+ *  This file is part of the Limes open source library and is licensed under the terms of the GNU Public License.
+ *
+ *  Commercial licenses are available; contact the maintainers at ben.the.vining@gmail.com to inquire for details.
+ *
+ * ======================================================================================
+ */
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+#include "lharmony/lharmony_MelodicInterval.h"
+#include "lharmony_SimdOps.h"
+
+namespace limes::harmony
+{
+
+static_assert (std::is_trivially_copyable_v<MelodicInterval>);
+
+namespace
+{
+
+// the number of intervals whose semitones are computed at a time
+constexpr std::size_t blockSize = 256;
+
+// every interval between two MIDI notes, so that the common case is a single lookup
+constexpr auto maxTabulatedSemitones = 127;
+
+constexpr auto melodicIntervalsBySemitones = []
+{
+	std::array<MelodicInterval, 2 * maxTabulatedSemitones + 1> intervals {};
+
+	for (auto semitones = -maxTabulatedSemitones; semitones <= maxTabulatedSemitones; ++semitones)
+		intervals[static_cast<std::size_t> (semitones + maxTabulatedSemitones)] = MelodicInterval { semitones };
+
+	return intervals;
+}();
+
+// copying the whole object, padding included, is a single 4-byte move, where assignment copies each member separately
+inline void writeMelodicInterval (MelodicInterval& output, int semitones) noexcept
+{
+	if (semitones < -maxTabulatedSemitones || semitones > maxTabulatedSemitones)
+		output = MelodicInterval { semitones };
+	else
+		std::memcpy (&output, &melodicIntervalsBySemitones[static_cast<std::size_t> (semitones + maxTabulatedSemitones)], sizeof (MelodicInterval));
+}
+
+// the differences between consecutive rounded notes, num + 1 of which are read
+void writeSemitoneDifferences (const Pitch* notes, int* output, std::size_t num) noexcept
+{
+	std::size_t i = 0;
+
+#if LHARM_SIMD_AVX2 || LHARM_SIMD_SSE2
+	using S = detail::SimdOps;
+
+	const auto* const in = reinterpret_cast<const double*> (notes);  // NOLINT
+
+	for (; i + S::width <= num; i += S::width)
+	{
+		const auto from = detail::roundHalfAwayFromZero (S::load (in + i));
+		const auto to	= detail::roundHalfAwayFromZero (S::load (in + i + 1));
+
+		S::storeInts (output + i, S::sub (to, from));
+	}
+#endif
+
+	for (; i < num; ++i)
+		output[i] = notes[i + 1].getRoundedMidiPitch() - notes[i].getRoundedMidiPitch();
+}
+
+template <bool CountIntervals>
+void writeIntervals (std::span<const Pitch> melody, std::span<MelodicInterval> intervals, MelodicIntervalHistogram* histogram) noexcept
+{
+	const auto numIntervals = melody.size() - 1;
+
+	std::array<int, blockSize> semitones {};
+
+	for (std::size_t start = 0; start < numIntervals; start += blockSize)
+	{
+		const auto num = std::min (blockSize, numIntervals - start);
+
+		writeSemitoneDifferences (melody.data() + start, semitones.data(), num);
+
+		for (auto i = 0UL; i < num; ++i)
+		{
+			auto& interval = intervals[start + i];
+
+			writeMelodicInterval (interval, semitones[i]);
+
+			if constexpr (CountIntervals)
+				histogram->add (interval);
+		}
+	}
+}
+
+}  // namespace
+
+void getMelodicIntervals (std::span<const Pitch> melody, std::span<MelodicInterval> intervals, MelodicIntervalHistogram* histogram) noexcept
+{
+	if (melody.size() < 2)
+		return;
+
+	assert (intervals.size() >= melody.size() - 1);
+
+	if (histogram != nullptr)
+		writeIntervals<true> (melody, intervals, histogram);
+	else
+		writeIntervals<false> (melody, intervals, histogram);
+}
+
+}  // namespace limes::harmony
@@ -13,9 +13,11 @@
  */
 
 #include <algorithm>
+#include <cassert>
 #include "lharmony/lharmony_Mode.h"
 #include "lharmony/lharmony_KeySignature.h"
 #include "lharmony/lharmony_PitchClass.h"
+#include "lharmony/lharmony_PitchClassSet.h"
 
 namespace limes::harmony::scales
 {
@@ -34,6 +36,31 @@ std::vector<int> Mode::getIntervalsAsSemitones() const
 	}
 }
 
+PitchClassSet Mode::getPitchClassSet() const noexcept
+{
+	const auto pattern = [t = type]() -> PitchClassSet
+	{
+		using PC = PitchClass;
+
+		switch (t)
+		{
+			case (Type::Ionian) : return { PC { 0 }, PC { 2 }, PC { 4 }, PC { 5 }, PC { 7 }, PC { 9 }, PC { 11 } };
+			case (Type::Dorian) : return { PC { 0 }, PC { 2 }, PC { 3 }, PC { 5 }, PC { 7 }, PC { 9 }, PC { 10 } };
+			case (Type::Phrygian) : return { PC { 0 }, PC { 1 }, PC { 3 }, PC { 5 }, PC { 7 }, PC { 8 }, PC { 10 } };
+			case (Type::Lydian) : return { PC { 0 }, PC { 2 }, PC { 4 }, PC { 6 }, PC { 7 }, PC { 9 }, PC { 11 } };
+			case (Type::Mixolydian) : return { PC { 0 }, PC { 2 }, PC { 4 }, PC { 5 }, PC { 7 }, PC { 9 }, PC { 10 } };
+			case (Type::Aeolian) : return { PC { 0 }, PC { 2 }, PC { 3 }, PC { 5 }, PC { 7 }, PC { 8 }, PC { 10 } };
+			case (Type::Locrian) : return { PC { 0 }, PC { 1 }, PC { 3 }, PC { 5 }, PC { 6 }, PC { 8 }, PC { 10 } };
+		}
+
+		// the switch covers every type, so this is only reached for an invalid value
+		assert (false);
+		return {};
+	}();
+
+	return pattern.transposed (rootPitchClass.getAsInt());
+}
+
 PitchClass Mode::getPitchClassOfRoot() const noexcept
 {
 	return rootPitchClass;
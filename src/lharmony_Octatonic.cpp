@@ -14,6 +14,7 @@
 
 #include "lharmony/lharmony_Octatonic.h"
 #include "lharmony/lharmony_PitchClass.h"
+#include "lharmony/lharmony_PitchClassSet.h"
 
 namespace limes::harmony::scales
 {
@@ -47,6 +48,18 @@ std::vector<int> Octatonic::getIntervalsAsSemitones() const
 	return intervals;
 }
 
+PitchClassSet Octatonic::getPitchClassSet() const noexcept
+{
+	using PC = PitchClass;
+
+	constexpr PitchClassSet halfStepFirst { PC { 0 }, PC { 1 }, PC { 3 }, PC { 4 }, PC { 6 }, PC { 7 }, PC { 9 }, PC { 10 } };
+	constexpr PitchClassSet wholeStepFirst { PC { 0 }, PC { 2 }, PC { 3 }, PC { 5 }, PC { 6 }, PC { 8 }, PC { 9 }, PC { 11 } };
+
+	const auto pattern = startWithHalfStep ? halfStepFirst : wholeStepFirst;
+
+	return pattern.transposed (pitchClassOfRoot.getAsInt());
+}
+
 PitchClass Octatonic::getPitchClassOfRoot() const noexcept
 {
 	return pitchClassOfRoot;
@@ -12,76 +12,17 @@
  * ======================================================================================
  */
 
-#include <cmath>
 #include "lharmony/lharmony_Pitch.h"
-#include "lharmony/lharmony_PitchClass.h"
-#include "lharmony/lharmony_PitchUtils.h"
 #include "lharmony/lharmony_Interval.h"
 
 namespace limes::harmony
 {
 
-template<ArithmeticType T>
-[[nodiscard]] static inline int round (T input) noexcept
-{
-	return static_cast<int> (std::round (input));
-}
-
 Interval Pitch::operator- (const Pitch& other) const noexcept
 {
 	return Interval::fromPitches (*this, other);
 }
 
-bool Pitch::approximatelyEqual (Pitch other) const noexcept
-{
-	return round (midiPitch) == round (other.midiPitch);
-}
-
-int Pitch::getRoundedFreqHz() const noexcept
-{
-	return round (getFreqHz());
-}
-
-double Pitch::getFreqHz() const noexcept
-{
-	return midiToFreq (midiPitch);
-}
-
-int Pitch::getRoundedMidiPitch() const noexcept
-{
-	return round (midiPitch);
-}
-
-PitchClass Pitch::getPitchClass() const noexcept
-{
-	return PitchClass { round (midiPitch) };
-}
-
-int Pitch::getOctaveNumber() const noexcept
-{
-	return octaveNumberOfMidiNote (round (midiPitch));
-}
-
-bool Pitch::isBlackKey() const noexcept
-{
-	return getPitchClass().isBlackKey();
-}
-
-bool Pitch::isWhiteKey() const noexcept
-{
-	return ! isBlackKey();
-}
-
-bool Pitch::isMicrotone() const noexcept
-{
-	return std::floor (midiPitch) != midiPitch;
-}
-
-Pitch Pitch::inOctave (int octaveNumber) const noexcept
-{
-	return Pitch { getPitchClass(), octaveNumber };
-}
-
 std::ostream& operator<< (std::ostream& os, const Pitch& value)
 {
 	os << value.getMidiPitch();
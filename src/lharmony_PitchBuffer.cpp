@@ -0,0 +1,354 @@
+/*
+ * ======================================================================================
+ *  __    ____  __  __  ____  ___
+ * (  )  (_  _)(  \/  )( ___)/ __)
+ *  )(__  _)(_  )    (  )__) \__ \
+ * (____)(____)(_/\/\_)(____)(___/
+ *
+ *  This file is part of the Limes open source library and is licensed under the terms of the GNU Public License.
+ *
+ *  Commercial licenses are available; contact the maintainers at ben.the.vining@gmail.com to inquire for details.
+ *
+ * ======================================================================================
+ */
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include "lharmony/lharmony_PitchBuffer.h"
+#include "lharmony_SimdOps.h"
+
+namespace limes::harmony
+{
+
+// The kernels below read and write the buffer as an array of doubles
+static_assert (sizeof (Pitch) == sizeof (double) && std::is_standard_layout_v<Pitch> && std::is_trivially_copyable_v<Pitch>,
+			   "Pitch must be a plain wrapper around its MIDI pitch");
+
+namespace
+{
+
+// bit n is set if pitch class n is a black key
+constexpr auto blackKeyMask = (1U << 1) | (1U << 3) | (1U << 6) | (1U << 8) | (1U << 10);
+
+[[nodiscard]] inline const double* midiPitchData (const Pitch* pitches) noexcept
+{
+	return reinterpret_cast<const double*> (pitches);  // NOLINT
+}
+
+[[nodiscard]] inline double* midiPitchData (Pitch* pitches) noexcept
+{
+	return reinterpret_cast<double*> (pitches);	 // NOLINT
+}
+
+#if LHARM_SIMD_AVX2 || LHARM_SIMD_SSE2
+
+using SimdOps = detail::SimdOps;
+
+using detail::roundHalfAwayFromZero;
+
+// floor (notes / 12), for whole-numbered notes.
+// No whole number minus 5.5 is a multiple of 12 plus 6, so rounding (notes - 5.5) / 12 to the nearest integer never meets a halfway value.
+[[nodiscard]] inline SimdOps::Float octavesAboveMidiZero (SimdOps::Float notes) noexcept
+{
+	using S = SimdOps;
+
+	const auto magic = S::set (detail::roundingMagic);
+
+	const auto quotient = S::mul (S::sub (notes, S::set (5.5)), S::set (1. / static_cast<double> (semitonesInOctave)));
+
+	return S::sub (S::add (quotient, magic), magic);
+}
+
+#endif
+
+enum class NoteAttribute
+{
+	RoundedNote,
+	PitchClass,
+	OctaveNumber
+};
+
+template <NoteAttribute Attribute>
+[[nodiscard]] constexpr int getAttribute (int roundedNote) noexcept
+{
+	if constexpr (Attribute == NoteAttribute::PitchClass)
+		return pitchClassOfMidiNote (roundedNote);
+	else if constexpr (Attribute == NoteAttribute::OctaveNumber)
+		return octaveNumberOfMidiNote (roundedNote);
+	else
+		return roundedNote;
+}
+
+#if LHARM_SIMD_AVX2 || LHARM_SIMD_SSE2
+
+template <NoteAttribute Attribute>
+[[nodiscard]] inline SimdOps::Float getAttribute (SimdOps::Float roundedNotes) noexcept
+{
+	using S = SimdOps;
+
+	if constexpr (Attribute == NoteAttribute::PitchClass)
+		return S::sub (roundedNotes, S::mul (octavesAboveMidiZero (roundedNotes), S::set (static_cast<double> (semitonesInOctave))));
+	else if constexpr (Attribute == NoteAttribute::OctaveNumber)
+		return S::sub (octavesAboveMidiZero (roundedNotes), S::set (1.));
+	else
+		return roundedNotes;
+}
+
+#endif
+
+template <NoteAttribute Attribute>
+void writeAttributes (std::span<const Pitch> pitches, std::span<int> output) noexcept
+{
+	assert (output.size() >= pitches.size());
+
+	const auto num = pitches.size();
+
+	std::size_t i = 0;
+
+#if LHARM_SIMD_AVX2 || LHARM_SIMD_SSE2
+	using S = SimdOps;
+
+	const auto* const in = midiPitchData (pitches.data());
+
+	for (; i + S::width <= num; i += S::width)
+		S::storeInts (output.data() + i, getAttribute<Attribute> (roundHalfAwayFromZero (S::load (in + i))));
+#endif
+
+	for (; i < num; ++i)
+		output[i] = getAttribute<Attribute> (pitches[i].getRoundedMidiPitch());
+}
+
+template <bool BlackKeys>
+void writeKeyFlags (std::span<const Pitch> pitches, std::span<bool> output) noexcept
+{
+	assert (output.size() >= pitches.size());
+
+	const auto isMatchingKey = [] (int pitchClass)
+	{ return (((blackKeyMask >> static_cast<unsigned> (pitchClass)) & 1U) != 0) == BlackKeys; };
+
+	const auto num = pitches.size();
+
+	std::size_t i = 0;
+
+#if LHARM_SIMD_AVX2 || LHARM_SIMD_SSE2
+	using S = SimdOps;
+
+	const auto* const in = midiPitchData (pitches.data());
+
+	alignas (16) int pitchClasses[S::width];
+
+	for (; i + S::width <= num; i += S::width)
+	{
+		S::storeInts (pitchClasses, getAttribute<NoteAttribute::PitchClass> (roundHalfAwayFromZero (S::load (in + i))));
+
+		for (auto j = 0UL; j < S::width; ++j)
+			output[i + j] = isMatchingKey (pitchClasses[j]);
+	}
+#endif
+
+	for (; i < num; ++i)
+		output[i] = isMatchingKey (pitches[i].getPitchClass().getAsInt());
+}
+
+}  // namespace
+
+PitchBuffer::PitchBuffer (std::size_t numPitches, Pitch initialPitch)
+	: pitches (numPitches, initialPitch)
+{
+}
+
+PitchBuffer::PitchBuffer (std::initializer_list<Pitch> pitchesToUse)
+	: pitches (pitchesToUse)
+{
+}
+
+PitchBuffer::PitchBuffer (std::span<const Pitch> pitchesToUse)
+	: pitches (pitchesToUse.begin(), pitchesToUse.end())
+{
+}
+
+PitchBuffer::PitchBuffer (std::span<const double> midiPitches)
+{
+	pitches.reserve (midiPitches.size());
+
+	for (const auto midiPitch : midiPitches)
+		pitches.emplace_back (midiPitch);
+}
+
+bool PitchBuffer::operator== (const PitchBuffer& other) const noexcept
+{
+	return std::equal (pitches.begin(), pitches.end(), other.pitches.begin(), other.pitches.end());
+}
+
+bool PitchBuffer::operator!= (const PitchBuffer& other) const noexcept
+{
+	return ! (*this == other);
+}
+
+std::size_t PitchBuffer::size() const noexcept
+{
+	return pitches.size();
+}
+
+bool PitchBuffer::isEmpty() const noexcept
+{
+	return pitches.empty();
+}
+
+void PitchBuffer::reserve (std::size_t numPitches)
+{
+	pitches.reserve (numPitches);
+}
+
+void PitchBuffer::resize (std::size_t numPitches, Pitch newPitch)
+{
+	pitches.resize (numPitches, newPitch);
+}
+
+void PitchBuffer::clear() noexcept
+{
+	pitches.clear();
+}
+
+void PitchBuffer::add (Pitch pitch)
+{
+	pitches.push_back (pitch);
+}
+
+Pitch& PitchBuffer::operator[] (std::size_t index) noexcept
+{
+	assert (index < pitches.size());
+	return pitches[index];
+}
+
+const Pitch& PitchBuffer::operator[] (std::size_t index) const noexcept
+{
+	assert (index < pitches.size());
+	return pitches[index];
+}
+
+std::span<Pitch> PitchBuffer::getPitches() noexcept
+{
+	return pitches;
+}
+
+std::span<const Pitch> PitchBuffer::getPitches() const noexcept
+{
+	return pitches;
+}
+
+std::span<const double> PitchBuffer::getMidiPitches() const noexcept
+{
+	return { midiPitchData (pitches.data()), pitches.size() };
+}
+
+Pitch* PitchBuffer::begin() noexcept
+{
+	return pitches.data();
+}
+
+const Pitch* PitchBuffer::begin() const noexcept
+{
+	return pitches.data();
+}
+
+Pitch* PitchBuffer::end() noexcept
+{
+	return pitches.data() + pitches.size();
+}
+
+const Pitch* PitchBuffer::end() const noexcept
+{
+	return pitches.data() + pitches.size();
+}
+
+void PitchBuffer::transpose (double semitones) noexcept
+{
+	const auto num = pitches.size();
+
+	auto* const data = midiPitchData (pitches.data());
+
+	std::size_t i = 0;
+
+#if LHARM_SIMD_AVX2 || LHARM_SIMD_SSE2
+	using S = SimdOps;
+
+	const auto offset = S::set (semitones);
+
+	for (; i + S::width <= num; i += S::width)
+		S::store (data + i, S::add (S::load (data + i), offset));
+#endif
+
+	for (; i < num; ++i)
+		data[i] += semitones;
+}
+
+void PitchBuffer::transpose (const Interval& interval, bool above) noexcept
+{
+	const auto semitones = interval.getNumSemitones();
+
+	transpose (static_cast<double> (above ? semitones : -semitones));
+}
+
+void PitchBuffer::transpose (const CompoundInterval& interval, bool above) noexcept
+{
+	const auto semitones = interval.getNumSemitones();
+
+	transpose (static_cast<double> (above ? semitones : -semitones));
+}
+
+void PitchBuffer::transpose (const MicrotonalInterval& interval, bool above) noexcept
+{
+	const auto semitones = interval.getSemitones();
+
+	transpose (above ? semitones : -semitones);
+}
+
+void PitchBuffer::round() noexcept
+{
+	const auto num = pitches.size();
+
+	auto* const data = midiPitchData (pitches.data());
+
+	std::size_t i = 0;
+
+#if LHARM_SIMD_AVX2 || LHARM_SIMD_SSE2
+	using S = SimdOps;
+
+	for (; i + S::width <= num; i += S::width)
+		S::store (data + i, roundHalfAwayFromZero (S::load (data + i)));
+#endif
+
+	for (; i < num; ++i)
+		data[i] = static_cast<double> (roundToNearestInt (data[i]));
+}
+
+void PitchBuffer::getRoundedMidiPitches (std::span<int> output) const noexcept
+{
+	writeAttributes<NoteAttribute::RoundedNote> (pitches, output);
+}
+
+void PitchBuffer::getPitchClasses (std::span<int> output) const noexcept
+{
+	writeAttributes<NoteAttribute::PitchClass> (pitches, output);
+}
+
+void PitchBuffer::getOctaveNumbers (std::span<int> output) const noexcept
+{
+	writeAttributes<NoteAttribute::OctaveNumber> (pitches, output);
+}
+
+void PitchBuffer::getBlackKeyFlags (std::span<bool> output) const noexcept
+{
+	writeKeyFlags<true> (pitches, output);
+}
+
+void PitchBuffer::getWhiteKeyFlags (std::span<bool> output) const noexcept
+{
+	writeKeyFlags<false> (pitches, output);
+}
+
+}  // namespace limes::harmony
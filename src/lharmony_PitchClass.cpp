@@ -17,56 +17,6 @@
 namespace limes::harmony
 {
 
-// TODO: could use unicode flat/sharp characters...
-std::string_view PitchClass::getString (bool useSharps) const noexcept
-{
-	switch (pitchClass)
-	{
-		case (0) : return "C";
-		case (1) :
-		{
-			if (useSharps)
-				return "C#";
-
-			return "Db";
-		}
-		case (2) : return "D";
-		case (3) :
-		{
-			if (useSharps)
-				return "D#";
-
-			return "Eb";
-		}
-		case (4) : return "E";
-		case (5) : return "F";
-		case (6) :
-		{
-			if (useSharps)
-				return "F#";
-
-			return "Gb";
-		}
-		case (7) : return "G";
-		case (8) :
-		{
-			if (useSharps)
-				return "G#";
-
-			return "Ab";
-		}
-		case (9) : return "A";
-		case (10) :
-		{
-			if (useSharps)
-				return "A#";
-
-			return "Bb";
-		}
-		case (11) : return "B";
-	}
-}
-
 std::ostream& operator<< (std::ostream& os, const PitchClass& value)
 {
 	os << value.getString (true);
@@ -0,0 +1,230 @@
+/*
+ * ======================================================================================
+ *  __    ____  __  __  ____  ___
+ * (  )  (_  _)(  \/  )( ___)/ __)
+ *  )(__  _)(_  )    (  )__) \__ \
+ * (____)(____)(_/\/\_)(____)(___/
+ *
+ *  This file is part of the Limes open source library and is licensed under the terms of the GNU Public License.
+ *
+ *  Commercial licenses are available; contact the maintainers at ben.the.vining@gmail.com to inquire for details.
+ *
+ * ======================================================================================
+ */
+
+#include <limits>
+#include <string_view>
+#include <system_error>
+#include "lharmony/lharmony_PitchNames.h"
+
+namespace limes::harmony
+{
+
+namespace
+{
+
+using Letter = PitchSpelling::Letter;
+
+[[nodiscard]] constexpr bool isDigit (char c) noexcept
+{
+	return c >= '0' && c <= '9';
+}
+
+[[nodiscard]] constexpr bool parseLetter (char c, Letter& letter) noexcept
+{
+	switch (c)
+	{
+		case ('C') : [[fallthrough]];
+		case ('c') : letter = Letter::C; return true;
+		case ('D') : [[fallthrough]];
+		case ('d') : letter = Letter::D; return true;
+		case ('E') : [[fallthrough]];
+		case ('e') : letter = Letter::E; return true;
+		case ('F') : [[fallthrough]];
+		case ('f') : letter = Letter::F; return true;
+		case ('G') : [[fallthrough]];
+		case ('g') : letter = Letter::G; return true;
+		case ('A') : [[fallthrough]];
+		case ('a') : letter = Letter::A; return true;
+		case ('B') : [[fallthrough]];
+		case ('b') : letter = Letter::B; return true;
+		default : return false;
+	}
+}
+
+// parses an optional cents offset such as "+25c" or "-12.5c", returning nullptr if there isn't a valid one
+[[nodiscard]] const char* parseCents (const char* first, const char* last, double& cents) noexcept
+{
+	if (last - first < 3 || (*first != '+' && *first != '-') || ! isDigit (first[1]))
+		return nullptr;
+
+	double magnitude { 0. };
+
+	const auto result = std::from_chars (first + 1, last, magnitude, std::chars_format::fixed);
+
+	if (result.ec != std::errc {} || result.ptr == last || *result.ptr != 'c')
+		return nullptr;
+
+	cents = *first == '-' ? -magnitude : magnitude;
+
+	return result.ptr + 1;
+}
+
+[[nodiscard]] std::to_chars_result writeString (char* first, char* last, std::string_view string) noexcept
+{
+	if (last - first < static_cast<std::ptrdiff_t> (string.size()))
+		return { last, std::errc::value_too_large };
+
+	return { std::copy (string.begin(), string.end(), first), std::errc {} };
+}
+
+// writes the octave number, then the offset of the pitch from its nearest MIDI note in cents, if there is one
+[[nodiscard]] std::to_chars_result writeOctaveAndCents (char* first, char* last, int octave, const Pitch& pitch) noexcept
+{
+	const auto octaveResult = std::to_chars (first, last, octave);
+
+	if (octaveResult.ec != std::errc {})
+		return octaveResult;
+
+	const auto cents = roundToNearestInt ((pitch.getMidiPitch() - static_cast<double> (pitch.getRoundedMidiPitch())) * 100.);
+
+	if (cents == 0)
+		return octaveResult;
+
+	auto* ptr = octaveResult.ptr;
+
+	if (ptr == last)
+		return { last, std::errc::value_too_large };
+
+	*ptr++ = cents < 0 ? '-' : '+';
+
+	const auto centsResult = std::to_chars (ptr, last, cents < 0 ? -cents : cents);
+
+	if (centsResult.ec != std::errc {} || centsResult.ptr == last)
+		return { last, std::errc::value_too_large };
+
+	*centsResult.ptr = 'c';
+
+	return { centsResult.ptr + 1, std::errc {} };
+}
+
+}  // namespace
+
+std::from_chars_result fromChars (const char* first, const char* last, PitchSpelling& value) noexcept
+{
+	Letter letter;
+
+	if (first == last || ! parseLetter (*first, letter))
+		return { first, std::errc::invalid_argument };
+
+	auto* ptr = first + 1;
+
+	auto accidentals = 0;
+
+	if (ptr != last && *ptr == 'x')
+	{
+		accidentals = 2;
+		++ptr;
+	}
+	else
+	{
+		while (ptr != last && accidentals < PitchSpelling::maxAccidentals && -accidentals < PitchSpelling::maxAccidentals)
+		{
+			if (*ptr == '#' && accidentals >= 0)
+				++accidentals;
+			else if (*ptr == 'b' && accidentals <= 0)
+				--accidentals;
+			else
+				break;
+
+			++ptr;
+		}
+	}
+
+	value = PitchSpelling { letter, accidentals };
+
+	return { ptr, std::errc {} };
+}
+
+std::from_chars_result fromChars (const char* first, const char* last, PitchClass& value) noexcept
+{
+	PitchSpelling spelling;
+
+	const auto result = fromChars (first, last, spelling);
+
+	if (result.ec == std::errc {})
+		value = spelling.getPitchClass();
+
+	return result;
+}
+
+std::from_chars_result fromChars (const char* first, const char* last, Pitch& value) noexcept
+{
+	PitchSpelling spelling;
+
+	const auto spellingResult = fromChars (first, last, spelling);
+
+	if (spellingResult.ec != std::errc {})
+		return spellingResult;
+
+	auto octave = 0;
+
+	const auto octaveResult = std::from_chars (spellingResult.ptr, last, octave);
+
+	if (octaveResult.ec == std::errc::invalid_argument)
+		return { first, std::errc::invalid_argument };
+
+	// the written octave may be one away from the MIDI octave, so leave room for that too
+	constexpr auto maxOctave = std::numeric_limits<int>::max() / semitonesInOctave - 2;
+	constexpr auto minOctave = std::numeric_limits<int>::min() / semitonesInOctave + 1;
+
+	if (octaveResult.ec == std::errc::result_out_of_range || octave > maxOctave || octave < minOctave)
+		return { octaveResult.ptr, std::errc::result_out_of_range };
+
+	const auto midiNote = static_cast<double> (spelling.getMidiNote (octave));
+
+	double cents { 0. };
+
+	if (const auto* centsEnd = parseCents (octaveResult.ptr, last, cents))
+	{
+		value = Pitch { midiNote + cents / 100. };
+		return { centsEnd, std::errc {} };
+	}
+
+	value = Pitch { midiNote };
+	return { octaveResult.ptr, std::errc {} };
+}
+
+std::to_chars_result toChars (char* first, char* last, const PitchSpelling& value) noexcept
+{
+	return writeString (first, last, value.getString());
+}
+
+std::to_chars_result toChars (char* first, char* last, const PitchClass& value, bool useSharps) noexcept
+{
+	return writeString (first, last, value.getString (useSharps));
+}
+
+std::to_chars_result toChars (char* first, char* last, const Pitch& value, bool useSharps) noexcept
+{
+	const auto nameResult = toChars (first, last, value.getPitchClass(), useSharps);
+
+	if (nameResult.ec != std::errc {})
+		return nameResult;
+
+	return writeOctaveAndCents (nameResult.ptr, last, value.getOctaveNumber(), value);
+}
+
+std::to_chars_result toChars (char* first, char* last, const Pitch& value, const PitchSpeller& speller) noexcept
+{
+	const auto spelling = speller.spell (value);
+
+	const auto nameResult = toChars (first, last, spelling);
+
+	if (nameResult.ec != std::errc {})
+		return nameResult;
+
+	return writeOctaveAndCents (nameResult.ptr, last, spelling.getOctaveNumber (value.getRoundedMidiPitch()), value);
+}
+
+}  // namespace limes::harmony
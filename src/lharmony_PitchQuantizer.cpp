@@ -0,0 +1,266 @@
+/*
+ * ======================================================================================
+ *  __    ____  __  __  ____  ___
+ * (  )  (_  _)(  \/  )( ___)/ __)
+ *  )(__  _)(_  )    (  )__) \__ \
+ * (____)(____)(_/\/\_)(____)(___/
+ *
+ *  This file is part of the Limes open source library and is licensed under the terms of the GNU Public License.
+ *
+ *  Commercial licenses are available; contact the maintainers at ben.the.vining@gmail.com to inquire for details.
+ *
+ * ======================================================================================
+ */
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include "lharmony/lharmony_PitchQuantizer.h"
+#include "lharmony_SimdOps.h"
+
+namespace limes::harmony
+{
+
+namespace
+{
+
+constexpr auto numCells = static_cast<std::size_t> (2 * semitonesInOctave);
+
+// the index of the half-semitone cell of the octave that a position within the octave falls in.
+// Rounding may put a value just below the next octave's C at 12, which belongs in the last cell.
+[[nodiscard]] inline std::size_t cellOf (double semitonesAboveC) noexcept
+{
+	return std::min (static_cast<std::size_t> (std::max (semitonesAboveC * 2., 0.)), numCells - 1);
+}
+
+[[nodiscard]] inline double keepOrMove (double input, double held, double nearest, double hysteresis) noexcept
+{
+	// comparisons with NaN are false, so a NaN previous value always moves to the nearest target
+	return std::abs (input - held) <= std::abs (input - nearest) + hysteresis ? held : nearest;
+}
+
+#if LHARM_SIMD_AVX2 || LHARM_SIMD_SSE2
+
+using SimdOps = detail::SimdOps;
+
+// valid for magnitudes less than 2^51
+[[nodiscard]] inline SimdOps::Float floorOf (SimdOps::Float x) noexcept
+{
+	using S = SimdOps;
+
+	const auto magic   = S::set (detail::roundingMagic);
+	const auto nearest = S::sub (S::add (x, magic), magic);
+
+	return S::sub (nearest, S::bitAnd (S::greaterThan (nearest, x), S::set (1.)));
+}
+
+[[nodiscard]] inline SimdOps::Float absOf (SimdOps::Float x) noexcept
+{
+	return SimdOps::bitAndNot (SimdOps::set (-0.), x);
+}
+
+[[nodiscard]] inline SimdOps::Float select (SimdOps::Float mask, SimdOps::Float ifTrue, SimdOps::Float ifFalse) noexcept
+{
+	return SimdOps::bitOr (SimdOps::bitAnd (mask, ifTrue), SimdOps::bitAndNot (mask, ifFalse));
+}
+
+#endif
+
+}  // namespace
+
+PitchQuantizer::PitchQuantizer (int divisionsOfOctave) noexcept
+	: stepsPerSemitone (static_cast<double> (divisionsOfOctave) / static_cast<double> (semitonesInOctave)),
+	  semitonesPerStep (static_cast<double> (semitonesInOctave) / static_cast<double> (divisionsOfOctave))
+{
+	assert (divisionsOfOctave > 0);
+}
+
+PitchQuantizer::PitchQuantizer (const PitchClassSet& pitchClasses) noexcept
+	: usesScale (true)
+{
+	assert (! pitchClasses.isEmpty());
+
+	for (auto cell = 0UL; cell < numCells; ++cell)
+	{
+		// the nearest target to the middle of the cell; cell boundaries are at every half semitone, and so are the midpoints between targets,
+		// so this is the nearest target to every value in the cell. Halfway values are at the bottom of a cell, so they go up.
+		const auto middle = (static_cast<double> (cell) + 0.5) * 0.5;
+
+		auto nearest = std::numeric_limits<double>::max();
+
+		for (const auto pc : pitchClasses)
+		{
+			for (const auto octave : { -1, 0, 1 })
+			{
+				const auto target = static_cast<double> (pc.getAsInt() + octave * semitonesInOctave);
+
+				if (std::abs (target - middle) < std::abs (nearest - middle))
+					nearest = target;
+			}
+		}
+
+		scaleTargets[cell] = nearest;
+	}
+}
+
+PitchQuantizer::PitchQuantizer (const scales::Scale& scale)
+	: PitchQuantizer (scale.getPitchClassSet())
+{
+}
+
+void PitchQuantizer::setHysteresis (double cents) noexcept
+{
+	assert (cents >= 0.);
+
+	hysteresisSemitones = cents / 100.;
+}
+
+double PitchQuantizer::getHysteresis() const noexcept
+{
+	return hysteresisSemitones * 100.;
+}
+
+template <bool UseScale>
+double PitchQuantizer::getNearestTarget (double midiPitch) const noexcept
+{
+	if constexpr (UseScale)
+	{
+		const auto octaveStart = std::floor (midiPitch / static_cast<double> (semitonesInOctave)) * static_cast<double> (semitonesInOctave);
+
+		return octaveStart + scaleTargets[cellOf (midiPitch - octaveStart)];
+	}
+	else
+	{
+		return std::floor (midiPitch * stepsPerSemitone + 0.5) * semitonesPerStep;
+	}
+}
+
+double PitchQuantizer::quantize (double midiPitch) const noexcept
+{
+	if (usesScale)
+		return getNearestTarget<true> (midiPitch);
+
+	return getNearestTarget<false> (midiPitch);
+}
+
+Pitch PitchQuantizer::quantize (Pitch pitch) const noexcept
+{
+	return Pitch { quantize (pitch.getMidiPitch()) };
+}
+
+template <bool UseScale, bool UseHysteresis>
+void PitchQuantizer::process (const double* input, double* output, double* deviations, std::size_t num) const noexcept
+{
+	std::size_t i = 0;
+
+#if LHARM_SIMD_AVX2 || LHARM_SIMD_SSE2
+	using S = SimdOps;
+
+	const auto octave		= S::set (static_cast<double> (semitonesInOctave));
+	const auto stepsPerSemi	= S::set (stepsPerSemitone);
+	const auto semisPerStep	= S::set (semitonesPerStep);
+	const auto half			= S::set (0.5);
+	const auto centsPerSemi	= S::set (100.);
+	const auto hysteresis	= S::set (hysteresisSemitones);
+	const auto firstCell	= S::set (0.);
+	const auto lastCell		= S::set (static_cast<double> (numCells - 1));
+
+	alignas (16) int cells[S::width];
+	alignas (32) double offsets[S::width];
+
+	for (; i + S::width <= num; i += S::width)
+	{
+		const auto x = S::load (input + i);
+
+		S::Float nearest;
+
+		if constexpr (UseScale)
+		{
+			const auto octaveStart = S::mul (floorOf (S::div (x, octave)), octave);
+
+			// the same clamping as cellOf()
+			auto cell = floorOf (S::add (S::sub (x, octaveStart), S::sub (x, octaveStart)));
+			cell	  = select (S::lessThan (cell, firstCell), firstCell, cell);
+			cell	  = select (S::greaterThan (cell, lastCell), lastCell, cell);
+
+			S::storeInts (cells, cell);
+
+			for (auto j = 0UL; j < S::width; ++j)
+				offsets[j] = scaleTargets[static_cast<std::size_t> (cells[j])];
+
+			nearest = S::add (octaveStart, S::load (offsets));
+		}
+		else
+		{
+			nearest = S::mul (floorOf (S::add (S::mul (x, stepsPerSemi), half)), semisPerStep);
+		}
+
+		auto quantized = nearest;
+
+		if constexpr (UseHysteresis)
+		{
+			const auto held = S::load (output + i);
+
+			quantized = select (S::lessOrEqual (absOf (S::sub (x, held)), S::add (absOf (S::sub (x, nearest)), hysteresis)), held, nearest);
+		}
+
+		S::store (output + i, quantized);
+
+		if (deviations != nullptr)
+			S::store (deviations + i, S::mul (S::sub (x, quantized), centsPerSemi));
+	}
+#endif
+
+	for (; i < num; ++i)
+	{
+		const auto x = input[i];
+
+		auto quantized = getNearestTarget<UseScale> (x);
+
+		if constexpr (UseHysteresis)
+			quantized = keepOrMove (x, output[i], quantized, hysteresisSemitones);
+
+		output[i] = quantized;
+
+		if (deviations != nullptr)
+			deviations[i] = (x - quantized) * 100.;
+	}
+}
+
+void PitchQuantizer::quantize (std::span<const double> midiPitches, std::span<double> quantizedPitches, std::span<double> deviationsInCents) const noexcept
+{
+	assert (quantizedPitches.size() >= midiPitches.size());
+	assert (deviationsInCents.empty() || deviationsInCents.size() >= midiPitches.size());
+
+	auto* const deviations = deviationsInCents.empty() ? nullptr : deviationsInCents.data();
+
+	if (usesScale)
+		process<true, false> (midiPitches.data(), quantizedPitches.data(), deviations, midiPitches.size());
+	else
+		process<false, false> (midiPitches.data(), quantizedPitches.data(), deviations, midiPitches.size());
+}
+
+void PitchQuantizer::quantize (PitchBuffer& pitches, std::span<double> deviationsInCents) const noexcept
+{
+	// the buffer's pitches are a contiguous array of doubles, so they can be quantized in place
+	auto* const midiPitches = reinterpret_cast<double*> (pitches.getPitches().data());	// NOLINT
+
+	quantize (std::span<const double> { midiPitches, pitches.size() }, std::span<double> { midiPitches, pitches.size() }, deviationsInCents);
+}
+
+void PitchQuantizer::quantizeWithHysteresis (std::span<const double> midiPitches, std::span<double> quantizedPitches, std::span<double> deviationsInCents) const noexcept
+{
+	assert (quantizedPitches.size() >= midiPitches.size());
+	assert (deviationsInCents.empty() || deviationsInCents.size() >= midiPitches.size());
+
+	auto* const deviations = deviationsInCents.empty() ? nullptr : deviationsInCents.data();
+
+	if (usesScale)
+		process<true, true> (midiPitches.data(), quantizedPitches.data(), deviations, midiPitches.size());
+	else
+		process<false, true> (midiPitches.data(), quantizedPitches.data(), deviations, midiPitches.size());
+}
+
+}  // namespace limes::harmony
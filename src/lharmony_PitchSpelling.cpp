@@ -0,0 +1,54 @@
+/*
+ * ======================================================================================
+ *  __    ____  __  __  ____  ___
+ * (  )  (_  _)(  \/  )( ___)/ __)
+ *  )(__  _)(_  )    (  )__) \__ \
+ * (____)(____)(_/\/\_)(____)(___/
+ *
+ *  This file is part of the Limes open source library and is licensed under the terms of the GNU Public License.
+ *
+ *  Commercial licenses are available; contact the maintainers at ben.the.vining@gmail.com to inquire for details.
+ *
+ * ======================================================================================
+ */
+
+#include <algorithm>
+#include <cassert>
+#include "lharmony/lharmony_PitchSpelling.h"
+
+namespace limes::harmony
+{
+
+namespace
+{
+
+[[nodiscard]] constexpr bool isValidLowestFifth (int lowestFifth) noexcept
+{
+	return lowestFifth >= detail::minLowestFifth && lowestFifth <= detail::maxLowestFifth;
+}
+
+static_assert (std::ranges::all_of (detail::keySignatureLowestFifths, isValidLowestFifth));
+static_assert (std::ranges::all_of (detail::modeLowestFifths, isValidLowestFifth));
+
+}  // namespace
+
+std::ostream& operator<< (std::ostream& os, const PitchSpelling& spelling)
+{
+	os << spelling.getString();
+	return os;
+}
+
+void PitchSpeller::spell (std::span<const Pitch> pitches, std::span<PitchSpelling> output) const noexcept
+{
+	assert (output.size() >= pitches.size());
+
+	for (auto i = 0UL; i < pitches.size(); ++i)
+		output[i] = spell (pitches[i]);
+}
+
+void PitchSpeller::spell (const PitchBuffer& pitches, std::span<PitchSpelling> output) const noexcept
+{
+	spell (pitches.getPitches(), output);
+}
+
+}  // namespace limes::harmony
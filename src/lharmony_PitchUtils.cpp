@@ -0,0 +1,235 @@
+/*
+ * ======================================================================================
+ *  __    ____  __  __  ____  ___
+ * (  )  (_  _)(  \/  )( ___)/ __)
+ *  )(__  _)(_  )    (  )__) \__ \
+ * (____)(____)(_/\/\_)(____)(___/
+ *
+ *  This file is part of the Limes open source library and is licensed under the terms of the GNU Public License.
+ *
+ *  Commercial licenses are available; contact the maintainers at ben.the.vining@gmail.com to inquire for details.
+ *
+ * ======================================================================================
+ */
+
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include "lharmony/lharmony_PitchUtils.h"
+#include "lharmony_SimdOps.h"
+
+namespace limes::harmony
+{
+
+namespace
+{
+
+// Series for atanh(s) / s = 1 + s^2/3 + s^4/5 + ..., highest power first, as a polynomial in s^2.
+// With the mantissa reduced to [sqrt(0.5), sqrt(2)), |s| <= 0.1716 and the truncation error is below 1e-19.
+constexpr std::array<double, 11> atanhCoefficients {
+	1.0 / 21.0, 1.0 / 19.0, 1.0 / 17.0, 1.0 / 15.0, 1.0 / 13.0, 1.0 / 11.0,
+	1.0 / 9.0, 1.0 / 7.0, 1.0 / 5.0, 1.0 / 3.0, 1.0
+};
+
+static_assert (atanhCoefficients.size() % 2 == 1, "log2() splits this polynomial into even and odd powers");
+
+constexpr auto log2e = 1.4426950408889634;
+
+// 2^52: or-ing a small integer into this double's mantissa and subtracting 2^52 converts the integer to a double
+constexpr auto twoToThe52 = 4503599627370496.0;
+
+#if LHARM_SIMD_AVX2 || LHARM_SIMD_SSE2
+
+using SimdOps = detail::SimdOps;
+
+template <std::size_t NumCoefficients>
+[[nodiscard]] inline SimdOps::Float evaluatePolynomial (SimdOps::Float x, const std::array<double, NumCoefficients>& coefficients) noexcept
+{
+	auto result = SimdOps::set (coefficients[0]);
+
+	for (auto i = 1UL; i < NumCoefficients; ++i)
+		result = SimdOps::mulAdd (result, x, SimdOps::set (coefficients[i]));
+
+	return result;
+}
+
+// 2^x, for x well inside the range of normal doubles
+template <ConversionAccuracy Accuracy>
+[[nodiscard]] inline SimdOps::Float exp2 (SimdOps::Float x) noexcept
+{
+	using S = SimdOps;
+
+	// split x into an integer n and a fraction f in [-0.5, 0.5]
+	const auto shifted	= S::add (x, S::set (detail::roundingMagic));
+	const auto integer	= S::sub (shifted, S::set (detail::roundingMagic));
+	const auto fraction = S::sub (x, integer);
+
+	// the low bits of 'shifted' hold n as an integer; move n + 1023 into the exponent field to build 2^n
+	const auto exponentBits = S::shiftLeft52 (S::addInt (S::toBits (shifted), S::setInt (1023)));
+
+	return S::mul (evaluatePolynomial (fraction, detail::exp2Coefficients<Accuracy>()), S::fromBits (exponentBits));
+}
+
+// log2 (x), for positive normal x
+template <ConversionAccuracy Accuracy>
+[[nodiscard]] inline SimdOps::Float log2 (SimdOps::Float x) noexcept
+{
+	using S = SimdOps;
+
+	const auto bits = S::toBits (x);
+
+	// biased exponent, converted to a double by or-ing it into the mantissa of 2^52
+	const auto biasedExponent = S::sub (S::bitOr (S::fromBits (S::shiftRight52 (bits)), S::set (twoToThe52)),
+										S::set (twoToThe52));
+
+	auto exponent = S::sub (biasedExponent, S::set (1023.));
+
+	// mantissa in [1, 2)
+	const auto mantissaMask = S::fromBits (S::setInt (0x000FFFFFFFFFFFFFLL));
+	auto	   mantissa		= S::bitOr (S::bitAnd (x, mantissaMask), S::set (1.));
+
+	// reduce the mantissa to [sqrt(0.5), sqrt(2)) to keep the series argument small
+	const auto tooBig = S::greaterThan (mantissa, S::set (detail::sqrt2));
+
+	mantissa = S::bitOr (S::bitAnd (tooBig, S::mul (mantissa, S::set (0.5))), S::bitAndNot (tooBig, mantissa));
+	exponent = S::add (exponent, S::bitAnd (tooBig, S::set (1.)));
+
+	if constexpr (Accuracy != ConversionAccuracy::Exact)
+	{
+		return S::add (exponent, evaluatePolynomial (S::sub (mantissa, S::set (1.)), detail::log2Coefficients<Accuracy>()));
+	}
+	else
+	{
+		// ln(m) = 2 atanh(s), where s = (m - 1) / (m + 1)
+		const auto s = S::div (S::sub (mantissa, S::set (1.)), S::add (mantissa, S::set (1.)));
+
+		const auto s2 = S::mul (s, s);
+		const auto s4 = S::mul (s2, s2);
+
+		// evaluate the even and odd powers of s^2 as two independent chains, which roughly halves the latency
+		auto even = S::set (atanhCoefficients[0]);
+		auto odd  = S::set (atanhCoefficients[1]);
+
+		for (auto i = 2UL; i + 1 < atanhCoefficients.size(); i += 2)
+		{
+			even = S::mulAdd (even, s4, S::set (atanhCoefficients[i]));
+			odd	 = S::mulAdd (odd, s4, S::set (atanhCoefficients[i + 1]));
+		}
+
+		even = S::mulAdd (even, s4, S::set (atanhCoefficients.back()));
+
+		const auto lnMantissa = S::mul (S::mul (S::set (2.), s), S::mulAdd (odd, s2, even));
+
+		return S::mulAdd (lnMantissa, S::set (log2e), exponent);
+	}
+}
+
+#endif
+
+template <ConversionAccuracy Accuracy>
+void convertMidiToFreq (std::span<const double> midiNotes, std::span<double> freqsHz) noexcept
+{
+	const auto num = midiNotes.size();
+
+	std::size_t i = 0;
+
+#if LHARM_SIMD_AVX2 || LHARM_SIMD_SSE2
+	using S = SimdOps;
+
+	const auto* const in  = midiNotes.data();
+	auto* const		  out = freqsHz.data();
+
+	for (; i + S::width <= num; i += S::width)
+	{
+		const auto octaves = S::div (S::sub (S::load (in + i), S::set (69.)), S::set (12.));
+
+		// also rejects NaNs, because ordered comparisons with NaN are false
+		const auto absOctaves = S::bitAndNot (S::set (-0.), octaves);
+
+		if (S::laneMask (S::lessOrEqual (absOctaves, S::set (detail::maxExp2Argument))) != S::allLanesMask)
+		{
+			for (auto j = i; j < i + S::width; ++j)
+				freqsHz[j] = midiToFreq<Accuracy> (midiNotes[j]);
+
+			continue;
+		}
+
+		S::store (out + i, S::mul (exp2<Accuracy> (octaves), S::set (440.)));
+	}
+#endif
+
+	for (; i < num; ++i)
+		freqsHz[i] = midiToFreq<Accuracy> (midiNotes[i]);
+}
+
+template <ConversionAccuracy Accuracy>
+void convertFreqToMidi (std::span<const double> freqsHz, std::span<double> midiNotes) noexcept
+{
+	const auto num = freqsHz.size();
+
+	std::size_t i = 0;
+
+#if LHARM_SIMD_AVX2 || LHARM_SIMD_SSE2
+	using S = SimdOps;
+
+	// with only two lanes, the full-precision log2 kernel is no faster than the C library's, so SSE2 builds use the scalar loop
+	if constexpr (Accuracy != ConversionAccuracy::Exact || S::width >= 4)
+	{
+		const auto* const in  = freqsHz.data();
+		auto* const		  out = midiNotes.data();
+
+		for (; i + S::width <= num; i += S::width)
+		{
+			const auto freqs = S::load (in + i);
+
+			// zero, negative, subnormal, infinite and NaN inputs are handled by the scalar path
+			const auto isNormal = S::bitAnd (S::greaterOrEqual (freqs, S::set (std::numeric_limits<double>::min())),
+											 S::lessOrEqual (freqs, S::set (std::numeric_limits<double>::max())));
+
+			if (S::laneMask (isNormal) != S::allLanesMask)
+			{
+				for (auto j = i; j < i + S::width; ++j)
+					midiNotes[j] = freqToMidi<Accuracy> (freqsHz[j]);
+
+				continue;
+			}
+
+			S::store (out + i, S::mulAdd (S::sub (log2<Accuracy> (freqs), S::set (detail::log2Of440)), S::set (12.), S::set (69.)));
+		}
+	}
+#endif
+
+	for (; i < num; ++i)
+		midiNotes[i] = freqToMidi<Accuracy> (freqsHz[i]);
+}
+
+}  // namespace
+
+void midiToFreq (std::span<const double> midiNotes, std::span<double> freqsHz, ConversionAccuracy accuracy) noexcept
+{
+	assert (freqsHz.size() >= midiNotes.size());
+
+	switch (accuracy)
+	{
+		case (ConversionAccuracy::Cent) : convertMidiToFreq<ConversionAccuracy::Cent> (midiNotes, freqsHz); return;
+		case (ConversionAccuracy::TenthOfCent) : convertMidiToFreq<ConversionAccuracy::TenthOfCent> (midiNotes, freqsHz); return;
+		default : convertMidiToFreq<ConversionAccuracy::Exact> (midiNotes, freqsHz); return;
+	}
+}
+
+void freqToMidi (std::span<const double> freqsHz, std::span<double> midiNotes, ConversionAccuracy accuracy) noexcept
+{
+	assert (midiNotes.size() >= freqsHz.size());
+
+	switch (accuracy)
+	{
+		case (ConversionAccuracy::Cent) : convertFreqToMidi<ConversionAccuracy::Cent> (freqsHz, midiNotes); return;
+		case (ConversionAccuracy::TenthOfCent) : convertFreqToMidi<ConversionAccuracy::TenthOfCent> (freqsHz, midiNotes); return;
+		default : convertFreqToMidi<ConversionAccuracy::Exact> (freqsHz, midiNotes); return;
+	}
+}
+
+}  // namespace limes::harmony
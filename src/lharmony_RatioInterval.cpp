@@ -0,0 +1,49 @@
+/*
+ * ======================================================================================
+ *  __    ____  __  __  ____  ___
+ * (  )  (_  _)(  \/  )( ___)/ __)
+ *  )(__  _)(_  )    (  )__) \__ \
+ * (____)(____)(_/\/\_)(____)(___/
+ *
+ *  This file is part of the Limes open source library and is licensed under the terms of the GNU Public License.
+ *
+ *  Commercial licenses are available; contact the maintainers at ben.the.vining@gmail.com to inquire for details.
+ *
+ * ======================================================================================
+ */
+
+#include <sstream>
+#include <stdexcept>
+#include "lharmony/lharmony_RatioInterval.h"
+
+namespace limes::harmony
+{
+
+void RatioInterval::throwInvalidRatio (std::uint64_t numeratorToUse, std::uint64_t denominatorToUse)
+{
+	std::stringstream str;
+	str << "RatioInterval: invalid ratio " << numeratorToUse << '/' << denominatorToUse << " - the numerator and denominator must be greater than 0";
+	throw std::invalid_argument { str.str() };
+}
+
+void RatioInterval::throwOverflow (const char* operation)
+{
+	std::stringstream str;
+	str << "RatioInterval: " << operation << " overflowed - the result does not fit in 64 bits";
+	throw std::overflow_error { str.str() };
+}
+
+std::string RatioInterval::getStringDescription() const
+{
+	std::stringstream stream;
+	stream << numerator << '/' << denominator;
+	return stream.str();
+}
+
+std::ostream& operator<< (std::ostream& os, const RatioInterval& value)
+{
+	os << value.getStringDescription();
+	return os;
+}
+
+}  // namespace limes::harmony
@@ -0,0 +1,204 @@
+/*
+ * ======================================================================================
+ *  __    ____  __  __  ____  ___
+ * (  )  (_  _)(  \/  )( ___)/ __)
+ *  )(__  _)(_  )    (  )__) \__ \
+ * (____)(____)(_/\/\_)(____)(___/
+ *
+ *  This file is part of the Limes open source library and is licensed under the terms of the GNU Public License.
+ *
+ *  Commercial licenses are available; contact the maintainers at ben.the.vining@gmail.com to inquire for details.
+ *
+ * ======================================================================================
+ */
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <numeric>
+#include "lharmony/lharmony_RatioRecognizer.h"
+
+namespace limes::harmony
+{
+
+namespace
+{
+
+// the number of frequencies converted to cents at a time by the batch function
+constexpr std::size_t blockSize = 256;
+
+[[nodiscard]] constexpr bool isAugmentedOrDiminished (const Interval& interval) noexcept
+{
+	const auto quality = interval.getQuality();
+
+	return quality == Interval::Quality::Augmented || quality == Interval::Quality::Diminished;
+}
+
+// an octave-reduced ratio from 1/1 to 2/1 spelled by the interval that lists it as a just ratio, or by the nearest interval in equal temperament
+[[nodiscard]] Interval spell (const RatioInterval& ratio) noexcept
+{
+	auto found	  = false;
+	auto spelling = Interval {};
+
+	for (auto index = 0UL; index < Interval::numDenseIndices; ++index)
+	{
+		const auto interval = Interval::fromDenseIndex (index);
+
+		const auto ratios = interval.getJustRatios();
+
+		if (std::none_of (ratios.begin(), ratios.end(), [&ratio] (const JustRatio& r) { return RatioInterval { r } == ratio; }))
+			continue;
+
+		if (! found || (isAugmentedOrDiminished (spelling) && ! isAugmentedOrDiminished (interval)))
+			spelling = interval;
+
+		found = true;
+	}
+
+	if (found)
+		return spelling;
+
+	return Interval::fromNumSemitones (static_cast<int> (std::lround (ratio.getSemitones())));
+}
+
+}  // namespace
+
+RatioRecognizer::RatioRecognizer (std::uint64_t primeLimitToUse, double toleranceCentsToUse, std::uint64_t maxTermToUse)
+	: primeLimit (primeLimitToUse), maxTerm (maxTermToUse), toleranceCents (toleranceCentsToUse)
+{
+	assert (primeLimit >= 2);
+	assert (toleranceCents >= 0.);
+	assert (maxTerm >= 2 && maxTerm <= 1024);
+
+	// 2/1 is added once, at the end
+	for (std::uint64_t denominator = 1; denominator <= maxTerm; ++denominator)
+	{
+		if (! RatioInterval { denominator, 1 }.isWithinPrimeLimit (primeLimit))
+			continue;
+
+		for (auto numerator = denominator; numerator < std::min (2 * denominator, maxTerm + 1); ++numerator)
+			if (std::gcd (numerator, denominator) == 1 && RatioInterval { numerator, 1 }.isWithinPrimeLimit (primeLimit))
+				candidates.emplace_back (numerator, denominator);
+	}
+
+	candidates.emplace_back (2, 1);
+
+	std::sort (candidates.begin(), candidates.end());
+
+	candidateCents.reserve (candidates.size());
+	candidateSpellings.reserve (candidates.size());
+
+	for (const auto& candidate : candidates)
+	{
+		candidateCents.push_back (candidate.getCents());
+		candidateSpellings.push_back (spell (candidate));
+	}
+
+	firstCandidateByCent.resize (centsPerOctave + 1);
+
+	for (auto cent = 0UL; cent <= centsPerOctave; ++cent)
+	{
+		const auto first = std::lower_bound (candidateCents.begin(), candidateCents.end(), static_cast<double> (cent));
+
+		firstCandidateByCent[cent] = static_cast<std::uint32_t> (std::distance (candidateCents.begin(), first));
+	}
+}
+
+RatioRecognizer::Result RatioRecognizer::recognizeCents (double cents) const noexcept
+{
+	cents = std::abs (cents);
+
+	if (! std::isfinite (cents))
+		return { RatioInterval {}, CompoundInterval {}, cents, false };
+
+	const auto octaves = std::floor (cents / static_cast<double> (centsPerOctave));
+
+	// rounding can leave a value a hair outside the octave
+	const auto withinOctave = std::clamp (cents - octaves * static_cast<double> (centsPerOctave), 0., static_cast<double> (centsPerOctave));
+
+	// the first candidate not smaller than the measured size; the last candidate is 2/1, so this never runs off the end
+	auto upper = static_cast<std::size_t> (firstCandidateByCent[static_cast<std::size_t> (withinOctave)]);
+
+	while (candidateCents[upper] < withinOctave)
+		++upper;
+
+	// halfway values go to the larger ratio
+	const auto nearest = (upper > 0 && withinOctave - candidateCents[upper - 1] < candidateCents[upper] - withinOctave) ? upper - 1 : upper;
+
+	const auto error = withinOctave - candidateCents[nearest];
+
+	const auto& candidate = candidates[nearest];
+
+	// check the octaves before converting them, since the conversion is undefined for sizes that don't fit in an int
+	if (octaves > 62.)
+		return { RatioInterval {}, CompoundInterval {}, error, false };
+
+	const auto numOctaves = static_cast<int> (octaves);
+
+	if (static_cast<int> (std::bit_width (candidate.getNumerator())) + numOctaves > 64)
+		return { RatioInterval {}, CompoundInterval {}, error, false };
+
+	return { RatioInterval { candidate.getNumerator() << numOctaves, candidate.getDenominator() },
+			 CompoundInterval { numOctaves, candidateSpellings[nearest] },
+			 error,
+			 std::abs (error) <= toleranceCents };
+}
+
+RatioRecognizer::Result RatioRecognizer::recognize (double firstFreqHz, double secondFreqHz) const noexcept
+{
+	return recognizeCents (ratioToCents (secondFreqHz / firstFreqHz));
+}
+
+RatioRecognizer::Result RatioRecognizer::recognize (const MicrotonalInterval& interval) const noexcept
+{
+	return recognizeCents (interval.getCents());
+}
+
+void RatioRecognizer::recognize (std::span<const double> firstFreqsHz, std::span<const double> secondFreqsHz, std::span<Result> results,
+								 ConversionAccuracy accuracy) const noexcept
+{
+	assert (secondFreqsHz.size() >= firstFreqsHz.size());
+	assert (results.size() >= firstFreqsHz.size());
+
+	std::array<double, blockSize> firstNotes {}, secondNotes {};
+
+	for (std::size_t start = 0; start < firstFreqsHz.size(); start += blockSize)
+	{
+		const auto num = std::min (blockSize, firstFreqsHz.size() - start);
+
+		const auto first  = std::span { firstNotes }.first (num);
+		const auto second = std::span { secondNotes }.first (num);
+
+		// the difference between two MIDI pitches is their ratio in semitones
+		freqToMidi (firstFreqsHz.subspan (start, num), first, accuracy);
+		freqToMidi (secondFreqsHz.subspan (start, num), second, accuracy);
+
+		for (auto i = 0UL; i < num; ++i)
+			results[start + i] = recognizeCents ((second[i] - first[i]) * 100.);
+	}
+}
+
+std::span<const RatioInterval> RatioRecognizer::getCandidates() const noexcept
+{
+	return candidates;
+}
+
+std::uint64_t RatioRecognizer::getPrimeLimit() const noexcept
+{
+	return primeLimit;
+}
+
+double RatioRecognizer::getToleranceCents() const noexcept
+{
+	return toleranceCents;
+}
+
+std::uint64_t RatioRecognizer::getMaxTerm() const noexcept
+{
+	return maxTerm;
+}
+
+}  // namespace limes::harmony
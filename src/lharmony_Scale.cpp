@@ -18,6 +18,7 @@
 #include "lharmony/lharmony_Interval.h"
 #include "lharmony/lharmony_Pitch.h"
 #include "lharmony/lharmony_PitchClass.h"
+#include "lharmony/lharmony_PitchClassSet.h"
 
 namespace limes::harmony::scales
 {
@@ -56,9 +57,7 @@ bool Scale::containsPitch (int midiNoteNumber) const
 
 bool Scale::containsPitchClass (PitchClass pitchClass) const
 {
-	const auto pitchClasses = getPitchClasses();
-
-	return std::find (std::begin (pitchClasses), std::end (pitchClasses), pitchClass) != std::end (pitchClasses);
+	return getPitchClassSet().contains (pitchClass);
 }
 
 std::vector<PitchClass> Scale::getPitchClasses() const
@@ -78,6 +77,21 @@ std::vector<PitchClass> Scale::getPitchClasses() const
 	return pitchClasses;
 }
 
+PitchClassSet Scale::getPitchClassSet() const
+{
+	auto lastPitchClass = getPitchClassOfRoot();
+
+	PitchClassSet set { lastPitchClass };
+
+	for (auto semitones : getIntervalsAsSemitones())
+	{
+		lastPitchClass += semitones;
+		set.add (lastPitchClass);
+	}
+
+	return set;
+}
+
 std::vector<Pitch> Scale::getPitches (int octaveNumber) const
 {
 	const auto startingNote = [this, octaveNumber]
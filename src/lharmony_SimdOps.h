@@ -0,0 +1,156 @@
+/*
+ * ======================================================================================
+ *  __    ____  __  __  ____  ___
+ * (  )  (_  _)(  \/  )( ___)/ __)
+ *  )(__  _)(_  )    (  )__) \__ \
+ * (____)(____)(_/\/\_)(____)(___/
+ *
+ *  This file is part of the Limes open source library and is licensed under the terms of the GNU Public License.
+ *
+ *  Commercial licenses are available; contact the maintainers at ben.the.vining@gmail.com to inquire for details.
+ *
+ * ======================================================================================
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include "lharmony/lharmony_PitchUtils.h"
+
+// Selects the widest instruction set that the compiler is allowed to use.
+// This header is private to the library; the kernels that use it fall back to scalar code when neither macro is defined.
+
+#if defined(__AVX2__)
+#	define LHARM_SIMD_AVX2 1
+#	include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#	define LHARM_SIMD_SSE2 1
+#	include <emmintrin.h>
+#endif
+
+#if LHARM_SIMD_AVX2 || LHARM_SIMD_SSE2
+
+namespace limes::harmony::detail
+{
+
+// Thin wrappers around the intrinsics, so that kernels can be written once for every instruction set.
+
+#	if LHARM_SIMD_AVX2
+
+struct SimdOps final
+{
+	using Float = __m256d;
+	using Int	= __m256i;
+
+	static constexpr std::size_t width = 4;
+
+	static constexpr int allLanesMask = 0xF;
+
+	[[nodiscard]] static Float load (const double* ptr) noexcept { return _mm256_loadu_pd (ptr); }
+	static void store (double* ptr, Float v) noexcept { _mm256_storeu_pd (ptr, v); }
+	[[nodiscard]] static Float set (double value) noexcept { return _mm256_set1_pd (value); }
+
+	[[nodiscard]] static Float add (Float a, Float b) noexcept { return _mm256_add_pd (a, b); }
+	[[nodiscard]] static Float sub (Float a, Float b) noexcept { return _mm256_sub_pd (a, b); }
+	[[nodiscard]] static Float mul (Float a, Float b) noexcept { return _mm256_mul_pd (a, b); }
+	[[nodiscard]] static Float div (Float a, Float b) noexcept { return _mm256_div_pd (a, b); }
+
+	[[nodiscard]] static Float mulAdd (Float a, Float b, Float c) noexcept
+	{
+#		if defined(__FMA__)
+		return _mm256_fmadd_pd (a, b, c);
+#		else
+		return _mm256_add_pd (_mm256_mul_pd (a, b), c);
+#		endif
+	}
+
+	[[nodiscard]] static Float bitAnd (Float a, Float b) noexcept { return _mm256_and_pd (a, b); }
+	[[nodiscard]] static Float bitAndNot (Float a, Float b) noexcept { return _mm256_andnot_pd (a, b); }
+	[[nodiscard]] static Float bitOr (Float a, Float b) noexcept { return _mm256_or_pd (a, b); }
+
+	[[nodiscard]] static Float equal (Float a, Float b) noexcept { return _mm256_cmp_pd (a, b, _CMP_EQ_OQ); }
+	[[nodiscard]] static Float lessThan (Float a, Float b) noexcept { return _mm256_cmp_pd (a, b, _CMP_LT_OQ); }
+	[[nodiscard]] static Float lessOrEqual (Float a, Float b) noexcept { return _mm256_cmp_pd (a, b, _CMP_LE_OQ); }
+	[[nodiscard]] static Float greaterOrEqual (Float a, Float b) noexcept { return _mm256_cmp_pd (a, b, _CMP_GE_OQ); }
+	[[nodiscard]] static Float greaterThan (Float a, Float b) noexcept { return _mm256_cmp_pd (a, b, _CMP_GT_OQ); }
+	[[nodiscard]] static int laneMask (Float mask) noexcept { return _mm256_movemask_pd (mask); }
+
+	[[nodiscard]] static Int toBits (Float v) noexcept { return _mm256_castpd_si256 (v); }
+	[[nodiscard]] static Float fromBits (Int v) noexcept { return _mm256_castsi256_pd (v); }
+	[[nodiscard]] static Int setInt (std::int64_t value) noexcept { return _mm256_set1_epi64x (value); }
+	[[nodiscard]] static Int addInt (Int a, Int b) noexcept { return _mm256_add_epi64 (a, b); }
+	[[nodiscard]] static Int shiftLeft52 (Int v) noexcept { return _mm256_slli_epi64 (v, 52); }
+	[[nodiscard]] static Int shiftRight52 (Int v) noexcept { return _mm256_srli_epi64 (v, 52); }
+
+	// converts lanes holding whole numbers in the range of int to 32-bit integers
+	static void storeInts (int* ptr, Float v) noexcept { _mm_storeu_si128 (reinterpret_cast<__m128i*> (ptr), _mm256_cvtpd_epi32 (v)); }
+};
+
+#	else
+
+struct SimdOps final
+{
+	using Float = __m128d;
+	using Int	= __m128i;
+
+	static constexpr std::size_t width = 2;
+
+	static constexpr int allLanesMask = 0x3;
+
+	[[nodiscard]] static Float load (const double* ptr) noexcept { return _mm_loadu_pd (ptr); }
+	static void store (double* ptr, Float v) noexcept { _mm_storeu_pd (ptr, v); }
+	[[nodiscard]] static Float set (double value) noexcept { return _mm_set1_pd (value); }
+
+	[[nodiscard]] static Float add (Float a, Float b) noexcept { return _mm_add_pd (a, b); }
+	[[nodiscard]] static Float sub (Float a, Float b) noexcept { return _mm_sub_pd (a, b); }
+	[[nodiscard]] static Float mul (Float a, Float b) noexcept { return _mm_mul_pd (a, b); }
+	[[nodiscard]] static Float div (Float a, Float b) noexcept { return _mm_div_pd (a, b); }
+	[[nodiscard]] static Float mulAdd (Float a, Float b, Float c) noexcept { return _mm_add_pd (_mm_mul_pd (a, b), c); }
+
+	[[nodiscard]] static Float bitAnd (Float a, Float b) noexcept { return _mm_and_pd (a, b); }
+	[[nodiscard]] static Float bitAndNot (Float a, Float b) noexcept { return _mm_andnot_pd (a, b); }
+	[[nodiscard]] static Float bitOr (Float a, Float b) noexcept { return _mm_or_pd (a, b); }
+
+	[[nodiscard]] static Float equal (Float a, Float b) noexcept { return _mm_cmpeq_pd (a, b); }
+	[[nodiscard]] static Float lessThan (Float a, Float b) noexcept { return _mm_cmplt_pd (a, b); }
+	[[nodiscard]] static Float lessOrEqual (Float a, Float b) noexcept { return _mm_cmple_pd (a, b); }
+	[[nodiscard]] static Float greaterOrEqual (Float a, Float b) noexcept { return _mm_cmpge_pd (a, b); }
+	[[nodiscard]] static Float greaterThan (Float a, Float b) noexcept { return _mm_cmpgt_pd (a, b); }
+	[[nodiscard]] static int laneMask (Float mask) noexcept { return _mm_movemask_pd (mask); }
+
+	[[nodiscard]] static Int toBits (Float v) noexcept { return _mm_castpd_si128 (v); }
+	[[nodiscard]] static Float fromBits (Int v) noexcept { return _mm_castsi128_pd (v); }
+	[[nodiscard]] static Int setInt (std::int64_t value) noexcept { return _mm_set1_epi64x (value); }
+	[[nodiscard]] static Int addInt (Int a, Int b) noexcept { return _mm_add_epi64 (a, b); }
+	[[nodiscard]] static Int shiftLeft52 (Int v) noexcept { return _mm_slli_epi64 (v, 52); }
+	[[nodiscard]] static Int shiftRight52 (Int v) noexcept { return _mm_srli_epi64 (v, 52); }
+
+	// converts lanes holding whole numbers in the range of int to 32-bit integers
+	static void storeInts (int* ptr, Float v) noexcept { _mm_storel_epi64 (reinterpret_cast<__m128i*> (ptr), _mm_cvtpd_epi32 (v)); }
+};
+
+#	endif
+
+// Rounds to the nearest integer, with halfway values rounded away from zero, like roundToNearestInt().
+// Adding and subtracting the magic number rounds halfway values to even, so those are then corrected.
+[[nodiscard]] inline SimdOps::Float roundHalfAwayFromZero (SimdOps::Float x) noexcept
+{
+	using S = SimdOps;
+
+	const auto magic   = S::set (roundingMagic);
+	const auto nearest = S::sub (S::add (x, magic), magic);
+	const auto error   = S::sub (x, nearest);
+
+	const auto zero = S::set (0.);
+	const auto one	= S::set (1.);
+
+	const auto roundUp	 = S::bitAnd (S::equal (error, S::set (0.5)), S::greaterThan (x, zero));
+	const auto roundDown = S::bitAnd (S::equal (error, S::set (-0.5)), S::lessThan (x, zero));
+
+	return S::sub (S::add (nearest, S::bitAnd (roundUp, one)), S::bitAnd (roundDown, one));
+}
+
+}  // namespace limes::harmony::detail
+
+#endif
@@ -0,0 +1,166 @@
+/*
+ * ======================================================================================
+ *  __    ____  __  __  ____  ___
+ * (  )  (_  _)(  \/  )( ___)/ __)
+ *  )(__  _)(_  )    (  )__) \__ \
+ * (____)(____)(_/\/\_)(____)(___/
+ *
+ *  This file is part of the Limes open source library and is licensed under the terms of the GNU Public License.
+ *
+ *  Commercial licenses are available; contact the maintainers at ben.the.vining@gmail.com to inquire for details.
+ *
+ * ======================================================================================
+ */
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <limits>
+#include "lharmony/lharmony_TuningReference.h"
+
+namespace limes::harmony
+{
+
+namespace
+{
+
+// beyond this, every frequency overflows or underflows anyway
+constexpr auto maxInterpolatedMidiPitch = 100000.;
+
+// 2^x for 0 <= x < 1/6, which covers a step of up to two semitones.
+// This uses the first 10 terms of the series in detail::exp2ExactCoefficients, whose truncation error is below 2e-16 in this range, split into
+// even and odd powers so that the two halves can be evaluated in parallel.
+[[nodiscard]] double exp2OfSmallValue (double x) noexcept
+{
+	constexpr auto& c = detail::exp2ExactCoefficients;
+	constexpr auto	n = c.size();
+
+	const auto x2 = x * x;
+
+	// c[n - 1 - k] is the coefficient of x^k
+	const auto even = (((c[n - 9] * x2 + c[n - 7]) * x2 + c[n - 5]) * x2 + c[n - 3]) * x2 + c[n - 1];
+	const auto odd	= (((c[n - 10] * x2 + c[n - 8]) * x2 + c[n - 6]) * x2 + c[n - 4]) * x2 + c[n - 2];
+
+	return odd * x + even;
+}
+
+}  // namespace
+
+TuningReference::TuningReference (double concertPitchHz) noexcept
+	: TuningReference (concertPitchHz, PitchClassOffsets {})
+{
+}
+
+TuningReference::TuningReference (double concertPitchHz, const PitchClassOffsets& centsOffsets) noexcept
+	: concertPitch (concertPitchHz), offsets (centsOffsets)
+{
+	assert (concertPitch > 0.);
+
+	// the same formula as midiToFreq(), so the default tuning gives identical results
+	for (auto note = 0UL; note < tableSize; ++note)
+	{
+		const auto semitones = static_cast<double> (note) + offsets[note % semitonesInOctave] / 100. - 69.;
+
+		frequencies[note] = std::pow (2., semitones / static_cast<double> (semitonesInOctave)) * concertPitch;
+	}
+
+	for (auto pc = 0UL; pc < stepsInOctaves.size(); ++pc)
+	{
+		const auto nextOffset = offsets[(pc + 1) % semitonesInOctave];
+
+		stepsInOctaves[pc] = (1. + (nextOffset - offsets[pc]) / 100.) / static_cast<double> (semitonesInOctave);
+
+		assert (stepsInOctaves[pc] > 0.);
+	}
+}
+
+bool TuningReference::operator== (const TuningReference& other) const noexcept
+{
+	return concertPitch == other.concertPitch && offsets == other.offsets;
+}
+
+bool TuningReference::operator!= (const TuningReference& other) const noexcept
+{
+	return ! (*this == other);
+}
+
+double TuningReference::getConcertPitchHz() const noexcept
+{
+	return concertPitch;
+}
+
+double TuningReference::getPitchClassOffset (PitchClass pitchClass) const noexcept
+{
+	return offsets[static_cast<std::size_t> (pitchClass.getAsInt())];
+}
+
+const TuningReference::PitchClassOffsets& TuningReference::getPitchClassOffsets() const noexcept
+{
+	return offsets;
+}
+
+std::span<const double, TuningReference::tableSize> TuningReference::getFrequencyTable() const noexcept
+{
+	return frequencies;
+}
+
+double TuningReference::getFreqOfNote (int midiNote) const noexcept
+{
+	if (midiNote >= 0 && midiNote < static_cast<int> (tableSize))
+		return frequencies[static_cast<std::size_t> (midiNote)];
+
+	// the table entry for this pitch class in MIDI octave -1, moved up or down by whole octaves
+	const auto pitchClass = pitchClassOfMidiNote (midiNote);
+
+	return std::ldexp (frequencies[static_cast<std::size_t> (pitchClass)], (midiNote - pitchClass) / semitonesInOctave);
+}
+
+double TuningReference::getStepOfNote (int midiNote) const noexcept
+{
+	return stepsInOctaves[static_cast<std::size_t> (pitchClassOfMidiNote (midiNote))];
+}
+
+double TuningReference::getFreqHz (double midiPitch) const noexcept
+{
+	// also catches NaN
+	if (! (std::abs (midiPitch) <= maxInterpolatedMidiPitch))
+		return midiToFreq (midiPitch) * (concertPitch / 440.);
+
+	const auto lower = std::floor (midiPitch);
+	const auto note	 = static_cast<int> (lower);
+	const auto freq	 = getFreqOfNote (note);
+
+	const auto fraction = midiPitch - lower;
+
+	if (fraction == 0.)
+		return freq;
+
+	return freq * exp2OfSmallValue (fraction * getStepOfNote (note));
+}
+
+double TuningReference::getMidiPitch (double freqHz) const noexcept
+{
+	// zero, negative, subnormal, infinite and NaN frequencies
+	if (! (freqHz >= std::numeric_limits<double>::min() && freqHz <= std::numeric_limits<double>::max()))
+		return freqToMidi (freqHz * (440. / concertPitch));
+
+	auto reduced = freqHz;
+	auto octaves = 0;
+
+	if (freqHz < frequencies.front() || freqHz > frequencies.back())
+	{
+		// move the frequency by whole octaves into the lowest octave of the table
+		octaves = std::ilogb (freqHz / frequencies.front());
+		reduced = std::ldexp (freqHz, -octaves);
+	}
+
+	const auto upper = std::upper_bound (frequencies.begin(), frequencies.end(), reduced);
+
+	const auto index = std::max (static_cast<int> (std::distance (frequencies.begin(), upper)) - 1, 0);
+
+	const auto fraction = std::log2 (reduced / frequencies[static_cast<std::size_t> (index)]) / getStepOfNote (index);
+
+	return static_cast<double> (index + octaves * semitonesInOctave) + fraction;
+}
+
+}  // namespace limes::harmony
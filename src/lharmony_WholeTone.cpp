@@ -14,6 +14,7 @@
 
 #include "lharmony/lharmony_WholeTone.h"
 #include "lharmony/lharmony_PitchClass.h"  // for PitchClass
+#include "lharmony/lharmony_PitchClassSet.h"	// for PitchClassSet
 
 namespace limes::harmony::scales
 {
@@ -40,6 +41,15 @@ std::vector<int> WholeTone::getIntervalsAsSemitones() const
 	return intervals;
 }
 
+PitchClassSet WholeTone::getPitchClassSet() const noexcept
+{
+	using PC = PitchClass;
+
+	constexpr PitchClassSet pattern { PC { 0 }, PC { 2 }, PC { 4 }, PC { 6 }, PC { 8 }, PC { 10 } };
+
+	return pattern.transposed (startingPitchClass.getAsInt());
+}
+
 PitchClass WholeTone::getPitchClassOfRoot() const noexcept
 {
 	return startingPitchClass;
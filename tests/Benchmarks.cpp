@@ -0,0 +1,1011 @@
+/*
+ * ======================================================================================
+ *  __    ____  __  __  ____  ___
+ * (  )  (_  _)(  \/  )( ___)/ __)
+ *  )(__  _)(_  )    (  )__) \__ \
+ * (____)(____)(_/\/\_)(____)(___/
+ *
+ *  This file is part of the Limes open source library and is licensed under the terms of the GNU Public License.
+ *
+ *  Commercial licenses are available; contact the maintainers at ben.the.vining@gmail.com to inquire for details.
+ *
+ * ======================================================================================
+ */
+
+#include <algorithm>
+#include <array>
+#include <cstdlib>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "lharmony/lharmony.h"
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#ifdef LHARM_STARTUP_EXECUTABLE
+#	include <fcntl.h>
+#	include <spawn.h>
+#	include <sys/wait.h>
+
+extern char** environ;	// NOLINT
+#endif
+
+// These test cases are hidden, so they are not run by ctest.
+// Run them explicitly with: lharmony_tests "[benchmark]"
+
+#define TAGS "[.][benchmark]"
+
+namespace harmony = limes::harmony;
+
+namespace
+{
+
+constexpr auto numNotes = 4096;
+
+[[nodiscard]] std::vector<harmony::Pitch> makePitches()
+{
+	std::vector<harmony::Pitch> pitches;
+
+	pitches.reserve (numNotes);
+
+	for (auto i = 0; i < numNotes; ++i)
+		pitches.emplace_back ((i * 7) % 128);
+
+	return pitches;
+}
+
+// the switch-based Interval arithmetic that the lookup tables replaced, kept here for comparison
+namespace switch_interval
+{
+
+using Quality = harmony::Interval::Quality;
+
+struct Interval final
+{
+	int kind { 0 };
+
+	Quality quality { Quality::Perfect };
+};
+
+[[nodiscard]] int getNumSemitones (Interval interval) noexcept
+{
+	auto major_or_minor = [q = interval.quality] (int baseSemitones) -> int
+	{
+		switch (q)
+		{
+			case (Quality::Major) : return baseSemitones;
+			case (Quality::Minor) : return baseSemitones - 1;
+			case (Quality::Augmented) : return baseSemitones + 1;
+			case (Quality::Diminished) : return baseSemitones - 2;
+			default : return 0;
+		}
+	};
+
+	auto perfect = [q = interval.quality] (int baseSemitones) -> int
+	{
+		switch (q)
+		{
+			case (Quality::Perfect) : return baseSemitones;
+			case (Quality::Augmented) : return baseSemitones + 1;
+			case (Quality::Diminished) : return baseSemitones - 1;
+			default : return 0;
+		}
+	};
+
+	switch (interval.kind)
+	{
+		case (0) : return perfect (0);
+		case (2) : return major_or_minor (2);
+		case (3) : return major_or_minor (4);
+		case (4) : return perfect (5);
+		case (5) : return perfect (7);
+		case (6) : return major_or_minor (9);
+		case (7) : return major_or_minor (11);
+		case (8) : return perfect (12);
+		default : return 0;
+	}
+}
+
+[[nodiscard]] Interval fromNumSemitones (int semitones) noexcept
+{
+	if (semitones == 13 || semitones == -13)
+		return Interval { 8, Quality::Augmented };
+
+	switch (std::abs (semitones) % 13)
+	{
+		case (1) : return Interval { 2, Quality::Minor };
+		case (2) : return Interval { 2, Quality::Major };
+		case (3) : return Interval { 3, Quality::Minor };
+		case (4) : return Interval { 3, Quality::Major };
+		case (5) : return Interval { 4, Quality::Perfect };
+		case (6) : return Interval { 4, Quality::Augmented };
+		case (7) : return Interval { 5, Quality::Perfect };
+		case (8) : return Interval { 6, Quality::Minor };
+		case (9) : return Interval { 6, Quality::Major };
+		case (10) : return Interval { 7, Quality::Minor };
+		case (11) : return Interval { 7, Quality::Major };
+		case (12) : return Interval { 8, Quality::Perfect };
+		default : return Interval { 0, Quality::Perfect };
+	}
+}
+
+[[nodiscard]] Interval add (Interval first, Interval second) noexcept
+{
+	return fromNumSemitones (getNumSemitones (first) + getNumSemitones (second));
+}
+
+}  // namespace switch_interval
+
+}  // namespace
+
+TEST_CASE ("Benchmark - Pitch queries", TAGS)
+{
+	const auto pitches = makePitches();
+
+	BENCHMARK ("Pitch::getPitchClass")
+	{
+		auto sum = 0;
+
+		for (const auto& p : pitches)
+			sum += p.getPitchClass().getAsInt();
+
+		return sum;
+	};
+
+	BENCHMARK ("Pitch::getOctaveNumber")
+	{
+		auto sum = 0;
+
+		for (const auto& p : pitches)
+			sum += p.getOctaveNumber();
+
+		return sum;
+	};
+
+	BENCHMARK ("Pitch::isBlackKey")
+	{
+		auto count = 0;
+
+		for (const auto& p : pitches)
+			if (p.isBlackKey())
+				++count;
+
+		return count;
+	};
+
+	BENCHMARK ("Pitch::isMicrotone")
+	{
+		auto count = 0;
+
+		for (const auto& p : pitches)
+			if (p.isMicrotone())
+				++count;
+
+		return count;
+	};
+}
+
+TEST_CASE ("Benchmark - Tuning references", TAGS)
+{
+	const auto pitches = makePitches();
+
+	const harmony::TuningReference tuning { 442. };
+
+	BENCHMARK ("Pitch::getFreqHz")
+	{
+		auto sum = 0.;
+
+		for (const auto& p : pitches)
+			sum += p.getFreqHz();
+
+		return sum;
+	};
+
+	BENCHMARK ("Pitch::getFreqHz - TuningReference")
+	{
+		auto sum = 0.;
+
+		for (const auto& p : pitches)
+			sum += p.getFreqHz (tuning);
+
+		return sum;
+	};
+
+	BENCHMARK ("Pitch::getFreqHz - TuningReference, microtones")
+	{
+		auto sum = 0.;
+
+		for (const auto& p : pitches)
+			sum += (p + harmony::MicrotonalInterval { 0.25 }).getFreqHz (tuning);
+
+		return sum;
+	};
+}
+
+TEST_CASE ("Benchmark - Freq/MIDI conversion", TAGS)
+{
+	std::vector<double> midiNotes;
+
+	midiNotes.reserve (numNotes);
+
+	for (auto i = 0; i < numNotes; ++i)
+		midiNotes.push_back (static_cast<double> (i % 128) + 0.01 * static_cast<double> (i % 100));
+
+	std::vector<double> freqs (midiNotes.size());
+
+	harmony::midiToFreq (midiNotes, freqs);
+
+	std::vector<double> output (midiNotes.size());
+
+	BENCHMARK ("midiToFreq - scalar")
+	{
+		for (auto i = 0UL; i < midiNotes.size(); ++i)
+			output[i] = harmony::midiToFreq (midiNotes[i]);
+
+		return output.back();
+	};
+
+	BENCHMARK ("midiToFreq - batch")
+	{
+		harmony::midiToFreq (midiNotes, output);
+		return output.back();
+	};
+
+	BENCHMARK ("midiToFreq - scalar, 1 cent")
+	{
+		for (auto i = 0UL; i < midiNotes.size(); ++i)
+			output[i] = harmony::midiToFreq<harmony::ConversionAccuracy::Cent> (midiNotes[i]);
+
+		return output.back();
+	};
+
+	BENCHMARK ("midiToFreq - batch, 0.1 cent")
+	{
+		harmony::midiToFreq (midiNotes, output, harmony::ConversionAccuracy::TenthOfCent);
+		return output.back();
+	};
+
+	BENCHMARK ("midiToFreq - batch, 1 cent")
+	{
+		harmony::midiToFreq (midiNotes, output, harmony::ConversionAccuracy::Cent);
+		return output.back();
+	};
+
+	BENCHMARK ("freqToMidi - scalar")
+	{
+		for (auto i = 0UL; i < freqs.size(); ++i)
+			output[i] = harmony::freqToMidi (freqs[i]);
+
+		return output.back();
+	};
+
+	BENCHMARK ("freqToMidi - batch")
+	{
+		harmony::freqToMidi (freqs, output);
+		return output.back();
+	};
+
+	BENCHMARK ("freqToMidi - scalar, 1 cent")
+	{
+		for (auto i = 0UL; i < freqs.size(); ++i)
+			output[i] = harmony::freqToMidi<harmony::ConversionAccuracy::Cent> (freqs[i]);
+
+		return output.back();
+	};
+
+	BENCHMARK ("freqToMidi - batch, 0.1 cent")
+	{
+		harmony::freqToMidi (freqs, output, harmony::ConversionAccuracy::TenthOfCent);
+		return output.back();
+	};
+
+	BENCHMARK ("freqToMidi - batch, 1 cent")
+	{
+		harmony::freqToMidi (freqs, output, harmony::ConversionAccuracy::Cent);
+		return output.back();
+	};
+}
+
+TEST_CASE ("Benchmark - PitchBuffer", TAGS)
+{
+	std::vector<harmony::Pitch> pitches;
+
+	pitches.reserve (numNotes);
+
+	// a mix of whole and microtonal pitches
+	for (auto i = 0; i < numNotes; ++i)
+		pitches.emplace_back (static_cast<double> ((i * 7) % 128) + 0.25 * static_cast<double> (i % 4));
+
+	const harmony::PitchBuffer buffer { pitches };
+
+	std::vector<int> output (pitches.size());
+
+	BENCHMARK ("Pitch::getPitchClass - loop")
+	{
+		for (auto i = 0UL; i < pitches.size(); ++i)
+			output[i] = pitches[i].getPitchClass().getAsInt();
+
+		return output.back();
+	};
+
+	BENCHMARK ("PitchBuffer::getPitchClasses")
+	{
+		buffer.getPitchClasses (output);
+		return output.back();
+	};
+
+	BENCHMARK ("Pitch::getOctaveNumber - loop")
+	{
+		for (auto i = 0UL; i < pitches.size(); ++i)
+			output[i] = pitches[i].getOctaveNumber();
+
+		return output.back();
+	};
+
+	BENCHMARK ("PitchBuffer::getOctaveNumbers")
+	{
+		buffer.getOctaveNumbers (output);
+		return output.back();
+	};
+
+	BENCHMARK ("Pitch::getRoundedMidiPitch - loop")
+	{
+		for (auto i = 0UL; i < pitches.size(); ++i)
+			output[i] = pitches[i].getRoundedMidiPitch();
+
+		return output.back();
+	};
+
+	BENCHMARK ("PitchBuffer::getRoundedMidiPitches")
+	{
+		buffer.getRoundedMidiPitches (output);
+		return output.back();
+	};
+}
+
+TEST_CASE ("Benchmark - KeyboardState", TAGS)
+{
+	// a stream of note on/off events: each note is held while the next two are played
+	std::vector<int> events;
+
+	events.reserve (numNotes);
+
+	for (auto i = 0; i < numNotes; ++i)
+		events.push_back (36 + (i * 7) % 48);
+
+	BENCHMARK ("Chord - rebuilt per event")
+	{
+		harmony::KeyboardState state;
+
+		auto count = 0;
+
+		for (auto i = 0UL; i < events.size(); ++i)
+		{
+			state.noteOn (events[i]);
+
+			if (i >= 2)
+				state.noteOff (events[i - 2]);
+
+			count += harmony::Chord { state }.getPitchClassSet().size();
+		}
+
+		return count;
+	};
+
+	BENCHMARK ("KeyboardState - per event")
+	{
+		harmony::KeyboardState state;
+
+		auto count = 0;
+
+		for (auto i = 0UL; i < events.size(); ++i)
+		{
+			state.noteOn (events[i]);
+
+			if (i >= 2)
+				state.noteOff (events[i - 2]);
+
+			count += state.getPitchClassSet().size();
+		}
+
+		return count;
+	};
+}
+
+TEST_CASE ("Benchmark - Pitch names", TAGS)
+{
+	auto pitches = makePitches();
+
+	// every other pitch has a cents offset
+	for (auto i = 0UL; i < pitches.size(); i += 2)
+		pitches[i] = harmony::Pitch { pitches[i].getMidiPitch() + 0.25 };
+
+	std::string names;
+
+	{
+		std::array<char, harmony::maxPitchNameLength> buffer;
+
+		for (const auto& p : pitches)
+		{
+			const auto result = harmony::toChars (buffer.data(), buffer.data() + buffer.size(), p);
+			names.append (buffer.data(), result.ptr);
+			names += ' ';
+		}
+	}
+
+	std::string midiNumbers;
+
+	{
+		std::ostringstream stream;
+
+		for (const auto& p : pitches)
+			stream << p << ' ';
+
+		midiNumbers = stream.str();
+	}
+
+	BENCHMARK ("stringstream - format names")
+	{
+		std::ostringstream stream;
+
+		for (const auto& p : pitches)
+			stream << p.getPitchClass() << p.getOctaveNumber() << ' ';
+
+		return stream.str().size();
+	};
+
+	BENCHMARK ("toChars - format names")
+	{
+		std::array<char, harmony::maxPitchNameLength> buffer;
+
+		auto length = 0L;
+
+		for (const auto& p : pitches)
+			length += harmony::toChars (buffer.data(), buffer.data() + buffer.size(), p).ptr - buffer.data();
+
+		return length;
+	};
+
+	BENCHMARK ("stringstream - parse MIDI numbers")
+	{
+		std::istringstream stream { midiNumbers };
+
+		auto sum = 0.;
+
+		for (double midiPitch; stream >> midiPitch;)
+			sum += midiPitch;
+
+		return sum;
+	};
+
+	BENCHMARK ("fromChars - parse names")
+	{
+		const auto* ptr = names.data();
+		const auto* end = names.data() + names.size();
+
+		auto sum = 0.;
+
+		while (ptr < end)
+		{
+			harmony::Pitch pitch { 0 };
+
+			ptr = harmony::fromChars (ptr, end, pitch).ptr + 1;
+
+			sum += pitch.getMidiPitch();
+		}
+
+		return sum;
+	};
+}
+
+TEST_CASE ("Benchmark - Interval names", TAGS)
+{
+	const auto pitches = makePitches();
+
+	std::vector<harmony::CompoundInterval> intervals;
+
+	for (auto i = 0UL; i + 1 < pitches.size(); ++i)
+		intervals.push_back (harmony::CompoundInterval::fromPitches (pitches[i], pitches[i + 1]));
+
+	BENCHMARK ("getStringDescription - simple")
+	{
+		auto length = 0UL;
+
+		for (const auto& interval : intervals)
+			length += interval.getSimpleInterval().getStringDescription (true).size();
+
+		return length;
+	};
+
+	BENCHMARK ("getName - simple")
+	{
+		auto length = 0UL;
+
+		for (const auto& interval : intervals)
+			length += interval.getSimpleInterval().getName (true).size();
+
+		return length;
+	};
+
+	BENCHMARK ("getStringDescription - compound")
+	{
+		auto length = 0UL;
+
+		for (const auto& interval : intervals)
+			length += interval.getStringDescription().size();
+
+		return length;
+	};
+
+	BENCHMARK ("toChars - compound")
+	{
+		std::array<char, harmony::maxIntervalNameLength> buffer;
+
+		auto length = 0L;
+
+		for (const auto& interval : intervals)
+			length += harmony::toChars (buffer.data(), buffer.data() + buffer.size(), interval).ptr - buffer.data();
+
+		return length;
+	};
+
+	std::string names;
+
+	{
+		std::array<char, harmony::maxIntervalNameLength> buffer;
+
+		for (auto i = 0UL; i < intervals.size(); ++i)
+		{
+			const auto result = harmony::toChars (buffer.data(), buffer.data() + buffer.size(), intervals[i], i % 2 == 0);
+			names.append (buffer.data(), result.ptr);
+			names += ',';
+		}
+	}
+
+	BENCHMARK ("fromChars - compound")
+	{
+		const auto* ptr = names.data();
+		const auto* end = names.data() + names.size();
+
+		auto semitones = 0;
+
+		while (ptr < end)
+		{
+			harmony::CompoundInterval interval;
+
+			ptr = harmony::fromChars (ptr, end, interval).ptr + 1;
+
+			semitones += interval.getNumSemitones();
+		}
+
+		return semitones;
+	};
+}
+
+TEST_CASE ("Benchmark - PitchQuantizer", TAGS)
+{
+	std::vector<double> inputs;
+
+	inputs.reserve (numNotes);
+
+	for (auto i = 0; i < numNotes; ++i)
+		inputs.push_back (36. + static_cast<double> ((i * 37) % 4800) * 0.01);
+
+	std::vector<double> quantized (inputs.size());
+	std::vector<double> deviations (inputs.size());
+
+	const harmony::PitchQuantizer edo31 { 31 };
+
+	const harmony::PitchQuantizer cMajor { harmony::PitchClassSet { harmony::PitchClass { 0 }, harmony::PitchClass { 2 }, harmony::PitchClass { 4 }, harmony::PitchClass { 5 },
+																	harmony::PitchClass { 7 }, harmony::PitchClass { 9 }, harmony::PitchClass { 11 } } };
+
+	BENCHMARK ("31-EDO - per pitch")
+	{
+		for (auto i = 0UL; i < inputs.size(); ++i)
+		{
+			quantized[i]  = edo31.quantize (inputs[i]);
+			deviations[i] = (inputs[i] - quantized[i]) * 100.;
+		}
+
+		return quantized.back();
+	};
+
+	BENCHMARK ("31-EDO - batch")
+	{
+		edo31.quantize (inputs, quantized, deviations);
+		return quantized.back();
+	};
+
+	BENCHMARK ("Scale - per pitch")
+	{
+		for (auto i = 0UL; i < inputs.size(); ++i)
+		{
+			quantized[i]  = cMajor.quantize (inputs[i]);
+			deviations[i] = (inputs[i] - quantized[i]) * 100.;
+		}
+
+		return quantized.back();
+	};
+
+	BENCHMARK ("Scale - batch")
+	{
+		cMajor.quantize (inputs, quantized, deviations);
+		return quantized.back();
+	};
+
+	BENCHMARK ("Scale - batch with hysteresis")
+	{
+		cMajor.quantizeWithHysteresis (inputs, quantized, deviations);
+		return quantized.back();
+	};
+}
+
+TEST_CASE ("Benchmark - Interval arithmetic", TAGS)
+{
+	std::vector<harmony::Interval>		   intervals;
+	std::vector<switch_interval::Interval> switchIntervals;
+
+	intervals.reserve (numNotes);
+	switchIntervals.reserve (numNotes);
+
+	for (auto i = 0UL; i < static_cast<std::size_t> (numNotes); ++i)
+	{
+		const auto interval = harmony::Interval::fromDenseIndex ((i * 7) % harmony::Interval::numDenseIndices);
+
+		intervals.push_back (interval);
+		switchIntervals.push_back (switch_interval::Interval { interval.getKind(), interval.getQuality() });
+	}
+
+	BENCHMARK ("switch - getNumSemitones")
+	{
+		auto sum = 0;
+
+		for (const auto& interval : switchIntervals)
+			sum += switch_interval::getNumSemitones (interval);
+
+		return sum;
+	};
+
+	BENCHMARK ("tables - getNumSemitones")
+	{
+		auto sum = 0;
+
+		for (const auto& interval : intervals)
+			sum += interval.getNumSemitones();
+
+		return sum;
+	};
+
+	BENCHMARK ("switch - add intervals")
+	{
+		switch_interval::Interval total;
+
+		for (const auto& interval : switchIntervals)
+			total = switch_interval::add (total, interval);
+
+		return total.kind;
+	};
+
+	BENCHMARK ("tables - add intervals")
+	{
+		harmony::Interval total;
+
+		for (const auto& interval : intervals)
+			total += interval;
+
+		return total.getKind();
+	};
+
+	BENCHMARK ("switch - fromNumSemitones")
+	{
+		auto sum = 0;
+
+		for (auto i = 0; i < numNotes; ++i)
+			sum += switch_interval::fromNumSemitones (i % 25 - 12).kind;
+
+		return sum;
+	};
+
+	BENCHMARK ("tables - fromNumSemitones")
+	{
+		auto sum = 0;
+
+		for (auto i = 0; i < numNotes; ++i)
+			sum += harmony::Interval::fromNumSemitones (i % 25 - 12).getKind();
+
+		return sum;
+	};
+}
+
+TEST_CASE ("Benchmark - CompoundInterval arithmetic", TAGS)
+{
+	const auto pitches = makePitches();
+
+	std::vector<int> leaps;
+
+	for (auto i = 0UL; i + 1 < pitches.size(); ++i)
+		leaps.push_back (pitches[i + 1].getRoundedMidiPitch() - pitches[i].getRoundedMidiPitch());
+
+	std::vector<harmony::CompoundInterval> intervals (leaps.size());
+
+	harmony::getCompoundIntervals (leaps, intervals);
+
+	BENCHMARK ("add compound intervals")
+	{
+		auto sum = 0;
+
+		for (auto i = 0UL; i + 1 < intervals.size(); ++i)
+			sum += (intervals[i] + intervals[i + 1]).getKind();
+
+		return sum;
+	};
+
+	BENCHMARK ("subtract compound intervals")
+	{
+		auto sum = 0;
+
+		for (auto i = 0UL; i + 1 < intervals.size(); ++i)
+			sum += (intervals[i] - intervals[i + 1]).getKind();
+
+		return sum;
+	};
+
+	BENCHMARK ("one at a time - from semitones")
+	{
+		for (auto i = 0UL; i < leaps.size(); ++i)
+			intervals[i] = harmony::CompoundInterval::fromPitches (0, leaps[i]);
+
+		return intervals.back().getKind();
+	};
+
+	BENCHMARK ("batch - from semitones")
+	{
+		harmony::getCompoundIntervals (leaps, intervals);
+
+		return intervals.back().getKind();
+	};
+}
+
+TEST_CASE ("Benchmark - enharmonic spellings", TAGS)
+{
+	const auto pitches = makePitches();
+
+	std::vector<int> leaps;
+
+	for (auto i = 0UL; i + 1 < pitches.size(); ++i)
+		leaps.push_back (std::abs (pitches[i + 1].getRoundedMidiPitch() - pitches[i].getRoundedMidiPitch()) % (harmony::semitonesInOctave + 2));
+
+	BENCHMARK ("enumerate spellings - table")
+	{
+		auto sum = 0;
+
+		for (const auto leap : leaps)
+			for (const auto& spelling : harmony::Interval::getSpellings (leap))
+				sum += spelling.getKind();
+
+		return sum;
+	};
+
+	BENCHMARK ("enumerate spellings - validate every kind and quality")
+	{
+		auto sum = 0;
+
+		for (const auto leap : leaps)
+		{
+			for (auto kind = 0; kind <= 8; ++kind)
+			{
+				for (auto q = 0; q <= 4; ++q)
+				{
+					const auto interval = harmony::Interval::tryMake (kind, static_cast<harmony::Interval::Quality> (q));
+
+					if (interval && interval->getNumSemitones() == leap)
+						sum += interval->getKind();
+				}
+			}
+		}
+
+		return sum;
+	};
+
+	std::array<harmony::CompoundInterval, harmony::CompoundInterval::maxSpellings> compoundSpellings;
+
+	BENCHMARK ("enumerate compound spellings")
+	{
+		auto sum = 0UL;
+
+		for (auto i = 0UL; i + 1 < pitches.size(); ++i)
+			sum += harmony::CompoundInterval::getSpellings (pitches[i + 1].getRoundedMidiPitch() - pitches[i].getRoundedMidiPitch(), compoundSpellings);
+
+		return sum;
+	};
+}
+
+TEST_CASE ("Benchmark - RatioInterval lattice", TAGS)
+{
+	// a 7-limit lattice spanning 16 fifths, 8 major thirds, 4 harmonic sevenths and 8 octaves
+	std::vector<harmony::RatioInterval> lattice;
+
+	lattice.reserve (numNotes);
+
+	for (auto three = -8; three < 8; ++three)
+		for (auto five = -4; five < 4; ++five)
+			for (auto seven = -2; seven < 2; ++seven)
+				for (auto octave = 0; octave < 8; ++octave)
+					lattice.push_back (harmony::RatioInterval { 3, 1 }.pow (three) * harmony::RatioInterval { 5, 1 }.pow (five)
+									   * harmony::RatioInterval { 7, 1 }.pow (seven) * harmony::RatioInterval { 2, 1 }.pow (octave));
+
+	const auto fifth = harmony::RatioInterval { 3, 2 };
+
+	BENCHMARK ("stack a fifth on each point")
+	{
+		auto count = 0UL;
+
+		for (const auto& point : lattice)
+			count += (point * fifth).getNumerator() & 1U;
+
+		return count;
+	};
+
+	BENCHMARK ("octave reduce each point")
+	{
+		auto count = 0UL;
+
+		for (const auto& point : lattice)
+			count += point.getOctaveReduced().getDenominator() & 1U;
+
+		return count;
+	};
+
+	BENCHMARK ("sort the lattice")
+	{
+		auto sorted = lattice;
+		std::sort (sorted.begin(), sorted.end());
+		return sorted.front().getNumerator();
+	};
+
+	BENCHMARK ("cents of each point")
+	{
+		auto total = 0.;
+
+		for (const auto& point : lattice)
+			total += point.getCents();
+
+		return total;
+	};
+}
+
+TEST_CASE ("Benchmark - RatioRecognizer", TAGS)
+{
+	const harmony::RatioRecognizer recognizer { 7, 10., 64 };
+
+	std::vector<double> firstFreqs, secondFreqs;
+
+	firstFreqs.reserve (numNotes);
+	secondFreqs.reserve (numNotes);
+
+	for (auto i = 0; i < numNotes; ++i)
+	{
+		firstFreqs.push_back (55. + static_cast<double> (i % 1000) * 0.731);
+		secondFreqs.push_back (firstFreqs.back() * (1. + static_cast<double> (i % 389) * 0.0103));
+	}
+
+	std::vector<harmony::RatioRecognizer::Result> results (numNotes);
+
+	BENCHMARK ("one pair at a time")
+	{
+		for (auto i = 0; i < numNotes; ++i)
+			results[static_cast<std::size_t> (i)] = recognizer.recognize (firstFreqs[static_cast<std::size_t> (i)], secondFreqs[static_cast<std::size_t> (i)]);
+
+		return results.back().errorCents;
+	};
+
+	BENCHMARK ("batch - exact")
+	{
+		recognizer.recognize (firstFreqs, secondFreqs, results);
+		return results.back().errorCents;
+	};
+
+	BENCHMARK ("batch - tenth of a cent")
+	{
+		recognizer.recognize (firstFreqs, secondFreqs, results, harmony::ConversionAccuracy::TenthOfCent);
+		return results.back().errorCents;
+	};
+}
+
+TEST_CASE ("Benchmark - melodic intervals", TAGS)
+{
+	// a long monophonic line
+	constexpr auto numMelodyNotes = numNotes * 64;
+
+	std::vector<harmony::Pitch> melody;
+
+	melody.reserve (numMelodyNotes);
+
+	for (auto i = 0; i < numMelodyNotes; ++i)
+		melody.emplace_back (48 + (i * 7) % 29);
+
+	std::vector<harmony::MelodicInterval> intervals (melody.size() - 1);
+
+	harmony::MelodicIntervalHistogram histogram;
+
+	BENCHMARK ("pair by pair - CompoundInterval::fromPitches")
+	{
+		auto total = 0;
+
+		for (auto i = 0UL; i + 1 < melody.size(); ++i)
+			total += harmony::CompoundInterval::fromPitches (melody[i], melody[i + 1]).getNumSemitones();
+
+		return total;
+	};
+
+	BENCHMARK ("pair by pair - with histogram")
+	{
+		for (auto i = 0UL; i + 1 < melody.size(); ++i)
+		{
+			intervals[i] = harmony::MelodicInterval::fromPitches (melody[i], melody[i + 1]);
+			histogram.add (intervals[i]);
+		}
+
+		return histogram.getTotal();
+	};
+
+	BENCHMARK ("batch")
+	{
+		harmony::getMelodicIntervals (melody, intervals);
+		return intervals.back().getNumSemitones();
+	};
+
+	BENCHMARK ("batch - with histogram")
+	{
+		harmony::getMelodicIntervals (melody, intervals, &histogram);
+		return histogram.getTotal();
+	};
+}
+
+#ifdef LHARM_STARTUP_EXECUTABLE
+
+namespace
+{
+
+// launches the startup program with its output discarded, and returns its exit status
+[[nodiscard]] int runStartupExecutable()
+{
+	posix_spawn_file_actions_t actions;
+	posix_spawn_file_actions_init (&actions);
+	posix_spawn_file_actions_addopen (&actions, 1, "/dev/null", O_WRONLY, 0);
+
+	std::array<char*, 2> args { const_cast<char*> (LHARM_STARTUP_EXECUTABLE), nullptr };  // NOLINT
+
+	pid_t pid {};
+
+	const auto result = posix_spawn (&pid, LHARM_STARTUP_EXECUTABLE, &actions, nullptr, args.data(), environ);
+
+	posix_spawn_file_actions_destroy (&actions);
+
+	if (result != 0)
+		return result;
+
+	auto status = 0;
+
+	waitpid (pid, &status, 0);
+
+	return status;
+}
+
+}  // namespace
+
+// Each run starts a new process, so the time includes loading the shared library, running
+// any static initializers it or the headers have, and making the first calls into it.
+TEST_CASE ("Benchmark - startup", TAGS)
+{
+	REQUIRE (runStartupExecutable() == 0);
+
+	BENCHMARK ("launch, load, and first call")
+	{
+		return runStartupExecutable();
+	};
+}
+
+#endif
+
+#undef TAGS
@@ -12,6 +12,12 @@
  * ======================================================================================
  */
 
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdlib>
+#include <type_traits>
+#include <vector>
 #include "lharmony/lharmony.h"
 #include <catch2/catch_test_macros.hpp>
 
@@ -104,3 +110,308 @@ TEST_CASE ("CompoundInterval", "[audio][harmony][compound_interval]")
 		REQUIRE (interval3.getSimpleInterval() == Interval { 8, Q::Diminished });
 	}
 }
+
+TEST_CASE ("CompoundInterval - value semantics and conversions", "[audio][harmony][compound_interval]")
+{
+	using namespace limes::harmony;	 // NOLINT
+
+	using Q = Interval::Quality;
+
+	STATIC_REQUIRE (sizeof (Interval) <= 4);
+	STATIC_REQUIRE (sizeof (CompoundInterval) <= 4);
+	STATIC_REQUIRE (sizeof (MicrotonalInterval) <= 4);
+
+	STATIC_REQUIRE (std::is_trivially_copyable_v<Interval>);
+	STATIC_REQUIRE (std::is_trivially_copyable_v<CompoundInterval>);
+	STATIC_REQUIRE (std::is_trivially_copyable_v<MicrotonalInterval>);
+
+	STATIC_REQUIRE (! std::is_polymorphic_v<Interval>);
+
+	// conversions between the forms are explicit
+	STATIC_REQUIRE (! std::is_convertible_v<CompoundInterval, Interval>);
+	STATIC_REQUIRE (! std::is_convertible_v<Interval, CompoundInterval>);
+	STATIC_REQUIRE (! std::is_convertible_v<Interval, MicrotonalInterval>);
+	STATIC_REQUIRE (std::is_constructible_v<CompoundInterval, Interval>);
+	STATIC_REQUIRE (std::is_constructible_v<MicrotonalInterval, CompoundInterval>);
+
+	STATIC_REQUIRE (CompoundInterval { 10, Q::Major }.getNumSemitones() == 16);
+	STATIC_REQUIRE (CompoundInterval { Interval { 8, Q::Perfect } } == CompoundInterval { 1, Interval {} });
+	STATIC_REQUIRE (CompoundInterval { Interval { 6, Q::Minor } }.getSimpleInterval() == Interval { 6, Q::Minor });
+	STATIC_REQUIRE (CompoundInterval::fromPitches (60, 79) == CompoundInterval { 12, Q::Perfect });
+	STATIC_REQUIRE (Pitch { 60 } + CompoundInterval { 16 } == Pitch { 76 });
+	STATIC_REQUIRE (CompoundInterval { 9, Q::Minor }.applyToPitch (Pitch { 60 }, false) == Pitch { 47 });
+
+	REQUIRE (MicrotonalInterval { Interval { 5, Q::Perfect } }.getSemitones() == 7.);
+	REQUIRE (MicrotonalInterval { CompoundInterval { 16 } }.getCents() == 1600.);
+	REQUIRE (MicrotonalInterval { 16.4 }.getNearestCompoundInterval() == CompoundInterval { 16 });
+	REQUIRE (MicrotonalInterval { -7.6 }.getNearestCompoundInterval() == CompoundInterval { 8 });
+	REQUIRE (MicrotonalInterval { 0.25 } < MicrotonalInterval { -0.5 });
+
+	REQUIRE (CompoundInterval { 10, Q::Major }.isEnharmonicTo (CompoundInterval { 11, Q::Diminished }));
+	REQUIRE (CompoundInterval { 10, Q::Major }.getStringDescription (true) == "M10");
+	REQUIRE (CompoundInterval { 10, Q::Major }.getStringDescription() == "Major 10th");
+	REQUIRE (CompoundInterval { 12, Q::Perfect }.getStringDescription() == "Perfect 12th");
+	REQUIRE (CompoundInterval { 9, Q::Minor }.getStringDescription (true) == "m9");
+
+	PitchBuffer buffer { Pitch { 60 }, Pitch { 62 } };
+
+	buffer.transpose (CompoundInterval { 16 }, false);
+
+	REQUIRE (buffer == PitchBuffer { Pitch { 44 }, Pitch { 46 } });
+}
+
+TEST_CASE ("CompoundInterval - non-throwing construction", "[audio][harmony][compound_interval]")
+{
+	using namespace limes::harmony;	 // NOLINT
+
+	using Q = Interval::Quality;
+
+	STATIC_REQUIRE (noexcept (CompoundInterval::tryMake (9, Q::Major)));
+
+	STATIC_REQUIRE (*CompoundInterval::tryMake (3, Q::Minor) == CompoundInterval { Interval { 3, Q::Minor } });
+	STATIC_REQUIRE (*CompoundInterval::tryMake (10, Q::Major) == CompoundInterval { 10, Q::Major });
+	STATIC_REQUIRE (CompoundInterval::tryMake (10, Q::Major)->getNumSemitones() == 16);
+	STATIC_REQUIRE (CompoundInterval::tryMake (15, Q::Perfect)->getNumSemitones() == 24);
+	STATIC_REQUIRE (CompoundInterval::tryMake (22, Q::Augmented)->getNumSemitones() == 37);
+	STATIC_REQUIRE (CompoundInterval::tryMake (15, Q::Diminished)->getNumSemitones() == 23);
+	STATIC_REQUIRE (CompoundInterval::tryMake (15, Q::Diminished)->getKind() == 15);
+
+	// octaves are stored the same way however they are built
+	STATIC_REQUIRE (*CompoundInterval::tryMake (8, Q::Perfect) == CompoundInterval { 12 });
+	STATIC_REQUIRE (*CompoundInterval::tryMake (8, Q::Augmented) == CompoundInterval { Interval { 8, Q::Augmented } });
+	STATIC_REQUIRE (*CompoundInterval::tryMake (8, Q::Augmented) == CompoundInterval { 1, Interval { 0, Q::Augmented } });
+	STATIC_REQUIRE (*CompoundInterval::tryMake (8, Q::Diminished) == CompoundInterval { Interval { 8, Q::Diminished } });
+
+	STATIC_REQUIRE (CompoundInterval::tryMake (1, Q::Perfect).error() == IntervalError::InvalidKind);
+	STATIC_REQUIRE (CompoundInterval::tryMake (-9, Q::Major).error() == IntervalError::InvalidKind);
+	STATIC_REQUIRE (CompoundInterval::tryMake (1'000'000, Q::Major).error() == IntervalError::InvalidKind);
+	STATIC_REQUIRE (CompoundInterval::tryMake (9, static_cast<Q> (-1)).error() == IntervalError::InvalidQuality);
+	STATIC_REQUIRE (CompoundInterval::tryMake (12, Q::Major).error() == IntervalError::InvalidQualityForKind);
+	STATIC_REQUIRE (! CompoundInterval::tryMake (15, Q::Minor));
+
+	// the factory and the throwing constructor agree on every kind and quality
+	for (auto kind = -1; kind <= 40; ++kind)
+	{
+		for (auto q = 0; q <= 5; ++q)
+		{
+			const auto quality = static_cast<Q> (q);
+			const auto result  = CompoundInterval::tryMake (kind, quality);
+
+			if (result)
+			{
+				REQUIRE (*result == CompoundInterval { kind, quality });
+				REQUIRE (result->getKind() == (kind == 0 ? 1 : kind));
+			}
+			else
+			{
+				REQUIRE_THROWS (CompoundInterval { kind, quality });
+			}
+		}
+	}
+}
+
+TEST_CASE ("CompoundInterval - arithmetic", "[audio][harmony][compound_interval]")
+{
+	using namespace limes::harmony;	 // NOLINT
+
+	using Q = Interval::Quality;
+
+	// kinds are added as well as sizes
+	STATIC_REQUIRE (CompoundInterval { 3, Q::Major } + CompoundInterval { 3, Q::Minor } == CompoundInterval { 5, Q::Perfect });
+	STATIC_REQUIRE (CompoundInterval { 10, Q::Major } + CompoundInterval { 5, Q::Perfect } == CompoundInterval { 14, Q::Major });
+	STATIC_REQUIRE (CompoundInterval { 8, Q::Perfect } + CompoundInterval { 8, Q::Perfect } == CompoundInterval { 15, Q::Perfect });
+	STATIC_REQUIRE (CompoundInterval { 5, Q::Diminished } + CompoundInterval { 4, Q::Augmented } == CompoundInterval { Interval { 8, Q::Perfect } });
+	STATIC_REQUIRE (CompoundInterval { 9, Q::Minor } + CompoundInterval { 7, Q::Minor } == CompoundInterval { 15, Q::Diminished });
+
+	// an enharmonic spelling of the same sum keeps its own kind
+	STATIC_REQUIRE (CompoundInterval { 2, Q::Augmented } + CompoundInterval { 9, Q::Major } == CompoundInterval { 10, Q::Augmented });
+	STATIC_REQUIRE (CompoundInterval { 3, Q::Minor } + CompoundInterval { 9, Q::Major } == CompoundInterval { 11, Q::Perfect });
+
+	// sums that have no spelling of their kind are spelled from their size
+	STATIC_REQUIRE (CompoundInterval { 4, Q::Augmented } + CompoundInterval { 5, Q::Augmented } == CompoundInterval { 14 });
+	STATIC_REQUIRE (CompoundInterval { 4, Q::Augmented } + CompoundInterval { 4, Q::Augmented } == CompoundInterval { 7, Q::Augmented });
+
+	STATIC_REQUIRE (CompoundInterval { 9, Q::Major } - CompoundInterval { 2, Q::Major } == CompoundInterval { 1, Interval {} });
+	STATIC_REQUIRE (CompoundInterval { 12, Q::Perfect } - CompoundInterval { 10, Q::Minor } == CompoundInterval { 3, Q::Major });
+	STATIC_REQUIRE (CompoundInterval { 5, Q::Perfect } - CompoundInterval { 4, Q::Augmented } == CompoundInterval { 2, Q::Minor });
+	STATIC_REQUIRE (CompoundInterval { 4, Q::Augmented } - CompoundInterval { 5, Q::Perfect } == CompoundInterval { 2, Q::Minor });
+	STATIC_REQUIRE (CompoundInterval { 3, Q::Minor } - CompoundInterval { 2, Q::Augmented } == CompoundInterval { 2, Q::Diminished });
+
+	STATIC_REQUIRE (CompoundInterval { 10, Q::Major } + 3 == CompoundInterval { 12, Q::Perfect });
+	STATIC_REQUIRE (CompoundInterval { 10, Q::Major } - 8 == CompoundInterval { 6, Q::Minor });
+	STATIC_REQUIRE (CompoundInterval { 3, Q::Major } - 7 == CompoundInterval { 3, Q::Minor });
+
+	STATIC_REQUIRE ([]
+					{
+						CompoundInterval interval { 3, Q::Major };
+
+						interval += CompoundInterval { 10, Q::Minor };
+						interval -= CompoundInterval { 2, Q::Major };
+						interval += 12;
+						interval -= 1;
+
+						return interval;
+					}()
+					== CompoundInterval { 17, Q::Major });
+
+	// comparisons order by size, and then by kind
+	STATIC_REQUIRE (CompoundInterval { 12, Q::Diminished } > CompoundInterval { 11, Q::Augmented });
+	STATIC_REQUIRE (CompoundInterval { 11, Q::Augmented } < CompoundInterval { 12, Q::Diminished });
+	STATIC_REQUIRE (CompoundInterval { 9, Q::Minor } < CompoundInterval { 3, Q::Minor } + CompoundInterval { 8, Q::Perfect });
+	STATIC_REQUIRE (CompoundInterval { 10, Q::Major } >= CompoundInterval { 10, Q::Major });
+	STATIC_REQUIRE (CompoundInterval { 10, Q::Major } <= CompoundInterval { 10, Q::Major });
+	STATIC_REQUIRE (! (CompoundInterval { 17, Q::Major } < CompoundInterval { 10, Q::Major }));
+
+	// octaves built from a kind and quality are equal to octaves built any other way
+	STATIC_REQUIRE (CompoundInterval { 8, Q::Perfect } == CompoundInterval { 12 });
+	STATIC_REQUIRE (CompoundInterval { 8, Q::Perfect } == CompoundInterval { Interval { 8, Q::Perfect } });
+	STATIC_REQUIRE (CompoundInterval { 8, Q::Perfect } == CompoundInterval { 5, Q::Perfect } + CompoundInterval { 4, Q::Perfect });
+	STATIC_REQUIRE (CompoundInterval { 8, Q::Augmented } == CompoundInterval { Interval { 8, Q::Augmented } });
+	STATIC_REQUIRE (CompoundInterval { 8, Q::Augmented } == CompoundInterval { 12 } + CompoundInterval { Interval { 0, Q::Augmented } });
+	STATIC_REQUIRE (CompoundInterval { 8, Q::Augmented }.isEnharmonicTo (CompoundInterval { 13 }));
+	STATIC_REQUIRE (CompoundInterval { 8, Q::Augmented } != CompoundInterval { 13 });
+
+	// equality agrees with the ordering for every interval built from a kind and quality, and every interval built from semitones
+	{
+		std::vector<CompoundInterval> intervals;
+
+		for (auto kind = 2; kind <= 24; ++kind)
+			for (auto q = 0; q <= 4; ++q)
+				if (const auto result = CompoundInterval::tryMake (kind, static_cast<Q> (q)))
+					intervals.push_back (*result);
+
+		for (auto semitones = 0; semitones <= 40; ++semitones)
+			intervals.emplace_back (semitones);
+
+		for (const auto& a : intervals)
+		{
+			for (const auto& b : intervals)
+			{
+				const auto equivalent = ! (a < b) && ! (b < a);
+
+				REQUIRE (equivalent == (a == b));
+				REQUIRE ((a <= b && a >= b) == (a == b));
+
+				if (a == b)
+					REQUIRE (std::hash<CompoundInterval> {}(a) == std::hash<CompoundInterval> {}(b));
+			}
+		}
+	}
+
+	for (auto first = 0; first < 40; ++first)
+	{
+		for (auto second = 0; second < 40; ++second)
+		{
+			for (const auto& a : { CompoundInterval { first }, CompoundInterval { first } + CompoundInterval { Interval { 2, Q::Diminished } } })
+			{
+				const CompoundInterval b { second };
+
+				const auto sum		  = a + b;
+				const auto difference = a - b;
+
+				REQUIRE (sum.getNumSemitones() == a.getNumSemitones() + b.getNumSemitones());
+				REQUIRE (difference.getNumSemitones() == std::abs (a.getNumSemitones() - b.getNumSemitones()));
+				REQUIRE (sum == b + a);
+				REQUIRE (difference == b - a);
+
+				// exactly one of the orderings holds
+				REQUIRE ((a < b) + (b < a) + (a == b) == 1);
+			}
+		}
+	}
+}
+
+TEST_CASE ("CompoundInterval - batch conversion", "[audio][harmony][compound_interval]")
+{
+	using namespace limes::harmony;	 // NOLINT
+
+	std::vector<int> semitones;
+
+	for (auto i = -200; i <= 200; ++i)
+		semitones.push_back (i * 7);
+
+	std::vector<CompoundInterval> intervals (semitones.size());
+
+	getCompoundIntervals (semitones, intervals);
+
+	for (auto i = 0UL; i < semitones.size(); ++i)
+	{
+		REQUIRE (intervals[i] == CompoundInterval { std::abs (semitones[i]) });
+		REQUIRE (intervals[i] == CompoundInterval::fromPitches (0, semitones[i]));
+	}
+}
+
+TEST_CASE ("CompoundInterval - enharmonic spellings", "[audio][harmony][compound_interval]")
+{
+	using namespace limes::harmony;	 // NOLINT
+	using Q = Interval::Quality;
+
+	STATIC_REQUIRE (
+		[]
+		{
+			std::array<CompoundInterval, CompoundInterval::maxSpellings> spellings {};
+
+			return CompoundInterval::getSpellings (12, spellings) == 3
+				&& spellings[0] == CompoundInterval { 7, Q::Augmented }
+				&& spellings[1] == CompoundInterval { 8, Q::Perfect }
+				&& spellings[2] == CompoundInterval { 9, Q::Diminished };
+		}());
+
+	for (auto semitones = -50; semitones <= 50; ++semitones)
+	{
+		std::array<CompoundInterval, CompoundInterval::maxSpellings> spellings {};
+
+		const auto numSpellings = CompoundInterval::getSpellings (semitones, spellings);
+
+		REQUIRE (numSpellings > 0);
+
+		const CompoundInterval defaultSpelling { std::abs (semitones) };
+
+		auto foundDefault = false;
+
+		for (auto index = 0UL; index < numSpellings; ++index)
+		{
+			const auto& spelling = spellings[index];
+
+			REQUIRE (spelling.getNumSemitones() == std::abs (semitones));
+			REQUIRE (spelling.isEnharmonicTo (defaultSpelling));
+
+			// every spelling round-trips through its kind and quality, except simple unisons, whose kind of 1 is not accepted by the constructor
+			if (spelling.getKind() > 1)
+			{
+				const CompoundInterval fromKind { spelling.getKind(), spelling.getQuality() };
+
+				REQUIRE (fromKind == spelling);
+				REQUIRE (std::hash<CompoundInterval> {}(fromKind) == std::hash<CompoundInterval> {}(spelling));
+			}
+
+			if (index > 0)
+				REQUIRE (spellings[index - 1].getKind() < spelling.getKind());
+
+			if (spelling == defaultSpelling)
+				foundDefault = true;
+		}
+
+		REQUIRE (foundDefault);
+
+		// every valid kind and quality of this size is included
+		for (auto kind = 0; kind <= 40; ++kind)
+		{
+			for (auto q = 0; q <= 4; ++q)
+			{
+				const auto result = CompoundInterval::tryMake (kind, static_cast<Q> (q));
+
+				if (! result || result->getNumSemitones() != std::abs (semitones))
+					continue;
+
+				REQUIRE (std::count (spellings.begin(), spellings.begin() + static_cast<std::ptrdiff_t> (numSpellings), *result) == 1);
+			}
+		}
+
+		// a smaller output span holds the spellings of the smallest kinds
+		std::array<CompoundInterval, 1> first {};
+
+		REQUIRE (CompoundInterval::getSpellings (semitones, first) == 1);
+		REQUIRE (first[0] == spellings[0]);
+	}
+}
@@ -0,0 +1,183 @@
+/*
+ * ======================================================================================
+ *  __    ____  __  __  ____  ___
+ * (  )  (_  _)(  \/  )( ___)/ __)
+ *  )(__  _)(_  )    (  )__) \__ \
+ * (____)(____)(_/\/\_)(____)(___/
+ *
+ *  This file is part of the Limes open source library and is licensed under the terms of the GNU Public License.
+ *
+ *  Commercial licenses are available; contact the maintainers at ben.the.vining@gmail.com to inquire for details.
+ *
+ * ======================================================================================
+ */
+
+#include <set>
+#include <unordered_map>
+#include <unordered_set>
+#include "lharmony/lharmony.h"
+#include <catch2/catch_test_macros.hpp>
+
+#define TAGS "[audio][harmony][hash]"
+
+using namespace limes::harmony;	 // NOLINT
+
+TEST_CASE ("Hashing - pitch classes and pitches", TAGS)
+{
+	for (const auto pc : PitchClass::getAll())
+	{
+		REQUIRE (PitchClass::fromDenseIndex (pc.getDenseIndex()) == pc);
+		REQUIRE (PitchClass::fromPackedValue (pc.getPackedValue()) == pc);
+	}
+
+	STATIC_REQUIRE (PitchClass { 11 }.getDenseIndex() == 11);
+
+	STATIC_REQUIRE (Pitch::fromPackedValue (Pitch { 61.5 }.getPackedValue()) == Pitch { 61.5 });
+	STATIC_REQUIRE (Pitch { 0. }.getPackedValue() == Pitch { -0. }.getPackedValue());
+
+	std::unordered_map<Pitch, int> counts;
+
+	for (auto i = 0; i < 256; ++i)
+		++counts[Pitch { (i % 64) * 0.5 }];
+
+	REQUIRE (counts.size() == 64);
+	REQUIRE (counts[Pitch { 31.5 }] == 4);
+
+	const std::unordered_set<PitchClass> pitchClasses { PitchClass { 0 }, PitchClass { 12 }, PitchClass { 7 } };
+
+	REQUIRE (pitchClasses.size() == 2);
+}
+
+TEST_CASE ("Hashing - intervals", TAGS)
+{
+	STATIC_REQUIRE (Interval::getDenseIndex (0, Interval::Quality::Perfect) == 0);
+	STATIC_REQUIRE (Interval::getDenseIndex (0, Interval::Quality::Augmented) == 1);
+	STATIC_REQUIRE (Interval::getDenseIndex (2, Interval::Quality::Diminished) == 2);
+	STATIC_REQUIRE (Interval::getDenseIndex (8, Interval::Quality::Augmented) == Interval::numDenseIndices - 1);
+
+	std::set<std::size_t> indices;
+	std::set<std::uint8_t> packedValues;
+
+	for (auto kind = 0; kind <= 8; ++kind)
+	{
+		for (const auto quality : { Interval::Quality::Diminished, Interval::Quality::Minor, Interval::Quality::Major,
+									Interval::Quality::Augmented, Interval::Quality::Perfect })
+		{
+			if (! Interval::isValidQualityForKind (quality, kind))
+				continue;
+
+			const Interval interval { kind, quality };
+
+			INFO (interval);
+
+			const auto index = interval.getDenseIndex();
+
+			REQUIRE (index < Interval::numDenseIndices);
+			REQUIRE (index == Interval::getDenseIndex (kind, quality));
+			REQUIRE (Interval::fromDenseIndex (index) == interval);
+			REQUIRE (Interval::fromPackedValue (interval.getPackedValue()) == interval);
+
+			indices.insert (index);
+			packedValues.insert (interval.getPackedValue());
+		}
+	}
+
+	REQUIRE (indices.size() == Interval::numDenseIndices);
+	REQUIRE (packedValues.size() == Interval::numDenseIndices);
+
+	// enharmonic intervals are distinct keys
+	std::unordered_set<Interval> set { Interval { 4, Interval::Quality::Augmented }, Interval { 5, Interval::Quality::Diminished } };
+
+	REQUIRE (set.size() == 2);
+}
+
+TEST_CASE ("Hashing - compound intervals", TAGS)
+{
+	std::unordered_set<CompoundInterval> set;
+
+	for (auto semitones = 0; semitones < 60; ++semitones)
+	{
+		const CompoundInterval interval { semitones };
+
+		INFO (interval);
+
+		REQUIRE (CompoundInterval::fromPackedValue (interval.getPackedValue()) == interval);
+
+		set.insert (interval);
+		set.insert (interval);
+	}
+
+	REQUIRE (set.size() == 60);
+
+	const CompoundInterval majorTenth { 10, Interval::Quality::Major };
+
+	REQUIRE ((majorTenth.getPackedValue() >> 8) == 1);
+	REQUIRE ((majorTenth.getPackedValue() & 0xFF) == Interval { 3, Interval::Quality::Major }.getPackedValue());
+}
+
+TEST_CASE ("Hashing - key signatures and modes", TAGS)
+{
+	using scales::KeySignature;
+	using scales::Mode;
+
+	REQUIRE (KeySignature::fromDenseIndex (scales::keys::major::d.getDenseIndex()) == scales::keys::major::d);
+	REQUIRE (Mode::fromDenseIndex (Mode { Mode::Type::Lydian, 5 }.getDenseIndex()) == Mode { Mode::Type::Lydian, 5 });
+
+	for (auto index = 0UL; index < KeySignature::numDenseIndices; ++index)
+	{
+		const auto key = KeySignature::fromDenseIndex (index);
+
+		REQUIRE (key.getDenseIndex() == index);
+		REQUIRE (KeySignature::fromPackedValue (key.getPackedValue()) == key);
+	}
+
+	std::unordered_set<KeySignature> keys;
+
+	for (const auto root : PitchClass::getAll())
+	{
+		for (const auto type : { KeySignature::Type::Major, KeySignature::Type::NaturalMinor, KeySignature::Type::HarmonicMinor })
+		{
+			keys.emplace (type, root);
+			keys.emplace (type, root);
+		}
+	}
+
+	REQUIRE (keys.size() == 36);
+
+	std::unordered_map<Mode, int> modes;
+
+	for (auto index = 0UL; index < Mode::numDenseIndices; ++index)
+	{
+		const auto mode = Mode::fromDenseIndex (index);
+
+		REQUIRE (mode.getDenseIndex() == index);
+		REQUIRE (Mode::fromPackedValue (mode.getPackedValue()) == mode);
+
+		modes[mode] = static_cast<int> (index);
+	}
+
+	REQUIRE (modes.size() == Mode::numDenseIndices);
+	REQUIRE (modes[Mode { Mode::Type::Dorian, 2 }] == 14);
+}
+
+TEST_CASE ("Hashing - chords", TAGS)
+{
+	const Chord cMajor { 60, 64, 67 };
+
+	REQUIRE (cMajor == Chord { 67, 64, 60, 60 });
+	REQUIRE (cMajor != Chord { 60, 63, 67 });
+
+	REQUIRE (std::hash<Chord> {}(cMajor) == std::hash<Chord> {}(Chord { 67, 60, 64 }));
+
+	std::unordered_map<Chord, int> chords;
+
+	chords[cMajor]					 = 1;
+	chords[Chord { 60, 63, 67 }]	 = 2;
+	chords[Chord { 60, 64, 67, 72 }] = 3;
+	chords[Chord { 64, 60, 67 }]	 = 4;
+
+	REQUIRE (chords.size() == 3);
+	REQUIRE (chords[cMajor] == 4);
+}
+
+#undef TAGS
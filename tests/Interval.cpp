@@ -12,6 +12,9 @@
  * ======================================================================================
  */
 
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
 #include "lharmony/lharmony.h"
 #include <catch2/catch_test_macros.hpp>
 
@@ -76,7 +79,7 @@ TEST_CASE ("Interval - inverse", TAGS)
 	test_inverse (i::diminished::octave, i::augmented::unison);
 	test_inverse (i::perfect::octave, i::perfect::unison);
 
-	// TODO: test augmented octave
+	REQUIRE (i::augmented::octave.getInverse() == i::augmented::unison);
 }
 
 TEST_CASE ("Interval - from semitones", TAGS)
@@ -221,4 +224,201 @@ TEST_CASE ("Interval - enharmonics", TAGS)
 	REQUIRE (i::augmented::octave.getNumSemitones() == 13);
 }
 
+TEST_CASE ("Interval - enharmonic spellings", TAGS)
+{
+	using Q = Interval::Quality;
+
+	STATIC_REQUIRE (Interval::getSpellings (6).size() == 2);
+	STATIC_REQUIRE (Interval::getSpellings (6)[0] == Interval { 4, Q::Augmented });
+	STATIC_REQUIRE (Interval::getSpellings (6)[1] == Interval { 5, Q::Diminished });
+	STATIC_REQUIRE (Interval::getSpellings (13).size() == 1);
+	STATIC_REQUIRE (Interval::getSpellings (-1).empty());
+	STATIC_REQUIRE (Interval::getSpellings (14).empty());
+	STATIC_REQUIRE (i::diminished::fifth.getEnharmonicClass() == i::augmented::fourth.getEnharmonicClass());
+
+	std::size_t numSpellings = 0;
+
+	for (auto semitones = 0; semitones < static_cast<int> (Interval::numEnharmonicClasses); ++semitones)
+	{
+		const auto spellings = Interval::getSpellings (semitones);
+
+		REQUIRE (! spellings.empty());
+		REQUIRE (spellings.size() <= 2);
+
+		numSpellings += spellings.size();
+
+		for (auto index = 0UL; index < spellings.size(); ++index)
+		{
+			const auto& spelling = spellings[index];
+
+			REQUIRE (spelling.getNumSemitones() == semitones);
+			REQUIRE (spelling.getEnharmonicClass() == static_cast<std::size_t> (semitones));
+			REQUIRE (Interval::isValidQualityForKind (spelling.getQuality(), spelling.getKind()));
+
+			if (index > 0)
+				REQUIRE (spellings[index - 1].getKind() < spelling.getKind());
+		}
+
+		// the default spelling is one of the candidates
+		const auto defaultSpelling = Interval::fromNumSemitones (semitones);
+
+		REQUIRE (std::count (spellings.begin(), spellings.end(), defaultSpelling) == 1);
+	}
+
+	REQUIRE (numSpellings == Interval::numDenseIndices);
+
+	for (auto first = 0UL; first < Interval::numDenseIndices; ++first)
+	{
+		const auto interval1 = Interval::fromDenseIndex (first);
+		const auto spellings = interval1.getEnharmonicSpellings();
+
+		REQUIRE (std::count (spellings.begin(), spellings.end(), interval1) == 1);
+
+		for (auto second = 0UL; second < Interval::numDenseIndices; ++second)
+		{
+			const auto interval2 = Interval::fromDenseIndex (second);
+
+			REQUIRE (interval1.isEnharmonicTo (interval2) == (interval1.getNumSemitones() == interval2.getNumSemitones()));
+			REQUIRE (interval1.isEnharmonicTo (interval2) == (std::count (spellings.begin(), spellings.end(), interval2) == 1));
+		}
+	}
+}
+
+TEST_CASE ("Interval - constant expressions", TAGS)
+{
+	using Q = Interval::Quality;
+
+	STATIC_REQUIRE (Interval { 3, Q::Major }.getNumSemitones() == 4);
+	STATIC_REQUIRE (Interval { 4, Q::Augmented }.getInverse() == Interval { 5, Q::Diminished });
+	STATIC_REQUIRE (Interval { 3, Q::Major } + Interval { 3, Q::Minor } == Interval { 5, Q::Perfect });
+	STATIC_REQUIRE (Interval { 8, Q::Perfect } - Interval { 4, Q::Perfect } == Interval { 5, Q::Perfect });
+	STATIC_REQUIRE (Interval { 6, Q::Major } + 3 == Interval { 8, Q::Perfect });
+	STATIC_REQUIRE (Interval::fromNumSemitones (-6) == Interval { 4, Q::Augmented });
+	STATIC_REQUIRE (Interval::fromPitches (64, 60) == Interval { 3, Q::Major });
+	STATIC_REQUIRE (++Interval { 4, Q::Augmented } == Interval { 5, Q::Perfect });
+	STATIC_REQUIRE (--Interval { 2, Q::Diminished } == Interval {});
+	STATIC_REQUIRE (Interval::fromPackedValue (Interval { 7, Q::Minor }.getPackedValue()) == Interval { 7, Q::Minor });
+	STATIC_REQUIRE (Interval { 5, Q::Perfect }.applyToPitch (limes::harmony::Pitch { 60 }, true) == limes::harmony::Pitch { 67 });
+
+	STATIC_REQUIRE (i::perfect::fifth == Interval { 5, Q::Perfect });
+	STATIC_REQUIRE (i::major::third + i::minor::third == i::perfect::fifth);
+	STATIC_REQUIRE (i::augmented::fourth.isEnharmonicTo (i::diminished::fifth));
+
+	REQUIRE_THROWS (Interval { 1, Q::Major });
+	REQUIRE_THROWS (Interval { 4, Q::Major });
+	REQUIRE_THROWS (Interval::fromPackedValue (0xFF));
+}
+
+TEST_CASE ("Interval - non-throwing construction", TAGS)
+{
+	using Q = Interval::Quality;
+	using limes::harmony::IntervalError;
+
+	STATIC_REQUIRE (noexcept (Interval::tryMake (3, Q::Major)));
+	STATIC_REQUIRE (noexcept (Interval {}));
+
+	STATIC_REQUIRE (Interval::tryMake (3, Q::Major).has_value());
+	STATIC_REQUIRE (*Interval::tryMake (3, Q::Major) == Interval { 3, Q::Major });
+	STATIC_REQUIRE (*Interval::tryMake (12, Q::Minor) == Interval { 3, Q::Minor });
+	STATIC_REQUIRE (Interval::tryMake (8, Q::Augmented)->getNumSemitones() == 13);
+
+	STATIC_REQUIRE (Interval::tryMake (1, Q::Major).error() == IntervalError::InvalidKind);
+	STATIC_REQUIRE (Interval::tryMake (-2, Q::Major).error() == IntervalError::InvalidKind);
+	STATIC_REQUIRE (Interval::tryMake (3, static_cast<Q> (7)).error() == IntervalError::InvalidQuality);
+	STATIC_REQUIRE (Interval::tryMake (4, Q::Major).error() == IntervalError::InvalidQualityForKind);
+	STATIC_REQUIRE (Interval::tryMake (4, Q::Major).value_or (Interval { 4, Q::Perfect }) == Interval { 4, Q::Perfect });
+
+	// the factory and the throwing constructor agree on every kind and quality
+	for (auto kind = -1; kind <= 20; ++kind)
+	{
+		for (auto q = 0; q <= 5; ++q)
+		{
+			const auto quality = static_cast<Q> (q);
+			const auto result  = Interval::tryMake (kind, quality);
+
+			if (result)
+				REQUIRE (*result == Interval { kind, quality });
+			else
+				REQUIRE_THROWS (Interval { kind, quality });
+		}
+	}
+}
+
+TEST_CASE ("Interval - arithmetic on every pair", TAGS)
+{
+	for (auto first = 0UL; first < Interval::numDenseIndices; ++first)
+	{
+		const auto interval1 = Interval::fromDenseIndex (first);
+
+		REQUIRE (interval1.getDenseIndex() == first);
+		REQUIRE (Interval { interval1.getKind(), interval1.getQuality() } == interval1);
+
+		for (auto second = 0UL; second < Interval::numDenseIndices; ++second)
+		{
+			const auto interval2 = Interval::fromDenseIndex (second);
+
+			REQUIRE (interval1 + interval2 == Interval::fromNumSemitones (interval1.getNumSemitones() + interval2.getNumSemitones()));
+			REQUIRE (interval1 - interval2 == Interval::fromNumSemitones (interval1.getNumSemitones() - interval2.getNumSemitones()));
+
+			auto sum = interval1;
+			sum += interval2;
+
+			REQUIRE (sum == interval1 + interval2);
+		}
+
+		// incrementing and decrementing move by one semitone, except at the ends of the range
+		if (interval1 != i::augmented::octave)
+			REQUIRE ((++Interval { interval1 }).getNumSemitones() == interval1.getNumSemitones() + 1);
+
+		if (interval1 != i::perfect::unison && interval1 != i::diminished::second)
+			REQUIRE ((--Interval { interval1 }).getNumSemitones() == interval1.getNumSemitones() - 1);
+	}
+}
+
+TEST_CASE ("Interval - just intonation", TAGS)
+{
+	using limes::harmony::JustRatio;
+	using Q = Interval::Quality;
+
+	STATIC_REQUIRE (Interval { 5, Q::Perfect }.getJustRatios().size() == 1);
+	STATIC_REQUIRE (Interval { 5, Q::Perfect }.getJustRatios()[0] == JustRatio { 3, 2 });
+	STATIC_REQUIRE (Interval { 0, Q::Perfect }.getCents_JustIntonation()[0] == 0.);
+	STATIC_REQUIRE (Interval { 8, Q::Perfect }.getCents_JustIntonation()[0] == 1200.);
+	STATIC_REQUIRE (Interval { 2, Q::Minor }.getJustRatios()[1] == JustRatio { 16, 15 });
+	STATIC_REQUIRE (Interval { 4, Q::Augmented }.getJustRatios().size() == Interval { 5, Q::Diminished }.getJustRatios().size());
+
+	for (auto index = 0UL; index < Interval::numDenseIndices; ++index)
+	{
+		const auto interval = Interval::fromDenseIndex (index);
+
+		const auto ratios = interval.getJustRatios();
+		const auto cents  = interval.getCents_JustIntonation();
+
+		REQUIRE (! ratios.empty());
+		REQUIRE (ratios.size() == cents.size());
+
+		for (auto r = 0UL; r < ratios.size(); ++r)
+		{
+			REQUIRE (std::abs (cents[r] - 1200. * std::log2 (ratios[r].getRatio())) < 1e-9);
+
+			// every ratio is within a quarter tone of the interval's equal tempered size
+			REQUIRE (std::abs (cents[r] - interval.getCents_EqualTemperament()) < 50.);
+
+			if (r > 0)
+				REQUIRE (cents[r - 1] < cents[r]);
+		}
+	}
+
+	const limes::harmony::CompoundInterval tenth { 1, i::major::third };
+
+	const auto simpleCents = i::major::third.getCents_JustIntonation();
+
+	auto r = 0UL;
+
+	for (const auto value : tenth.getCents_JustIntonation())
+		REQUIRE (value == simpleCents[r++] + 1200.);
+
+	REQUIRE (r == simpleCents.size());
+}
+
 #undef TAGS
@@ -0,0 +1,258 @@
+/*
+ * ======================================================================================
+ *  __    ____  __  __  ____  ___
+ * (  )  (_  _)(  \/  )( ___)/ __)
+ *  )(__  _)(_  )    (  )__) \__ \
+ * (____)(____)(_/\/\_)(____)(___/
+ *
+ *  This file is part of the Limes open source library and is licensed under the terms of the GNU Public License.
+ *
+ *  Commercial licenses are available; contact the maintainers at ben.the.vining@gmail.com to inquire for details.
+ *
+ * ======================================================================================
+ */
+
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <utility>
+#include "lharmony/lharmony.h"
+#include <catch2/catch_test_macros.hpp>
+
+#define TAGS "[audio][harmony][interval_names]"
+
+using namespace limes::harmony;	 // NOLINT
+using Q = Interval::Quality;
+
+namespace
+{
+
+template <typename... Args>
+[[nodiscard]] std::string formatName (Args&&... args)
+{
+	std::array<char, maxIntervalNameLength> buffer;
+
+	const auto result = toChars (buffer.data(), buffer.data() + buffer.size(), std::forward<Args> (args)...);
+
+	REQUIRE (result.ec == std::errc {});
+
+	return { buffer.data(), result.ptr };
+}
+
+template <typename T>
+[[nodiscard]] std::from_chars_result parse (std::string_view string, T& value)
+{
+	return fromChars (string.data(), string.data() + string.size(), value);
+}
+
+template <typename T>
+[[nodiscard]] T parseName (std::string_view string)
+{
+	T value;
+
+	const auto result = parse (string, value);
+
+	INFO (string);
+
+	REQUIRE (result.ec == std::errc {});
+	REQUIRE (result.ptr == string.data() + string.size());
+
+	return value;
+}
+
+}  // namespace
+
+TEST_CASE ("Interval names - lookups", TAGS)
+{
+	STATIC_REQUIRE (Interval::getQualityName (Q::Augmented) == "Augmented");
+	STATIC_REQUIRE (Interval::getQualityName (Q::Minor, true) == "m");
+	STATIC_REQUIRE (Interval { 3, Q::Major }.getName() == "Major third");
+	STATIC_REQUIRE (Interval { 3, Q::Major }.getName (true) == "M3");
+	STATIC_REQUIRE (Interval {}.getName (true) == "P0");
+	STATIC_REQUIRE (Interval { 8, Q::Augmented }.getName() == "Augmented octave");
+
+	for (auto index = 0UL; index < Interval::numDenseIndices; ++index)
+	{
+		const auto interval = Interval::fromDenseIndex (index);
+
+		const auto kind = interval.getKind();
+
+		REQUIRE (interval.getStringDescription() == interval.getName());
+		REQUIRE (interval.getStringDescription (true) == interval.getName (true));
+		REQUIRE (interval.getName (true) == Interval::qualityToString (interval.getQuality(), true) + std::to_string (kind));
+		REQUIRE (interval.getName().starts_with (Interval::getQualityName (interval.getQuality())));
+	}
+}
+
+TEST_CASE ("Interval names - formatting", TAGS)
+{
+	REQUIRE (formatName (Interval { 5, Q::Perfect }) == "Perfect fifth");
+	REQUIRE (formatName (Interval { 4, Q::Augmented }, true) == "A4");
+
+	REQUIRE (formatName (CompoundInterval { 10, Q::Major }) == "Major 10th");
+	REQUIRE (formatName (CompoundInterval { 9, Q::Minor }, true) == "m9");
+	REQUIRE (formatName (CompoundInterval { 21, Q::Diminished }) == "Diminished 21st");
+	REQUIRE (formatName (CompoundInterval { 22, Q::Perfect }) == "Perfect 22nd");
+	REQUIRE (formatName (CompoundInterval { 111, Q::Minor }) == "Minor 111th");
+	REQUIRE (formatName (CompoundInterval { 114, Q::Major }) == "Major 114th");
+	REQUIRE (formatName (CompoundInterval { Interval { 6, Q::Minor } }) == "Minor sixth");
+	REQUIRE (formatName (CompoundInterval { Interval { 6, Q::Minor } }, true) == "m6");
+
+	// octaves have one name however they are built
+	REQUIRE (formatName (CompoundInterval { 8, Q::Perfect }) == "Perfect octave");
+	REQUIRE (formatName (CompoundInterval { 12 }) == "Perfect octave");
+	REQUIRE (formatName (CompoundInterval { 1, Interval {} }, true) == "P8");
+	REQUIRE (formatName (CompoundInterval { 1, Interval { 0, Q::Augmented } }) == "Augmented octave");
+	REQUIRE (formatName (CompoundInterval { Interval { 8, Q::Diminished } }) == "Diminished octave");
+	REQUIRE (formatName (CompoundInterval { 15, Q::Diminished }) == "Diminished 15th");
+	REQUIRE (formatName (CompoundInterval { 15, Q::Perfect }) == "Perfect 15th");
+
+	// the longest possible name fits
+	const CompoundInterval largest { std::numeric_limits<std::int16_t>::min(), Interval { 2, Q::Diminished } };
+
+	REQUIRE (formatName (largest).size() <= maxIntervalNameLength);
+
+	// every compound interval matches getStringDescription()
+	for (auto octaves = 0; octaves < 4; ++octaves)
+	{
+		for (auto index = 0UL; index < Interval::numDenseIndices; ++index)
+		{
+			const CompoundInterval interval { octaves, Interval::fromDenseIndex (index) };
+
+			REQUIRE (formatName (interval) == interval.getStringDescription());
+			REQUIRE (formatName (interval, true) == interval.getStringDescription (true));
+		}
+	}
+
+	// a buffer that is too small is reported
+	std::array<char, 8> buffer;
+
+	for (auto size = 0UL; size < 3; ++size)
+	{
+		const auto result = toChars (buffer.data(), buffer.data() + size, CompoundInterval { 10, Q::Major }, true);
+
+		REQUIRE (result.ec == std::errc::value_too_large);
+		REQUIRE (result.ptr == buffer.data() + size);
+	}
+
+	const auto result = toChars (buffer.data(), buffer.data() + buffer.size(), CompoundInterval { 10, Q::Major });
+
+	REQUIRE (result.ec == std::errc::value_too_large);
+	REQUIRE (result.ptr == buffer.data() + buffer.size());
+
+#ifdef __cpp_lib_format
+	REQUIRE (std::format ("{} {:s} {:l}", Interval { 3, Q::Minor }, Interval { 3, Q::Minor }, Interval { 3, Q::Minor }) == "Minor third m3 Minor third");
+	REQUIRE (std::format ("{} {:s}", CompoundInterval { 10, Q::Major }, CompoundInterval { 10, Q::Major }) == "Major 10th M10");
+#endif
+}
+
+TEST_CASE ("Interval names - parsing", TAGS)
+{
+	REQUIRE (parseName<Interval> ("M3") == Interval { 3, Q::Major });
+	REQUIRE (parseName<Interval> ("P5") == Interval { 5, Q::Perfect });
+	REQUIRE (parseName<Interval> ("aug 4") == Interval { 4, Q::Augmented });
+	REQUIRE (parseName<Interval> ("Aug4") == Interval { 4, Q::Augmented });
+	REQUIRE (parseName<Interval> ("maj7") == Interval { 7, Q::Major });
+	REQUIRE (parseName<Interval> ("MIN 3rd") == Interval { 3, Q::Minor });
+	REQUIRE (parseName<Interval> ("dim5") == Interval { 5, Q::Diminished });
+	REQUIRE (parseName<Interval> ("Perfect fifth") == Interval { 5, Q::Perfect });
+	REQUIRE (parseName<Interval> ("diminished Seventh") == Interval { 7, Q::Diminished });
+	REQUIRE (parseName<Interval> ("P1") == Interval {});
+	REQUIRE (parseName<Interval> ("P0") == Interval {});
+	REQUIRE (parseName<Interval> ("perf unison") == Interval {});
+
+	REQUIRE (parseName<CompoundInterval> ("m10") == CompoundInterval { 10, Q::Minor });
+	REQUIRE (parseName<CompoundInterval> ("Perfect 12th") == CompoundInterval { 12, Q::Perfect });
+	REQUIRE (parseName<CompoundInterval> ("aug 11") == CompoundInterval { 11, Q::Augmented });
+	REQUIRE (parseName<CompoundInterval> ("M3") == CompoundInterval { Interval { 3, Q::Major } });
+	REQUIRE (parseName<CompoundInterval> ("P8") == CompoundInterval { Interval { 8, Q::Perfect } });
+	REQUIRE (parseName<CompoundInterval> ("P15") == CompoundInterval { 24 });
+
+	// parsing stops at the end of the name
+	{
+		constexpr std::string_view string { "M3, P5" };
+
+		Interval interval;
+
+		const auto result = parse (string, interval);
+
+		REQUIRE (result.ec == std::errc {});
+		REQUIRE (result.ptr == string.data() + 2);
+		REQUIRE (interval == Interval { 3, Q::Major });
+	}
+
+	// a suffix that does not match the number is not part of the name
+	{
+		constexpr std::string_view string { "M3th" };
+
+		Interval interval;
+
+		REQUIRE (parse (string, interval).ptr == string.data() + 2);
+	}
+
+	// invalid names leave the value alone
+	for (const auto string : { "", "M", "X3", "M5", "P3", "m 3", "major", "Major ", "maj fifth", "Major major", "d1", "Ma3", "3" })
+	{
+		INFO (string);
+
+		CompoundInterval interval { 10, Q::Major };
+
+		const auto result = parse (string, interval);
+
+		REQUIRE (result.ec == std::errc::invalid_argument);
+		REQUIRE (result.ptr == string);
+		REQUIRE (interval == CompoundInterval { 10, Q::Major });
+	}
+
+	// kinds that are too large
+	{
+		Interval interval;
+
+		REQUIRE (parse ("M10", interval).ec == std::errc::result_out_of_range);
+
+		CompoundInterval compound;
+
+		REQUIRE (parse ("M1000000", compound).ec == std::errc::result_out_of_range);
+		REQUIRE (parse ("M99999999999", compound).ec == std::errc::result_out_of_range);
+	}
+
+	// every name round-trips
+	for (auto octaves = 0; octaves < 4; ++octaves)
+	{
+		for (auto index = 0UL; index < Interval::numDenseIndices; ++index)
+		{
+			const CompoundInterval interval { octaves, Interval::fromDenseIndex (index) };
+
+			REQUIRE (parseName<CompoundInterval> (formatName (interval)) == interval);
+			REQUIRE (parseName<CompoundInterval> (formatName (interval, true)) == interval);
+
+			if (octaves == 0)
+			{
+				const auto simple = Interval::fromDenseIndex (index);
+
+				REQUIRE (parseName<Interval> (formatName (simple)) == simple);
+				REQUIRE (parseName<Interval> (formatName (simple, true)) == simple);
+			}
+		}
+	}
+
+	// every interval built from a kind and quality round-trips
+	for (auto kind = 2; kind <= 22; ++kind)
+	{
+		for (auto q = 0; q <= 4; ++q)
+		{
+			const auto interval = CompoundInterval::tryMake (kind, static_cast<Q> (q));
+
+			if (! interval)
+				continue;
+
+			REQUIRE (parseName<CompoundInterval> (formatName (*interval)) == *interval);
+			REQUIRE (parseName<CompoundInterval> (formatName (*interval, true)) == *interval);
+		}
+	}
+}
+
+#undef TAGS
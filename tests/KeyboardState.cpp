@@ -0,0 +1,150 @@
+/*
+ * ======================================================================================
+ *  __    ____  __  __  ____  ___
+ * (  )  (_  _)(  \/  )( ___)/ __)
+ *  )(__  _)(_  )    (  )__) \__ \
+ * (____)(____)(_/\/\_)(____)(___/
+ *
+ *  This file is part of the Limes open source library and is licensed under the terms of the GNU Public License.
+ *
+ *  Commercial licenses are available; contact the maintainers at ben.the.vining@gmail.com to inquire for details.
+ *
+ * ======================================================================================
+ */
+
+#include <vector>
+#include "lharmony/lharmony.h"
+#include <catch2/catch_test_macros.hpp>
+
+#define TAGS "[audio][harmony][keyboard_state]"
+
+using namespace limes::harmony;	 // NOLINT
+using PC = PitchClass;
+
+TEST_CASE ("KeyboardState - basic operations", TAGS)
+{
+	STATIC_REQUIRE (KeyboardState {}.isEmpty());
+
+	constexpr KeyboardState cMajorTriad { 60, 64, 67 };
+
+	STATIC_REQUIRE (cMajorTriad.getNumNotesOn() == 3);
+	STATIC_REQUIRE (cMajorTriad.isNoteOn (64));
+	STATIC_REQUIRE (! cMajorTriad.isNoteOn (65));
+	STATIC_REQUIRE (! cMajorTriad.isNoteOn (-1));
+	STATIC_REQUIRE (! cMajorTriad.isNoteOn (128));
+	STATIC_REQUIRE (cMajorTriad.getLowestNote() == 60);
+	STATIC_REQUIRE (cMajorTriad.getHighestNote() == 67);
+
+	// notes at the edges of the two words
+	constexpr KeyboardState edges { 0, 63, 64, 127 };
+
+	STATIC_REQUIRE (edges.getNumNotesOn() == 4);
+	STATIC_REQUIRE (edges.getLowestNote() == 0);
+	STATIC_REQUIRE (edges.getHighestNote() == 127);
+	STATIC_REQUIRE (KeyboardState { 63 }.getHighestNote() == 63);
+	STATIC_REQUIRE (KeyboardState { 64 }.getLowestNote() == 64);
+
+	STATIC_REQUIRE ((cMajorTriad | edges).getNumNotesOn() == 6);
+	STATIC_REQUIRE ((cMajorTriad & KeyboardState { 60, 61 }) == KeyboardState { 60 });
+	STATIC_REQUIRE ((cMajorTriad - KeyboardState { 60, 61 }) == KeyboardState { 64, 67 });
+	STATIC_REQUIRE ((cMajorTriad ^ KeyboardState { 60, 61 }) == KeyboardState { 61, 64, 67 });
+
+	auto state = cMajorTriad;
+
+	state.noteOn (72).noteOn (72);
+	REQUIRE (state.getNumNotesOn() == 4);
+	REQUIRE (state.getHighestNote() == 72);
+
+	state.noteOff (60);
+	REQUIRE (state == KeyboardState { 64, 67, 72 });
+
+	state.setNote (60, true);
+	state.setNote (72, false);
+	REQUIRE (state == cMajorTriad);
+
+	state.allNotesOff();
+	REQUIRE (state.isEmpty());
+
+	// out-of-range notes are ignored rather than wrapping onto other notes
+	STATIC_REQUIRE (KeyboardState { -1, 128, 130 }.isEmpty());
+	STATIC_REQUIRE (KeyboardState { 60, -64 } == KeyboardState { 60 });
+
+	state = cMajorTriad;
+
+	for (const auto note : { -1, -64, 128, 130, 191, 1000 })
+	{
+		state.noteOn (note);
+		REQUIRE (state == cMajorTriad);
+
+		state.setNote (note, true);
+		REQUIRE (state == cMajorTriad);
+	}
+
+	state = KeyboardState { 2, 66, 127 };
+
+	for (const auto note : { -1, 130, 191 })
+	{
+		state.noteOff (note);
+		REQUIRE (state == KeyboardState { 2, 66, 127 });
+	}
+}
+
+TEST_CASE ("KeyboardState - iteration", TAGS)
+{
+	constexpr KeyboardState state { 127, 2, 64, 63, 0 };
+
+	const std::vector<int> notes { state.begin(), state.end() };
+
+	REQUIRE (notes == std::vector<int> { 0, 2, 63, 64, 127 });
+
+	for (const auto note : KeyboardState {})
+		FAIL ("Iterated over an empty state: " << note);
+}
+
+TEST_CASE ("KeyboardState - pitch class folding", TAGS)
+{
+	STATIC_REQUIRE (KeyboardState { 60, 64, 67, 76 }.getPitchClassSet() == PitchClassSet { PC { 0 }, PC { 4 }, PC { 7 } });
+	STATIC_REQUIRE (KeyboardState {}.getPitchClassSet().isEmpty());
+
+	for (auto note = 0; note < KeyboardState::numNotes; ++note)
+	{
+		INFO ("MIDI note: " << note);
+
+		REQUIRE (KeyboardState { note }.getPitchClassSet() == PitchClassSet { PC { note } });
+
+		// every note with this pitch class
+		KeyboardState state;
+
+		for (auto other = pitchClassOfMidiNote (note); other < KeyboardState::numNotes; other += semitonesInOctave)
+			state.noteOn (other);
+
+		REQUIRE (state.getPitchClassSet() == PitchClassSet { PC { note } });
+	}
+
+	KeyboardState all;
+
+	for (auto note = 0; note < KeyboardState::numNotes; ++note)
+		all.noteOn (note);
+
+	REQUIRE (all.getPitchClassSet() == PitchClassSet::all());
+}
+
+TEST_CASE ("KeyboardState - chords", TAGS)
+{
+	const Chord chord { 48, 60, 64, 67, 127 };
+
+	const auto state = chord.getKeyboardState();
+
+	REQUIRE (state == KeyboardState { 48, 60, 64, 67, 127 });
+	REQUIRE (state.getPitchClassSet() == chord.getPitchClassSet());
+	REQUIRE (Chord { state } == chord);
+
+	// microtones are rounded, and notes outside the keyboard are left out
+	const Chord microtonal { Pitch { 60.4 }, Pitch { 64.6 }, Pitch { -3 }, Pitch { 130 } };
+
+	REQUIRE (microtonal.getKeyboardState() == KeyboardState { 60, 65 });
+
+	REQUIRE (Chord { KeyboardState {} }.getNumPitches() == 0);
+}
+
+#undef TAGS
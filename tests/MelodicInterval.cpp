@@ -0,0 +1,141 @@
+/*
+ * ======================================================================================
+ *  __    ____  __  __  ____  ___
+ * (  )  (_  _)(  \/  )( ___)/ __)
+ *  )(__  _)(_  )    (  )__) \__ \
+ * (____)(____)(_/\/\_)(____)(___/
+ *
+ *  This file is part of the Limes open source library and is licensed under the terms of the GNU Public License.
+ *
+ *  Commercial licenses are available; contact the maintainers at ben.the.vining@gmail.com to inquire for details.
+ *
+ * ======================================================================================
+ */
+
+#include <cmath>
+#include <type_traits>
+#include <vector>
+#include "lharmony/lharmony.h"
+#include <catch2/catch_test_macros.hpp>
+
+#define TAGS "[audio][harmony][melodic_interval]"
+
+using namespace limes::harmony;	 // NOLINT
+
+TEST_CASE ("MelodicInterval - single intervals", TAGS)
+{
+	STATIC_REQUIRE (sizeof (MelodicInterval) <= 4);
+	STATIC_REQUIRE (std::is_trivially_copyable_v<MelodicInterval>);
+
+	STATIC_REQUIRE (MelodicInterval {}.isRepeatedNote());
+	STATIC_REQUIRE (MelodicInterval { 7 }.isAscending());
+	STATIC_REQUIRE (MelodicInterval { -7 }.isDescending());
+	STATIC_REQUIRE (MelodicInterval { -7 }.getNumSemitones() == -7);
+	STATIC_REQUIRE (MelodicInterval { -7 }.getSimpleInterval() == Interval { 5, Interval::Quality::Perfect });
+	STATIC_REQUIRE (MelodicInterval { 7 } != MelodicInterval { -7 });
+	STATIC_REQUIRE (-MelodicInterval { 7 } == MelodicInterval { -7 });
+	STATIC_REQUIRE (-MelodicInterval { -16 } == MelodicInterval { 16 });
+	STATIC_REQUIRE ((-MelodicInterval { 7 }).getSimpleInterval() == Interval { 5, Interval::Quality::Perfect });
+
+	STATIC_REQUIRE (MelodicInterval::fromPitches (Pitch { 60 }, Pitch { 64 }) == MelodicInterval { 4 });
+	STATIC_REQUIRE (MelodicInterval::fromPitches (Pitch { 64 }, Pitch { 60 }) == MelodicInterval { -4 });
+
+	for (auto from = 20; from < 100; ++from)
+	{
+		for (auto to = 20; to < 100; ++to)
+		{
+			const auto interval = MelodicInterval::fromPitches (Pitch { from }, Pitch { to });
+
+			REQUIRE (interval.getNumSemitones() == to - from);
+			REQUIRE (interval.getCompoundInterval() == CompoundInterval::fromPitches (Pitch { from }, Pitch { to }));
+			REQUIRE (interval.getCompoundInterval().getNumSemitones() == std::abs (to - from));
+		}
+	}
+}
+
+TEST_CASE ("MelodicInterval - histogram", TAGS)
+{
+	MelodicIntervalHistogram histogram;
+
+	histogram.add (MelodicInterval { 2 });
+	histogram.add (MelodicInterval { 2 });
+	histogram.add (MelodicInterval { -2 });
+	histogram.add (MelodicInterval { 0 });
+	histogram.add (MelodicInterval { 30 });
+	histogram.add (MelodicInterval { -40 });
+
+	REQUIRE (histogram.getTotal() == 6);
+	REQUIRE (histogram.getCount (2) == 2);
+	REQUIRE (histogram.getCount (-2) == 1);
+	REQUIRE (histogram.getCount (CompoundInterval { 2 }) == 3);
+	REQUIRE (histogram.getCount (CompoundInterval {}) == 1);
+	REQUIRE (histogram.getCount (MelodicIntervalHistogram::maxSemitones) == 1);
+	REQUIRE (histogram.getCount (-MelodicIntervalHistogram::maxSemitones) == 1);
+	REQUIRE (histogram.getCount (5) == 0);
+
+	auto doubled = histogram;
+	doubled += histogram;
+
+	REQUIRE (doubled.getTotal() == 12);
+	REQUIRE (doubled.getCount (2) == 4);
+
+	doubled.clear();
+
+	REQUIRE (doubled.getTotal() == 0);
+}
+
+TEST_CASE ("MelodicInterval - batches", TAGS)
+{
+	// a melody including halfway values and negative pitches, whose length is not a multiple of the block size or any SIMD width
+	std::vector<Pitch> melody;
+
+	for (auto i = 0; i < 1003; ++i)
+		melody.emplace_back (std::fmod (static_cast<double> (i) * 7.25, 97.) - 10.5 + (i % 3 == 0 ? 0.5 : 0.));
+
+	std::vector<MelodicInterval> intervals (melody.size() - 1);
+
+	MelodicIntervalHistogram histogram;
+
+	getMelodicIntervals (melody, intervals, &histogram);
+
+	MelodicIntervalHistogram expectedHistogram;
+
+	for (auto i = 0UL; i < intervals.size(); ++i)
+	{
+		const auto expected = MelodicInterval::fromPitches (melody[i], melody[i + 1]);
+
+		REQUIRE (intervals[i] == expected);
+		REQUIRE (intervals[i].getSimpleInterval() == expected.getSimpleInterval());
+
+		expectedHistogram.add (expected);
+	}
+
+	REQUIRE (histogram.getTotal() == intervals.size());
+
+	for (auto semitones = -MelodicIntervalHistogram::maxSemitones; semitones <= MelodicIntervalHistogram::maxSemitones; ++semitones)
+		REQUIRE (histogram.getCount (semitones) == expectedHistogram.getCount (semitones));
+
+	// without a histogram
+	std::vector<MelodicInterval> intervals2 (intervals.size());
+
+	getMelodicIntervals (melody, intervals2);
+
+	REQUIRE (intervals2 == intervals);
+
+	// melodies too short to have intervals are ignored
+	getMelodicIntervals (std::span { melody }.first (1), {}, &histogram);
+
+	REQUIRE (histogram.getTotal() == intervals.size());
+
+	// a buffer's pitches can be passed directly
+	const PitchBuffer buffer { Pitch { 60 }, Pitch { 67 }, Pitch { 55 } };
+
+	std::vector<MelodicInterval> bufferIntervals (2);
+
+	getMelodicIntervals (buffer.getPitches(), bufferIntervals);
+
+	REQUIRE (bufferIntervals[0] == MelodicInterval { 7 });
+	REQUIRE (bufferIntervals[1] == MelodicInterval { -12 });
+}
+
+#undef TAGS
@@ -12,6 +12,7 @@
  * ======================================================================================
  */
 
+#include <limits>
 #include "lharmony/lharmony.h"
 #include <catch2/catch_all.hpp>
 
@@ -116,4 +117,54 @@ TEST_CASE ("Pitch - black/white keys", TAGS)
 	}
 }
 
+TEST_CASE ("Pitch - constexpr evaluation", TAGS)
+{
+	STATIC_REQUIRE (Pitch { 60 }.getPitchClass() == PitchClass { 0 });
+	STATIC_REQUIRE (Pitch { 69 }.getOctaveNumber() == 4);
+	STATIC_REQUIRE (Pitch { 61 }.isBlackKey());
+	STATIC_REQUIRE (Pitch { 62 }.isWhiteKey());
+	STATIC_REQUIRE (! Pitch { 62 }.isMicrotone());
+	STATIC_REQUIRE (Pitch { 62.5 }.isMicrotone());
+	STATIC_REQUIRE (Pitch { -0.25 }.isMicrotone());
+	STATIC_REQUIRE (! Pitch { 1e300 }.isMicrotone());
+	STATIC_REQUIRE (! Pitch { -4503599627370496. }.isMicrotone());
+	STATIC_REQUIRE (Pitch { 4503599627370495.5 }.isMicrotone());
+	STATIC_REQUIRE (! Pitch { std::numeric_limits<double>::infinity() }.isMicrotone());
+	STATIC_REQUIRE (! Pitch { -std::numeric_limits<double>::infinity() }.isMicrotone());
+	STATIC_REQUIRE (Pitch { std::numeric_limits<double>::quiet_NaN() }.isMicrotone());
+	STATIC_REQUIRE (Pitch { 60.4 }.approximatelyEqual (Pitch { 59.6 }));
+	STATIC_REQUIRE (Pitch { 64 }.inOctave (2) == Pitch { 40 });
+
+	// rounding is half away from zero, matching std::round
+	STATIC_REQUIRE (Pitch { 60.5 }.getRoundedMidiPitch() == 61);
+	STATIC_REQUIRE (Pitch { 60.49 }.getRoundedMidiPitch() == 60);
+	STATIC_REQUIRE (Pitch { -0.5 }.getRoundedMidiPitch() == -1);
+	STATIC_REQUIRE (Pitch { -0.49 }.getRoundedMidiPitch() == 0);
+	STATIC_REQUIRE (Pitch { -12.7 }.getRoundedMidiPitch() == -13);
+
+	// a frequency of 0 gives an infinitely low MIDI pitch
+	REQUIRE (! Pitch::fromFreq (0.).isMicrotone());
+}
+
+TEST_CASE ("Pitch - negative MIDI notes", TAGS)
+{
+	STATIC_REQUIRE (Pitch { -1 }.getPitchClass() == PitchClass { 11 });
+	STATIC_REQUIRE (Pitch { -12 }.getPitchClass() == PitchClass { 0 });
+	STATIC_REQUIRE (Pitch { -13 }.getPitchClass() == PitchClass { 11 });
+	STATIC_REQUIRE (Pitch { -1 }.getOctaveNumber() == -2);
+	STATIC_REQUIRE (Pitch { -12 }.getOctaveNumber() == -2);
+	STATIC_REQUIRE (Pitch { -13 }.getOctaveNumber() == -3);
+	STATIC_REQUIRE (Pitch { -2 }.isBlackKey());
+
+	for (auto midi = -48; midi < 0; ++midi)
+	{
+		INFO ("MIDI pitch: " << midi);
+
+		const Pitch p { midi };
+
+		REQUIRE (p.getPitchClass() == p.inOctave (4).getPitchClass());
+		REQUIRE (Pitch { p.getPitchClass(), p.getOctaveNumber() } == p);
+	}
+}
+
 #undef TAGS
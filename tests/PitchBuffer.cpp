@@ -0,0 +1,138 @@
+/*
+ * ======================================================================================
+ *  __    ____  __  __  ____  ___
+ * (  )  (_  _)(  \/  )( ___)/ __)
+ *  )(__  _)(_  )    (  )__) \__ \
+ * (____)(____)(_/\/\_)(____)(___/
+ *
+ *  This file is part of the Limes open source library and is licensed under the terms of the GNU Public License.
+ *
+ *  Commercial licenses are available; contact the maintainers at ben.the.vining@gmail.com to inquire for details.
+ *
+ * ======================================================================================
+ */
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include "lharmony/lharmony.h"
+#include <catch2/catch_test_macros.hpp>
+
+#define TAGS "[audio][harmony][pitch_buffer]"
+
+using namespace limes::harmony;	 // NOLINT
+
+namespace
+{
+
+// quarter-tone steps from well below MIDI 0 to well above 127, including every halfway value; the odd length leaves a partial SIMD block at the end
+[[nodiscard]] PitchBuffer makeTestBuffer()
+{
+	PitchBuffer buffer;
+
+	for (auto i = -201; i <= 601; ++i)
+		buffer.add (Pitch { static_cast<double> (i) * 0.25 });
+
+	return buffer;
+}
+
+}  // namespace
+
+TEST_CASE ("PitchBuffer - construction and access", TAGS)
+{
+	PitchBuffer buffer;
+
+	REQUIRE (buffer.isEmpty());
+	REQUIRE (buffer.size() == 0);
+
+	buffer.add (Pitch { 60 });
+	buffer.add (Pitch { 64.5 });
+
+	REQUIRE (buffer.size() == 2);
+	REQUIRE (buffer[1] == Pitch { 64.5 });
+	REQUIRE (buffer == PitchBuffer { Pitch { 60 }, Pitch { 64.5 } });
+
+	const std::vector<double> midiPitches { 60., 64.5 };
+
+	REQUIRE (buffer == PitchBuffer { midiPitches });
+	REQUIRE (buffer.getMidiPitches()[1] == 64.5);
+
+	const std::vector<Pitch> pitches { buffer.begin(), buffer.end() };
+
+	REQUIRE (PitchBuffer { pitches } == buffer);
+
+	buffer.resize (5, Pitch { 72 });
+
+	REQUIRE (buffer.size() == 5);
+	REQUIRE (buffer[4] == Pitch { 72 });
+	REQUIRE (buffer != PitchBuffer { Pitch { 60 }, Pitch { 64.5 } });
+
+	REQUIRE (reinterpret_cast<std::uintptr_t> (buffer.getPitches().data()) % PitchBuffer::alignment == 0);	// NOLINT
+
+	buffer.clear();
+	REQUIRE (buffer.isEmpty());
+}
+
+TEST_CASE ("PitchBuffer - analysis", TAGS)
+{
+	const auto buffer = makeTestBuffer();
+
+	const auto num = buffer.size();
+
+	std::vector<int>  roundedNotes (num), pitchClasses (num), octaves (num);
+
+	buffer.getRoundedMidiPitches (roundedNotes);
+	buffer.getPitchClasses (pitchClasses);
+	buffer.getOctaveNumbers (octaves);
+
+	// std::vector<bool> can't be viewed as a span
+	auto blackKeyFlags = std::make_unique<bool[]> (num);
+	auto whiteKeyFlags = std::make_unique<bool[]> (num);
+
+	buffer.getBlackKeyFlags ({ blackKeyFlags.get(), num });
+	buffer.getWhiteKeyFlags ({ whiteKeyFlags.get(), num });
+
+	for (auto i = 0UL; i < num; ++i)
+	{
+		const auto& pitch = buffer[i];
+
+		INFO ("MIDI pitch: " << pitch.getMidiPitch());
+
+		REQUIRE (roundedNotes[i] == pitch.getRoundedMidiPitch());
+		REQUIRE (pitchClasses[i] == pitch.getPitchClass().getAsInt());
+		REQUIRE (octaves[i] == pitch.getOctaveNumber());
+		REQUIRE (blackKeyFlags[i] == pitch.isBlackKey());
+		REQUIRE (whiteKeyFlags[i] == pitch.isWhiteKey());
+	}
+}
+
+TEST_CASE ("PitchBuffer - transposition and rounding", TAGS)
+{
+	const auto original = makeTestBuffer();
+
+	auto buffer = original;
+
+	buffer.transpose (Interval { 5, Interval::Quality::Perfect });
+
+	for (auto i = 0UL; i < buffer.size(); ++i)
+		REQUIRE (buffer[i].getMidiPitch() == original[i].getMidiPitch() + 7.);
+
+	buffer.transpose (Interval { 5, Interval::Quality::Perfect }, false);
+	REQUIRE (buffer == original);
+
+	buffer.transpose (MicrotonalInterval { 0.25 });
+
+	for (auto i = 0UL; i < buffer.size(); ++i)
+		REQUIRE (buffer[i] == MicrotonalInterval { 0.25 }.applyToPitch (original[i], true));
+
+	buffer = original;
+	buffer.round();
+
+	for (auto i = 0UL; i < buffer.size(); ++i)
+	{
+		INFO ("MIDI pitch: " << original[i].getMidiPitch());
+		REQUIRE (buffer[i].getMidiPitch() == static_cast<double> (original[i].getRoundedMidiPitch()));
+	}
+}
+
+#undef TAGS
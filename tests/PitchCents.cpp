@@ -0,0 +1,119 @@
+/*
+ * ======================================================================================
+ *  __    ____  __  __  ____  ___
+ * (  )  (_  _)(  \/  )( ___)/ __)
+ *  )(__  _)(_  )    (  )__) \__ \
+ * (____)(____)(_/\/\_)(____)(___/
+ *
+ *  This file is part of the Limes open source library and is licensed under the terms of the GNU Public License.
+ *
+ *  Commercial licenses are available; contact the maintainers at ben.the.vining@gmail.com to inquire for details.
+ *
+ * ======================================================================================
+ */
+
+#include <algorithm>
+#include <unordered_set>
+#include <vector>
+#include "lharmony/lharmony.h"
+#include <catch2/catch_test_macros.hpp>
+
+#define TAGS "[audio][harmony][pitch][pitch_cents]"
+
+using namespace limes::harmony;	 // NOLINT
+
+TEST_CASE ("PitchCents - conversions", TAGS)
+{
+	STATIC_REQUIRE (PitchCents {}.getCents() == 6000);
+	STATIC_REQUIRE (PitchCents::fromMidiNote (69).getCents() == 6900);
+	STATIC_REQUIRE (PitchCents { Pitch { 60.5 } }.getCents() == 6050);
+	STATIC_REQUIRE (PitchCents { Pitch { 60.004 } }.getCents() == 6000);
+	STATIC_REQUIRE (PitchCents { Pitch { -1.256 } }.getCents() == -126);
+	STATIC_REQUIRE (PitchCents { 6050 }.toPitch() == Pitch { 60.5 });
+
+	// every cent value must survive a round trip through Pitch
+	for (auto cents = -2400; cents <= 13000; ++cents)
+	{
+		const PitchCents original { cents };
+
+		REQUIRE (PitchCents::fromPitch (original.toPitch()) == original);
+	}
+}
+
+TEST_CASE ("PitchCents - queries", TAGS)
+{
+	STATIC_REQUIRE (PitchCents { 6049 }.getNearestMidiNote() == 60);
+	STATIC_REQUIRE (PitchCents { 6050 }.getNearestMidiNote() == 61);
+	STATIC_REQUIRE (PitchCents { 6050 }.getCentsOffset() == -50);
+	STATIC_REQUIRE (PitchCents { 6049 }.getCentsOffset() == 49);
+	STATIC_REQUIRE (PitchCents { -30 }.getNearestMidiNote() == 0);
+	STATIC_REQUIRE (PitchCents { -70 }.getNearestMidiNote() == -1);
+	STATIC_REQUIRE (PitchCents { -70 }.getCentsOffset() == 30);
+	STATIC_REQUIRE (PitchCents { -50 }.getNearestMidiNote() == -1);
+	STATIC_REQUIRE (PitchCents { -50 }.getCentsOffset() == 50);
+	STATIC_REQUIRE (PitchCents { -49 }.getNearestMidiNote() == 0);
+	STATIC_REQUIRE (PitchCents { -150 }.getNearestMidiNote() == -2);
+	STATIC_REQUIRE (PitchCents { -70 }.getPitchClass() == PitchClass { 11 });
+	STATIC_REQUIRE (PitchCents { 6920 }.getOctaveNumber() == 4);
+	STATIC_REQUIRE (PitchCents { 6920 }.isMicrotone());
+	STATIC_REQUIRE (! PitchCents { 6900 }.isMicrotone());
+	STATIC_REQUIRE (! PitchCents { -100 }.isMicrotone());
+
+	for (auto cents = -2400; cents <= 13000; ++cents)
+	{
+		const PitchCents pitch { cents };
+
+		REQUIRE (pitch.getCentsOffset() >= -50);
+		REQUIRE (pitch.getCentsOffset() <= 50);
+		REQUIRE (pitch.getNearestMidiNote() * PitchCents::centsPerSemitone + pitch.getCentsOffset() == cents);
+
+		// both pitch types round halfway values the same way
+		REQUIRE (pitch.getNearestMidiNote() == pitch.toPitch().getRoundedMidiPitch());
+		REQUIRE (pitch.getPitchClass() == pitch.toPitch().getPitchClass());
+		REQUIRE (pitch.getOctaveNumber() == pitch.toPitch().getOctaveNumber());
+	}
+}
+
+TEST_CASE ("PitchCents - arithmetic", TAGS)
+{
+	constexpr PitchCents middleC;
+
+	STATIC_REQUIRE (middleC + 25 == PitchCents { 6025 });
+	STATIC_REQUIRE (middleC - 25 == PitchCents { 5975 });
+	STATIC_REQUIRE ((middleC + 700) - middleC == 700);
+	STATIC_REQUIRE (middleC + MicrotonalInterval { 0.5 } == PitchCents { 6050 });
+	STATIC_REQUIRE (middleC - MicrotonalInterval { 12.25 } == PitchCents { 4775 });
+	STATIC_REQUIRE (PitchCents { 6350 }.intervalFrom (middleC) == MicrotonalInterval { 3.5 });
+
+	STATIC_REQUIRE (middleC < middleC + 1);
+	STATIC_REQUIRE (middleC + 1 > middleC);
+	STATIC_REQUIRE (middleC <= middleC);
+	STATIC_REQUIRE (middleC >= middleC);
+	STATIC_REQUIRE (middleC != middleC + 1);
+
+	auto p = middleC;
+	p += 150;
+	p -= 50;
+	REQUIRE (p == PitchCents::fromMidiNote (61));
+}
+
+TEST_CASE ("PitchCents - sorting, dedupe and hashing", TAGS)
+{
+	std::vector<PitchCents> pitches;
+
+	for (const auto midi : { 60.5, 64., 60.5, 67.25, 64.0001, 60.4999 })
+		pitches.emplace_back (Pitch { midi });
+
+	std::sort (pitches.begin(), pitches.end());
+	pitches.erase (std::unique (pitches.begin(), pitches.end()), pitches.end());
+
+	REQUIRE (pitches == std::vector<PitchCents> { PitchCents { 6050 }, PitchCents { 6400 }, PitchCents { 6725 } });
+
+	std::unordered_set<PitchCents> set { pitches.begin(), pitches.end() };
+
+	REQUIRE (set.size() == 3);
+	REQUIRE (set.contains (PitchCents { Pitch { 64.0002 } }));
+	REQUIRE (! set.contains (PitchCents { 6401 }));
+}
+
+#undef TAGS
@@ -0,0 +1,218 @@
+/*
+ * ======================================================================================
+ *  __    ____  __  __  ____  ___
+ * (  )  (_  _)(  \/  )( ___)/ __)
+ *  )(__  _)(_  )    (  )__) \__ \
+ * (____)(____)(_/\/\_)(____)(___/
+ *
+ *  This file is part of the Limes open source library and is licensed under the terms of the GNU Public License.
+ *
+ *  Commercial licenses are available; contact the maintainers at ben.the.vining@gmail.com to inquire for details.
+ *
+ * ======================================================================================
+ */
+
+#include <type_traits>
+#include "lharmony/lharmony.h"
+#include <catch2/catch_test_macros.hpp>
+
+#define TAGS "[audio][harmony][pitch_class_set]"
+
+using namespace limes::harmony;	 // NOLINT
+using PC = PitchClass;
+
+TEST_CASE ("PitchClassSet - basic operations", TAGS)
+{
+	STATIC_REQUIRE (PitchClassSet {}.isEmpty());
+	STATIC_REQUIRE (PitchClassSet::all().size() == 12);
+	STATIC_REQUIRE ((~PitchClassSet {}) == PitchClassSet::all());
+
+	constexpr PitchClassSet cMajorTriad { PC { 0 }, PC { 4 }, PC { 7 } };
+	constexpr PitchClassSet aMinorTriad { PC { 9 }, PC { 0 }, PC { 4 } };
+
+	STATIC_REQUIRE (cMajorTriad.size() == 3);
+	STATIC_REQUIRE (cMajorTriad.contains (PC { 4 }));
+	STATIC_REQUIRE (! cMajorTriad.contains (PC { 5 }));
+
+	STATIC_REQUIRE ((cMajorTriad | aMinorTriad).size() == 4);
+	STATIC_REQUIRE ((cMajorTriad & aMinorTriad) == PitchClassSet { PC { 0 }, PC { 4 } });
+	STATIC_REQUIRE ((cMajorTriad - aMinorTriad) == PitchClassSet { PC { 7 } });
+	STATIC_REQUIRE ((cMajorTriad ^ aMinorTriad) == PitchClassSet { PC { 7 }, PC { 9 } });
+	STATIC_REQUIRE ((~cMajorTriad).size() == 9);
+	STATIC_REQUIRE (((~cMajorTriad) & cMajorTriad).isEmpty());
+
+	STATIC_REQUIRE (cMajorTriad.getLowest() == PC { 0 });
+	STATIC_REQUIRE (cMajorTriad.getHighest() == PC { 7 });
+
+	auto set = cMajorTriad;
+
+	set.add (PC { 11 });
+	REQUIRE (set.size() == 4);
+
+	set.add (PC { 11 });
+	REQUIRE (set.size() == 4);
+
+	set.remove (PC { 0 });
+	REQUIRE (set == PitchClassSet { PC { 4 }, PC { 7 }, PC { 11 } });
+
+	REQUIRE (PitchClassSet::all().containsAll (set));
+	REQUIRE (! set.containsAll (cMajorTriad));
+	REQUIRE (set.intersects (cMajorTriad));
+
+	set.clear();
+	REQUIRE (set.isEmpty());
+}
+
+TEST_CASE ("PitchClassSet - transposition", TAGS)
+{
+	constexpr PitchClassSet cMajorTriad { PC { 0 }, PC { 4 }, PC { 7 } };
+
+	STATIC_REQUIRE (cMajorTriad.transposed (0) == cMajorTriad);
+	STATIC_REQUIRE (cMajorTriad.transposed (12) == cMajorTriad);
+	STATIC_REQUIRE (cMajorTriad.transposed (-12) == cMajorTriad);
+
+	// A major: A, C#, E
+	STATIC_REQUIRE (cMajorTriad.transposed (9) == PitchClassSet { PC { 9 }, PC { 1 }, PC { 4 } });
+	STATIC_REQUIRE (cMajorTriad.transposed (-3) == cMajorTriad.transposed (9));
+
+	for (auto semitones = -24; semitones <= 24; ++semitones)
+	{
+		INFO ("Semitones: " << semitones);
+
+		const auto transposed = cMajorTriad.transposed (semitones);
+
+		REQUIRE (transposed.size() == cMajorTriad.size());
+		REQUIRE (transposed.transposed (-semitones) == cMajorTriad);
+	}
+}
+
+TEST_CASE ("PitchClassSet - iteration", TAGS)
+{
+	constexpr PitchClassSet set { PC { 11 }, PC { 2 }, PC { 7 }, PC { 0 } };
+
+	std::vector<PitchClass> pitchClasses { set.begin(), set.end() };
+
+	REQUIRE (pitchClasses == std::vector<PitchClass> { PC { 0 }, PC { 2 }, PC { 7 }, PC { 11 } });
+
+	auto count = 0;
+
+	for (const auto pc : PitchClassSet::all())
+		REQUIRE (pc.getAsInt() == count++);
+
+	REQUIRE (count == 12);
+
+	for (const auto pc : PitchClassSet {})
+		FAIL ("Iterated over an empty set: " << pc);
+}
+
+TEST_CASE ("PitchClassSet - scales", TAGS)
+{
+	auto test_scale = [] (const scales::Scale& scale)
+	{
+		const auto set = scale.getPitchClassSet();
+
+		PitchClassSet expected;
+
+		for (const auto pc : scale.getPitchClasses())
+			expected.add (pc);
+
+		REQUIRE (set == expected);
+
+		for (const auto pc : PitchClass::getAll())
+			REQUIRE (scale.containsPitchClass (pc) == expected.contains (pc));
+	};
+
+	for (const auto root : PitchClass::getAll())
+	{
+		INFO ("Root: " << root);
+
+		test_scale (scales::KeySignature { scales::KeySignature::Type::Major, root });
+		test_scale (scales::KeySignature { scales::KeySignature::Type::NaturalMinor, root });
+		test_scale (scales::KeySignature { scales::KeySignature::Type::HarmonicMinor, root });
+
+		test_scale (scales::Mode { scales::Mode::Type::Ionian, root });
+		test_scale (scales::Mode { scales::Mode::Type::Dorian, root });
+		test_scale (scales::Mode { scales::Mode::Type::Phrygian, root });
+		test_scale (scales::Mode { scales::Mode::Type::Lydian, root });
+		test_scale (scales::Mode { scales::Mode::Type::Mixolydian, root });
+		test_scale (scales::Mode { scales::Mode::Type::Aeolian, root });
+		test_scale (scales::Mode { scales::Mode::Type::Locrian, root });
+
+		test_scale (scales::Chromatic { root });
+		test_scale (scales::WholeTone { root });
+		test_scale (scales::Octatonic { root, true });
+		test_scale (scales::Octatonic { root, false });
+	}
+}
+
+TEST_CASE ("PitchClassSet - chords", TAGS)
+{
+	const Chord chord { 60, 64, 67, 72, 76 };
+
+	const auto set = chord.getPitchClassSet();
+
+	REQUIRE (set == PitchClassSet { PC { 0 }, PC { 4 }, PC { 7 } });
+	REQUIRE (chord.getNumUniquePitchClasses() == 3);
+	REQUIRE (chord.getPitchClasses() == std::vector<PitchClass> { PC { 0 }, PC { 4 }, PC { 7 } });
+
+	REQUIRE (chord.fitsInScale (scales::keys::major::c));
+	REQUIRE (chord.fitsInScale (scales::keys::major::g));
+	REQUIRE (! chord.fitsInScale (scales::keys::major::d));
+}
+
+TEST_CASE ("BasicPitchClassSet - other divisions of the octave", TAGS)
+{
+	using PC31	= BasicPitchClass<31>;
+	using Set31 = BasicPitchClassSet<31>;
+	using Set53 = BasicPitchClassSet<53>;
+
+	STATIC_REQUIRE (std::is_same_v<PitchClass, BasicPitchClass<12>>);
+	STATIC_REQUIRE (std::is_same_v<PitchClassSet, BasicPitchClassSet<12>>);
+	STATIC_REQUIRE (sizeof (BasicPitchClassSet<19>::Mask) == 4);
+	STATIC_REQUIRE (sizeof (Set53::Mask) == 8);
+	STATIC_REQUIRE (BasicPitchClassSet<64>::all().size() == 64);
+
+	STATIC_REQUIRE (PC31 { 31 } == PC31 { 0 });
+	STATIC_REQUIRE (PC31 { -1 }.getAsInt() == 30);
+	STATIC_REQUIRE (PC31::getAll().size() == 31);
+	STATIC_REQUIRE (BasicPitchClass<24> { 12 }.getCents() == 600.);
+
+	STATIC_REQUIRE (Set31::all().size() == 31);
+	STATIC_REQUIRE (Set31::allPitchClassesMask == (1U << 31U) - 1U);
+	STATIC_REQUIRE ((~Set31 {}) == Set31::all());
+
+	// a 31-EDO major triad: the major third is 10 steps, and the fifth is 18
+	constexpr Set31 majorTriad { PC31 { 0 }, PC31 { 10 }, PC31 { 18 } };
+
+	STATIC_REQUIRE (majorTriad.size() == 3);
+	STATIC_REQUIRE (majorTriad.contains (PC31 { 10 }));
+	STATIC_REQUIRE (! majorTriad.contains (PC31 { 11 }));
+	STATIC_REQUIRE (majorTriad.getHighest() == PC31 { 18 });
+	STATIC_REQUIRE (majorTriad.transposed (13) == Set31 { PC31 { 13 }, PC31 { 23 }, PC31 { 0 } });
+	STATIC_REQUIRE (majorTriad.transposed (-31) == majorTriad);
+	STATIC_REQUIRE ((~majorTriad).size() == 28);
+
+	for (auto steps = -53; steps <= 53; ++steps)
+	{
+		INFO ("Transposition: " << steps);
+
+		const auto set = Set53 { BasicPitchClass<53> { 0 }, BasicPitchClass<53> { 52 }, BasicPitchClass<53> { 31 } };
+
+		const auto transposed = set.transposed (steps);
+
+		REQUIRE (transposed.size() == 3);
+		REQUIRE (transposed.transposed (-steps) == set);
+
+		for (const auto pc : set)
+			REQUIRE (transposed.contains (BasicPitchClass<53> { pc.getAsInt() + steps }));
+	}
+
+	std::vector<int> steps;
+
+	for (const auto pc : majorTriad)
+		steps.push_back (pc.getAsInt());
+
+	REQUIRE (steps == std::vector<int> { 0, 10, 18 });
+}
+
+#undef TAGS
@@ -0,0 +1,227 @@
+/*
+ * ======================================================================================
+ *  __    ____  __  __  ____  ___
+ * (  )  (_  _)(  \/  )( ___)/ __)
+ *  )(__  _)(_  )    (  )__) \__ \
+ * (____)(____)(_/\/\_)(____)(___/
+ *
+ *  This file is part of the Limes open source library and is licensed under the terms of the GNU Public License.
+ *
+ *  Commercial licenses are available; contact the maintainers at ben.the.vining@gmail.com to inquire for details.
+ *
+ * ======================================================================================
+ */
+
+#include <array>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <utility>
+#include "lharmony/lharmony.h"
+#include <catch2/catch_test_macros.hpp>
+
+#define TAGS "[audio][harmony][pitch_names]"
+
+using namespace limes::harmony;	 // NOLINT
+using Letter = PitchSpelling::Letter;
+
+namespace
+{
+
+template <typename T>
+[[nodiscard]] std::from_chars_result parse (std::string_view string, T& value)
+{
+	return fromChars (string.data(), string.data() + string.size(), value);
+}
+
+[[nodiscard]] Pitch parsePitch (std::string_view string)
+{
+	Pitch pitch { -1000 };
+
+	const auto result = parse (string, pitch);
+
+	REQUIRE (result.ec == std::errc {});
+	REQUIRE (result.ptr == string.data() + string.size());
+
+	return pitch;
+}
+
+template <typename... Args>
+[[nodiscard]] std::string formatName (Args&&... args)
+{
+	std::array<char, maxPitchNameLength> buffer;
+
+	const auto result = toChars (buffer.data(), buffer.data() + buffer.size(), std::forward<Args> (args)...);
+
+	REQUIRE (result.ec == std::errc {});
+
+	return { buffer.data(), result.ptr };
+}
+
+}  // namespace
+
+TEST_CASE ("Pitch names - parsing", TAGS)
+{
+	REQUIRE (parsePitch ("C4") == Pitch { 60 });
+	REQUIRE (parsePitch ("C#4") == Pitch { 61 });
+	REQUIRE (parsePitch ("Db4") == Pitch { 61 });
+	REQUIRE (parsePitch ("a4") == Pitch { 69 });
+	REQUIRE (parsePitch ("C-1") == Pitch { 0 });
+	REQUIRE (parsePitch ("Bb-1") == Pitch { 10 });
+	REQUIRE (parsePitch ("G9") == Pitch { 127 });
+	REQUIRE (parsePitch ("C-2") == Pitch { -12 });
+
+	// double accidentals, and written octaves across the B-C boundary
+	REQUIRE (parsePitch ("B#3") == Pitch { 60 });
+	REQUIRE (parsePitch ("Cb4") == Pitch { 59 });
+	REQUIRE (parsePitch ("Bx3") == Pitch { 61 });
+	REQUIRE (parsePitch ("B##3") == Pitch { 61 });
+	REQUIRE (parsePitch ("Dbb4") == Pitch { 60 });
+	REQUIRE (parsePitch ("bb4") == Pitch { 70 });
+
+	// cent offsets
+	REQUIRE (parsePitch ("A4+25c") == Pitch { 69.25 });
+	REQUIRE (parsePitch ("A4-50c") == Pitch { 68.5 });
+	REQUIRE (parsePitch ("Eb2-12.5c") == Pitch { 39. - 0.125 });
+	REQUIRE (parsePitch ("C-1+150c") == Pitch { 1.5 });
+
+	// parsing stops at the first character that isn't part of the name
+	{
+		constexpr std::string_view string { "F#3 G4" };
+
+		Pitch pitch { 0 };
+
+		const auto result = parse (string, pitch);
+
+		REQUIRE (result.ec == std::errc {});
+		REQUIRE (result.ptr == string.data() + 3);
+		REQUIRE (pitch == Pitch { 54 });
+	}
+
+	// an invalid cents offset is not part of the name
+	for (const auto string : { std::string_view { "A4+25" }, std::string_view { "A4+c" }, std::string_view { "A4-" }, std::string_view { "A4+x5c" } })
+	{
+		INFO (string);
+
+		Pitch pitch { 0 };
+
+		const auto result = parse (string, pitch);
+
+		REQUIRE (result.ec == std::errc {});
+		REQUIRE (result.ptr == string.data() + 2);
+		REQUIRE (pitch == Pitch { 69 });
+	}
+
+	// only two accidentals are consumed, and sharps and flats are not mixed
+	{
+		constexpr std::string_view string { "C###" };
+
+		PitchSpelling spelling;
+
+		const auto result = parse (string, spelling);
+
+		REQUIRE (result.ptr == string.data() + 3);
+		REQUIRE (spelling == PitchSpelling { Letter::C, 2 });
+
+		REQUIRE (parse (std::string_view { "Ebb" }, spelling).ec == std::errc {});
+		REQUIRE (spelling == PitchSpelling { Letter::E, -2 });
+
+		REQUIRE (parse (std::string_view { "F#b" }, spelling).ptr == std::string_view { "F#b" }.data() + 2);
+	}
+
+	for (const auto string : { std::string_view {}, std::string_view { "H4" }, std::string_view { " C4" }, std::string_view { "C" }, std::string_view { "C#" },
+							   std::string_view { "C+4" }, std::string_view { "#4" } })
+	{
+		INFO (string);
+
+		Pitch pitch { 0 };
+
+		const auto result = parse (string, pitch);
+
+		REQUIRE (result.ec == std::errc::invalid_argument);
+		REQUIRE (result.ptr == string.data());
+		REQUIRE (pitch == Pitch { 0 });
+	}
+
+	{
+		Pitch pitch { 0 };
+
+		REQUIRE (parse (std::string_view { "C99999999999" }, pitch).ec == std::errc::result_out_of_range);
+		REQUIRE (parse (std::string_view { "C999999999" }, pitch).ec == std::errc::result_out_of_range);
+		REQUIRE (pitch == Pitch { 0 });
+	}
+
+	PitchClass pitchClass { 0 };
+
+	REQUIRE (parse (std::string_view { "Gb" }, pitchClass).ec == std::errc {});
+	REQUIRE (pitchClass == PitchClass { 6 });
+
+	REQUIRE (parse (std::string_view { "B#" }, pitchClass).ec == std::errc {});
+	REQUIRE (pitchClass == PitchClass { 0 });
+
+	REQUIRE (parse (std::string_view { "Q" }, pitchClass).ec == std::errc::invalid_argument);
+	REQUIRE (pitchClass == PitchClass { 0 });
+}
+
+TEST_CASE ("Pitch names - formatting", TAGS)
+{
+	REQUIRE (formatName (Pitch { 60 }) == "C4");
+	REQUIRE (formatName (Pitch { 61 }) == "C#4");
+	REQUIRE (formatName (Pitch { 61 }, false) == "Db4");
+	REQUIRE (formatName (Pitch { 10 }, false) == "Bb-1");
+	REQUIRE (formatName (Pitch { -12 }) == "C-2");
+	REQUIRE (formatName (Pitch { 69.25 }) == "A4+25c");
+	REQUIRE (formatName (Pitch { 68.5 }) == "A4-50c");
+	REQUIRE (formatName (Pitch { 60.001 }) == "C4");
+
+	REQUIRE (formatName (PitchClass { 3 }) == "D#");
+	REQUIRE (formatName (PitchClass { 3 }, false) == "Eb");
+	REQUIRE (formatName (PitchSpelling { Letter::D, -2 }) == "Dbb");
+
+	// spellings in a key, with the written octave
+	const PitchSpeller cSharpMajor { scales::KeySignature { 7, true, scales::KeySignature::Type::Major } };
+
+	REQUIRE (formatName (Pitch { 60 }, cSharpMajor) == "B#3");
+	REQUIRE (formatName (Pitch { 65.1 }, cSharpMajor) == "E#4+10c");
+
+	const PitchSpeller cFlatMajor { scales::KeySignature { 7, false, scales::KeySignature::Type::Major } };
+
+	REQUIRE (formatName (Pitch { 59 }, cFlatMajor) == "Cb4");
+
+	// the longest names fit in the maximum length
+	REQUIRE (formatName (Pitch { -2147483000.5 }, cFlatMajor).size() <= maxPitchNameLength);
+
+	// buffers that are too small
+	std::array<char, 4> buffer;
+
+	for (auto size = 0UL; size < 4; ++size)
+	{
+		const auto result = toChars (buffer.data(), buffer.data() + size, Pitch { 69.25 });
+
+		REQUIRE (result.ec == std::errc::value_too_large);
+		REQUIRE (result.ptr == buffer.data() + size);
+	}
+
+	// every name round-trips
+	for (auto midiNote = -30; midiNote <= 150; ++midiNote)
+	{
+		for (const auto cents : { 0, 1, -17, 49, -50 })
+		{
+			const Pitch pitch { static_cast<double> (midiNote) + static_cast<double> (cents) / 100. };
+
+			INFO (pitch.getMidiPitch());
+
+			REQUIRE (PitchCents { parsePitch (formatName (pitch)) } == PitchCents { pitch });
+			REQUIRE (PitchCents { parsePitch (formatName (pitch, false)) } == PitchCents { pitch });
+			REQUIRE (PitchCents { parsePitch (formatName (pitch, cSharpMajor)) } == PitchCents { pitch });
+			REQUIRE (PitchCents { parsePitch (formatName (pitch, cFlatMajor)) } == PitchCents { pitch });
+		}
+	}
+
+#ifdef __cpp_lib_format
+	REQUIRE (std::format ("{} {:b} {:#}", Pitch { 61 }, Pitch { 61 }, PitchClass { 10 }) == "C#4 Db4 A#");
+	REQUIRE (std::format ("{}", PitchSpelling { Letter::E, 1 }) == "E#");
+#endif
+}
+
+#undef TAGS
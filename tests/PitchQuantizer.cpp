@@ -0,0 +1,244 @@
+/*
+ * ======================================================================================
+ *  __    ____  __  __  ____  ___
+ * (  )  (_  _)(  \/  )( ___)/ __)
+ *  )(__  _)(_  )    (  )__) \__ \
+ * (____)(____)(_/\/\_)(____)(___/
+ *
+ *  This file is part of the Limes open source library and is licensed under the terms of the GNU Public License.
+ *
+ *  Commercial licenses are available; contact the maintainers at ben.the.vining@gmail.com to inquire for details.
+ *
+ * ======================================================================================
+ */
+
+#include <cmath>
+#include <limits>
+#include <vector>
+#include "lharmony/lharmony.h"
+#include <catch2/catch_all.hpp>
+
+#define TAGS "[audio][harmony][pitch_quantizer]"
+
+using namespace limes::harmony;	 // NOLINT
+using PC = PitchClass;
+
+namespace
+{
+
+// a spread of pitches, including halfway values and negative pitches, whose length is not a multiple of any SIMD width
+[[nodiscard]] std::vector<double> makeInputs()
+{
+	std::vector<double> inputs;
+
+	for (auto i = -400; i <= 1400; ++i)
+		inputs.push_back (static_cast<double> (i) * 0.0987);
+
+	for (auto i = -30; i <= 150; ++i)
+		inputs.push_back (static_cast<double> (i) * 0.5);
+
+	inputs.push_back (127.);
+
+	return inputs;
+}
+
+void checkBatchMatchesSingle (const PitchQuantizer& quantizer)
+{
+	const auto inputs = makeInputs();
+
+	std::vector<double> quantized (inputs.size());
+	std::vector<double> deviations (inputs.size());
+
+	quantizer.quantize (inputs, quantized, deviations);
+
+	for (auto i = 0UL; i < inputs.size(); ++i)
+	{
+		INFO ("Input: " << inputs[i]);
+
+		REQUIRE (quantized[i] == quantizer.quantize (inputs[i]));
+		REQUIRE (deviations[i] == (inputs[i] - quantized[i]) * 100.);
+	}
+}
+
+}  // namespace
+
+TEST_CASE ("PitchQuantizer - equal divisions of the octave", TAGS)
+{
+	const PitchQuantizer semitones;
+
+	REQUIRE (semitones.quantize (60.4) == 60.);
+	REQUIRE (semitones.quantize (60.5) == 61.);
+	REQUIRE (semitones.quantize (60.6) == 61.);
+	REQUIRE (semitones.quantize (-0.5) == 0.);
+	REQUIRE (semitones.quantize (-0.6) == -1.);
+	REQUIRE (semitones.quantize (Pitch { 69.2 }) == Pitch { 69 });
+
+	const PitchQuantizer quarterTones { 24 };
+
+	REQUIRE (quarterTones.quantize (60.3) == 60.5);
+	REQUIRE (quarterTones.quantize (60.2) == 60.);
+
+	// in 31-EDO, each step is 12/31 of a semitone
+	const PitchQuantizer edo31 { 31 };
+
+	REQUIRE_THAT (edo31.quantize (60.2), Catch::Matchers::WithinAbs (60. + 12. / 31., 1e-9));
+	REQUIRE_THAT (edo31.quantize (72.), Catch::Matchers::WithinAbs (72., 1e-9));
+
+	for (const auto edo : { 1, 12, 19, 24, 31, 53, 72 })
+	{
+		INFO ("EDO: " << edo);
+
+		const PitchQuantizer quantizer { edo };
+
+		checkBatchMatchesSingle (quantizer);
+
+		// every output is a whole number of steps, and no more than half a step away
+		for (const auto input : makeInputs())
+		{
+			const auto output = quantizer.quantize (input);
+			const auto steps  = output * static_cast<double> (edo) / 12.;
+
+			REQUIRE_THAT (steps, Catch::Matchers::WithinAbs (std::round (steps), 1e-6));
+			REQUIRE (std::abs (output - input) <= 6. / static_cast<double> (edo) + 1e-9);
+		}
+	}
+}
+
+TEST_CASE ("PitchQuantizer - scales", TAGS)
+{
+	const PitchQuantizer cMajor { scales::KeySignature { scales::KeySignature::Type::Major, PC { 0 } } };
+
+	REQUIRE (cMajor.quantize (60.) == 60.);
+	REQUIRE (cMajor.quantize (60.9) == 60.);
+	REQUIRE (cMajor.quantize (61.) == 62.);	 // halfway between C and D
+	REQUIRE (cMajor.quantize (64.4) == 64.);
+	REQUIRE (cMajor.quantize (64.6) == 65.);	 // E and F are a semitone apart
+	REQUIRE (cMajor.quantize (70.) == 71.);
+	REQUIRE (cMajor.quantize (71.6) == 72.);
+	REQUIRE (cMajor.quantize (-1.2) == -1.);
+	REQUIRE (cMajor.quantize (-0.4) == 0.);
+
+	const PitchQuantizer single { PitchClassSet { PC { 9 } } };
+
+	REQUIRE (single.quantize (60.) == 57.);
+	REQUIRE (single.quantize (63.) == 69.);
+	REQUIRE (single.quantize (75.) == 81.);
+
+	checkBatchMatchesSingle (cMajor);
+	checkBatchMatchesSingle (single);
+	checkBatchMatchesSingle (PitchQuantizer { scales::WholeTone { PC { 1 } } });
+	checkBatchMatchesSingle (PitchQuantizer { scales::Mode { scales::Mode::Type::Phrygian, PC { 4 } } });
+	checkBatchMatchesSingle (PitchQuantizer { PitchClassSet::all() });
+
+	// quantizing to every pitch class is the same as quantizing to semitones
+	for (const auto input : makeInputs())
+		REQUIRE (PitchQuantizer { PitchClassSet::all() }.quantize (input) == PitchQuantizer {}.quantize (input));
+
+	// every output is in the scale, and no other note in the scale is nearer
+	const scales::Octatonic octatonic { PC { 2 }, false };
+
+	const PitchQuantizer quantizer { octatonic };
+
+	for (const auto input : makeInputs())
+	{
+		INFO ("Input: " << input);
+
+		const auto output = quantizer.quantize (input);
+
+		REQUIRE (output == std::round (output));
+		REQUIRE (octatonic.containsPitch (static_cast<int> (output)));
+
+		for (const auto other : octatonic.getPitches (static_cast<int> (std::floor (input)) - 12, static_cast<int> (std::floor (input)) + 12))
+			REQUIRE (std::abs (output - input) <= std::abs (other.getMidiPitch() - input));
+	}
+}
+
+TEST_CASE ("PitchQuantizer - pitch buffers", TAGS)
+{
+	PitchBuffer buffer { Pitch { 60.2 }, Pitch { 61.7 }, Pitch { 64.5 }, Pitch { 66.1 }, Pitch { 70.9 } };
+
+	std::vector<double> deviations (buffer.size());
+
+	PitchQuantizer { 12 }.quantize (buffer, deviations);
+
+	REQUIRE (buffer == PitchBuffer { Pitch { 60 }, Pitch { 62 }, Pitch { 65 }, Pitch { 66 }, Pitch { 71 } });
+
+	REQUIRE_THAT (deviations[0], Catch::Matchers::WithinAbs (20., 1e-9));
+	REQUIRE_THAT (deviations[1], Catch::Matchers::WithinAbs (-30., 1e-9));
+	REQUIRE_THAT (deviations[2], Catch::Matchers::WithinAbs (-50., 1e-9));
+
+	// no deviations
+	PitchQuantizer { 24 }.quantize (buffer);
+
+	REQUIRE (buffer == PitchBuffer { Pitch { 60 }, Pitch { 62 }, Pitch { 65 }, Pitch { 66 }, Pitch { 71 } });
+}
+
+TEST_CASE ("PitchQuantizer - hysteresis", TAGS)
+{
+	PitchQuantizer quantizer;
+
+	quantizer.setHysteresis (20.);
+
+	REQUIRE (quantizer.getHysteresis() == 20.);
+
+	// one voice drifting back and forth across the boundary between C and C#
+	const std::vector<double> frames { 60.45, 60.55, 60.45, 60.65, 60.45, 60.35, 60.55, 60.1 };
+	const std::vector<double> expected { 60., 60., 60., 61., 61., 60., 60., 60. };
+
+	std::vector<double> held { std::numeric_limits<double>::quiet_NaN() };
+	std::vector<double> deviations (1);
+
+	for (auto i = 0UL; i < frames.size(); ++i)
+	{
+		INFO ("Frame: " << i);
+
+		quantizer.quantizeWithHysteresis (std::vector<double> { frames[i] }, held, deviations);
+
+		REQUIRE (held[0] == expected[i]);
+		REQUIRE (deviations[0] == (frames[i] - expected[i]) * 100.);
+	}
+
+	// many voices at once give the same results as one at a time
+	const auto inputs = makeInputs();
+
+	for (const auto& q : { PitchQuantizer { 31 }, PitchQuantizer { scales::Chromatic { PC { 0 } } }, PitchQuantizer { PitchClassSet { PC { 0 }, PC { 7 } } } })
+	{
+		auto withHysteresis = q;
+		withHysteresis.setHysteresis (30.);
+
+		std::vector<double> voices (inputs.size(), std::numeric_limits<double>::quiet_NaN());
+
+		// the first frame has no previous values
+		withHysteresis.quantizeWithHysteresis (inputs, voices);
+
+		for (auto i = 0UL; i < inputs.size(); ++i)
+			REQUIRE (voices[i] == q.quantize (inputs[i]));
+
+		// every voice moves up by a third of a semitone
+		std::vector<double> nextFrame;
+
+		for (const auto input : inputs)
+			nextFrame.push_back (input + 0.33);
+
+		auto expectedVoices = voices;
+
+		for (auto i = 0UL; i < inputs.size(); ++i)
+		{
+			std::vector<double> single { expectedVoices[i] };
+			withHysteresis.quantizeWithHysteresis (std::vector<double> { nextFrame[i] }, single);
+			expectedVoices[i] = single[0];
+
+			// a voice only moves if its new target is more than the hysteresis nearer than its old one
+			const auto nearest = q.quantize (nextFrame[i]);
+
+			if (expectedVoices[i] != nearest)
+				REQUIRE (std::abs (nextFrame[i] - expectedVoices[i]) <= std::abs (nextFrame[i] - nearest) + 0.3);
+		}
+
+		withHysteresis.quantizeWithHysteresis (nextFrame, voices);
+
+		REQUIRE (voices == expectedVoices);
+	}
+}
+
+#undef TAGS
@@ -0,0 +1,212 @@
+/*
+ * ======================================================================================
+ *  __    ____  __  __  ____  ___
+ * (  )  (_  _)(  \/  )( ___)/ __)
+ *  )(__  _)(_  )    (  )__) \__ \
+ * (____)(____)(_/\/\_)(____)(___/
+ *
+ *  This file is part of the Limes open source library and is licensed under the terms of the GNU Public License.
+ *
+ *  Commercial licenses are available; contact the maintainers at ben.the.vining@gmail.com to inquire for details.
+ *
+ * ======================================================================================
+ */
+
+#include <set>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "lharmony/lharmony.h"
+#include <catch2/catch_test_macros.hpp>
+
+#define TAGS "[audio][harmony][pitch_spelling]"
+
+using namespace limes::harmony;	 // NOLINT
+using Letter = PitchSpelling::Letter;
+using KeyType = scales::KeySignature::Type;
+
+namespace
+{
+
+[[nodiscard]] std::string spellAll (const PitchSpeller& speller)
+{
+	std::string result;
+
+	for (const auto pc : PitchClass::getAll())
+	{
+		if (! result.empty())
+			result += ' ';
+
+		result += speller.spell (pc).getString();
+	}
+
+	return result;
+}
+
+// checks that every note of the scale is spelled with a different letter, and that no two pitch classes are spelled alike
+void checkSpellings (const scales::Scale& scale, const PitchSpeller& speller)
+{
+	std::set<Letter> letters;
+
+	for (const auto pc : scale.getPitchClassSet())
+		letters.insert (speller.spell (pc).getLetter());
+
+	REQUIRE (letters.size() == 7);
+
+	std::set<std::string_view> names;
+
+	for (const auto pc : PitchClass::getAll())
+	{
+		REQUIRE (speller.spell (pc).getPitchClass() == pc);
+		names.insert (speller.spell (pc).getString());
+	}
+
+	REQUIRE (names.size() == 12);
+}
+
+}  // namespace
+
+TEST_CASE ("PitchSpelling - basics", TAGS)
+{
+	STATIC_REQUIRE (PitchSpelling {}.getString() == "C");
+	STATIC_REQUIRE (PitchSpelling::fromLineOfFifths (0) == PitchSpelling { Letter::C, 0 });
+	STATIC_REQUIRE (PitchSpelling::fromLineOfFifths (-1) == PitchSpelling { Letter::F, 0 });
+	STATIC_REQUIRE (PitchSpelling::fromLineOfFifths (6) == PitchSpelling { Letter::F, 1 });
+	STATIC_REQUIRE (PitchSpelling::fromLineOfFifths (-7) == PitchSpelling { Letter::C, -1 });
+	STATIC_REQUIRE (PitchSpelling::fromLineOfFifths (-15) == PitchSpelling { Letter::F, -2 });
+	STATIC_REQUIRE (PitchSpelling::fromLineOfFifths (19) == PitchSpelling { Letter::B, 2 });
+
+	STATIC_REQUIRE (PitchSpelling { Letter::E, 1 }.getPitchClass() == PitchClass { 5 });
+	STATIC_REQUIRE (PitchSpelling { Letter::C, -1 }.getPitchClass() == PitchClass { 11 });
+	STATIC_REQUIRE (PitchSpelling { Letter::B, 2 }.getPitchClass() == PitchClass { 1 });
+	STATIC_REQUIRE (PitchSpelling { Letter::D, -2 }.getString() == "Dbb");
+	STATIC_REQUIRE (PitchSpelling { Letter::F, 1 } != PitchSpelling { Letter::G, -1 });
+
+	// written octaves across the B-C boundary
+	STATIC_REQUIRE (PitchSpelling { Letter::B, 1 }.getOctaveNumber (60) == 3);
+	STATIC_REQUIRE (PitchSpelling { Letter::C, 0 }.getOctaveNumber (60) == 4);
+	STATIC_REQUIRE (PitchSpelling { Letter::C, -1 }.getOctaveNumber (59) == 4);
+	STATIC_REQUIRE (PitchSpelling { Letter::B, 0 }.getOctaveNumber (59) == 3);
+	STATIC_REQUIRE (PitchSpelling { Letter::B, 2 }.getOctaveNumber (61) == 3);
+
+	for (auto position = -15; position <= 19; ++position)
+	{
+		const auto spelling = PitchSpelling::fromLineOfFifths (position);
+
+		REQUIRE (spelling.getPitchClass().getAsInt() == pitchClassOfMidiNote (position * 7));
+	}
+
+	std::ostringstream stream;
+	stream << PitchSpelling { Letter::A, -1 };
+	REQUIRE (stream.str() == "Ab");
+}
+
+TEST_CASE ("PitchSpeller - key signatures", TAGS)
+{
+	STATIC_REQUIRE (PitchSpeller {}.spell (PitchClass { 6 }) == PitchSpelling { Letter::F, 1 });
+
+	REQUIRE (spellAll (PitchSpeller {}) == "C Db D Eb E F F# G Ab A Bb B");
+	REQUIRE (spellAll (PitchSpeller { scales::KeySignature { KeyType::Major, PitchClass { 0 } } }) == "C Db D Eb E F F# G Ab A Bb B");
+
+	// C# major: E# and B#
+	const PitchSpeller cSharpMajor { scales::KeySignature { 7, true, KeyType::Major } };
+
+	REQUIRE (cSharpMajor.spell (PitchClass { 5 }).getString() == "E#");
+	REQUIRE (cSharpMajor.spell (PitchClass { 0 }).getString() == "B#");
+	REQUIRE (cSharpMajor.spell (Pitch { 60 }).getOctaveNumber (60) == 3);
+
+	// Cb major: Cb and Fb
+	const PitchSpeller cFlatMajor { scales::KeySignature { 7, false, KeyType::Major } };
+
+	REQUIRE (cFlatMajor.spell (PitchClass { 11 }).getString() == "Cb");
+	REQUIRE (cFlatMajor.spell (PitchClass { 4 }).getString() == "Fb");
+
+	// A harmonic minor uses G#, and D minor uses C#
+	REQUIRE (spellAll (PitchSpeller { scales::KeySignature { KeyType::HarmonicMinor, PitchClass { 9 } } }) == "C C# D D# E F F# G G# A Bb B");
+	REQUIRE (PitchSpeller { scales::KeySignature { KeyType::NaturalMinor, PitchClass { 2 } } }.spell (PitchClass { 1 }).getString() == "C#");
+
+	// F# major and Gb major are enharmonic, but spelled differently
+	REQUIRE (PitchSpeller { scales::KeySignature { 6, true, KeyType::Major } }.spell (PitchClass { 6 }).getString() == "F#");
+	REQUIRE (PitchSpeller { scales::KeySignature { 6, false, KeyType::Major } }.spell (PitchClass { 6 }).getString() == "Gb");
+
+	for (auto index = 0UL; index < scales::KeySignature::numDenseIndices; ++index)
+	{
+		const auto key = scales::KeySignature::fromDenseIndex (index);
+
+		INFO ("Dense index: " << index);
+
+		const PitchSpeller speller { key };
+
+		checkSpellings (key, speller);
+
+		// the natural notes of the key signature's scale use its sharps or flats
+		const auto relativeMajor = key.isMajorKey() ? key : key.getRelativeKey();
+
+		for (const auto pc : relativeMajor.getPitchClassSet())
+		{
+			const auto accidentals = speller.spell (pc).getAccidentals();
+
+			if (key.isSharpKey())
+				REQUIRE (accidentals >= 0);
+			else if (key.isFlatKey())
+				REQUIRE (accidentals <= 0);
+			else
+				REQUIRE (accidentals == 0);
+		}
+	}
+}
+
+TEST_CASE ("PitchSpeller - modes", TAGS)
+{
+	REQUIRE (spellAll (PitchSpeller { scales::Mode { scales::Mode::Type::Dorian, PitchClass { 2 } } }) == "C C# D Eb E F F# G G# A Bb B");
+	REQUIRE (spellAll (PitchSpeller { scales::Mode { scales::Mode::Type::Lydian, PitchClass { 5 } } }) == "C Db D Eb E F Gb G Ab A Bb B");
+	REQUIRE (spellAll (PitchSpeller { scales::Mode { scales::Mode::Type::Locrian, PitchClass { 11 } } }) == "C C# D D# E F F# G G# A A# B");
+
+	for (auto index = 0UL; index < scales::Mode::numDenseIndices; ++index)
+	{
+		const auto mode = scales::Mode::fromDenseIndex (index);
+
+		INFO ("Dense index: " << index);
+
+		const PitchSpeller speller { mode };
+
+		checkSpellings (mode, speller);
+
+		// the notes of the mode are spelled as in the mode's key signature, when that signature exists
+		if (mode.getType() != scales::Mode::Type::Aeolian && (mode.getNumSharps() > 7 || mode.getNumFlats() > 7))
+			continue;
+
+		const PitchSpeller keySpeller { mode.getKeySignature() };
+
+		for (const auto pc : mode.getPitchClassSet())
+			REQUIRE (speller.spell (pc) == keySpeller.spell (pc));
+	}
+}
+
+TEST_CASE ("PitchSpeller - batches", TAGS)
+{
+	const PitchSpeller speller { scales::KeySignature { KeyType::Major, PitchClass { 4 } } };
+
+	PitchBuffer buffer;
+
+	for (auto i = 0; i < 100; ++i)
+		buffer.add (Pitch { 40. + static_cast<double> (i) * 0.3 });
+
+	std::vector<PitchSpelling> spellings (buffer.size());
+
+	speller.spell (buffer, spellings);
+
+	for (auto i = 0UL; i < buffer.size(); ++i)
+		REQUIRE (spellings[i] == speller.spell (buffer[i]));
+
+	const std::vector<Pitch> melody { Pitch { 64 }, Pitch { 68 }, Pitch { 63 }, Pitch { 65 } };
+
+	speller.spell (melody, spellings);
+
+	REQUIRE (spellings[0].getString() == "E");
+	REQUIRE (spellings[1].getString() == "G#");
+	REQUIRE (spellings[2].getString() == "D#");
+	REQUIRE (spellings[3].getString() == "F");
+}
+
+#undef TAGS
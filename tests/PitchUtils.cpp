@@ -12,6 +12,9 @@
  * ======================================================================================
  */
 
+#include <cmath>
+#include <limits>
+#include <vector>
 #include "lharmony/lharmony.h"
 #include <catch2/catch_all.hpp>
 
@@ -101,4 +104,166 @@ TEST_CASE ("Freq/MIDI conversion", TAGS)
 	}
 }
 
+TEST_CASE ("Octave numbers", TAGS)
+{
+	STATIC_REQUIRE (harmony::octaveNumberOfMidiNote (60) == 4);
+	STATIC_REQUIRE (harmony::octaveNumberOfMidiNote (71) == 4);
+	STATIC_REQUIRE (harmony::octaveNumberOfMidiNote (72) == 5);
+	STATIC_REQUIRE (harmony::octaveNumberOfMidiNote (0) == -1);
+	STATIC_REQUIRE (harmony::octaveNumberOfMidiNote (-1) == -2);
+	STATIC_REQUIRE (harmony::octaveNumberOfMidiNote (-12) == -2);
+	STATIC_REQUIRE (harmony::octaveNumberOfMidiNote (-13) == -3);
+
+	STATIC_REQUIRE (harmony::pitchClassOfMidiNote (61) == 1);
+	STATIC_REQUIRE (harmony::pitchClassOfMidiNote (-1) == 11);
+	STATIC_REQUIRE (harmony::pitchClassOfMidiNote (-12) == 0);
+
+	for (auto note = -128; note <= 255; ++note)
+	{
+		INFO ("MIDI note: " << note);
+
+		const auto octave = harmony::octaveNumberOfMidiNote (note);
+
+		REQUIRE (harmony::lowestNoteOfMidiOctave (octave) <= note);
+		REQUIRE (harmony::highestNoteOfMidiOctave (octave) >= note);
+		REQUIRE (harmony::lowestNoteOfMidiOctave (octave) + harmony::pitchClassOfMidiNote (note) == note);
+	}
+}
+
+TEST_CASE ("Freq/MIDI conversion - batches", TAGS)
+{
+	// an odd length, so that the scalar tail after the vectorized loop is exercised too
+	std::vector<double> midiNotes;
+
+	for (auto note = -24.; note <= 160.; note += 0.037)
+		midiNotes.push_back (note);
+
+	REQUIRE (midiNotes.size() % 2 == 1);
+
+	std::vector<double> freqs (midiNotes.size());
+
+	harmony::midiToFreq (midiNotes, freqs);
+
+	for (auto i = 0UL; i < midiNotes.size(); ++i)
+	{
+		const auto expected = harmony::midiToFreq (midiNotes[i]);
+
+		REQUIRE_THAT (freqs[i], Catch::Matchers::WithinRel (expected, 1e-15));
+	}
+
+	std::vector<double> roundTrip (freqs.size());
+
+	harmony::freqToMidi (freqs, roundTrip);
+
+	for (auto i = 0UL; i < freqs.size(); ++i)
+	{
+		REQUIRE_THAT (roundTrip[i], Catch::Matchers::WithinAbs (harmony::freqToMidi (freqs[i]), 1e-13));
+		REQUIRE_THAT (roundTrip[i], Catch::Matchers::WithinAbs (midiNotes[i], 1e-12));
+	}
+
+	SECTION ("In place")
+	{
+		auto buffer = midiNotes;
+
+		harmony::midiToFreq (buffer, buffer);
+
+		REQUIRE (buffer == freqs);
+	}
+
+	SECTION ("Invalid frequencies fall back to the scalar path")
+	{
+		const std::vector<double> input { 440., 0., -1., 880., std::numeric_limits<double>::infinity(), 220. };
+
+		std::vector<double> output (input.size());
+
+		harmony::freqToMidi (input, output);
+
+		REQUIRE_THAT (output[0], Catch::Matchers::WithinAbs (69., 1e-12));
+		REQUIRE (std::isinf (output[1]));
+		REQUIRE (std::isnan (output[2]));
+		REQUIRE_THAT (output[3], Catch::Matchers::WithinAbs (81., 1e-12));
+		REQUIRE (std::isinf (output[4]));
+		REQUIRE_THAT (output[5], Catch::Matchers::WithinAbs (57., 1e-12));
+	}
+}
+
+TEST_CASE ("Freq/MIDI conversion - approximations", TAGS)
+{
+	STATIC_REQUIRE (harmony::midiToFreq<harmony::ConversionAccuracy::Cent> (69) > 439.);
+	STATIC_REQUIRE (harmony::freqToMidi<harmony::ConversionAccuracy::Cent> (440.) < 69.01);
+
+	// checks both the scalar and batch conversions against the exact ones, across the MIDI range and the audible frequency range
+	auto check_accuracy = [] (harmony::ConversionAccuracy accuracy, double maxCents)
+	{
+		std::vector<double> midiNotes;
+
+		// the whole MIDI range, in steps of one cent
+		for (auto cents = 0; cents <= 12700; ++cents)
+			midiNotes.push_back (static_cast<double> (cents) * 0.01);
+
+		std::vector<double> freqs;
+
+		// the audible range, in steps of about 1.2 cents
+		for (auto freq = 20.; freq <= 20000.; freq *= 1.0007)
+			freqs.push_back (freq);
+
+		std::vector<double> batchFreqs (midiNotes.size());
+		std::vector<double> batchNotes (freqs.size());
+
+		harmony::midiToFreq (midiNotes, batchFreqs, accuracy);
+		harmony::freqToMidi (freqs, batchNotes, accuracy);
+
+		for (auto i = 0UL; i < midiNotes.size(); ++i)
+		{
+			const auto note = midiNotes[i];
+			const auto exact = harmony::midiToFreq (note);
+
+			const auto scalar = accuracy == harmony::ConversionAccuracy::Cent ? harmony::midiToFreq<harmony::ConversionAccuracy::Cent> (note)
+																	 : harmony::midiToFreq<harmony::ConversionAccuracy::TenthOfCent> (note);
+
+			INFO ("MIDI note: " << note);
+
+			REQUIRE (std::abs (1200. * std::log2 (scalar / exact)) < maxCents);
+			REQUIRE (std::abs (1200. * std::log2 (batchFreqs[i] / exact)) < maxCents);
+		}
+
+		for (auto i = 0UL; i < freqs.size(); ++i)
+		{
+			const auto freq = freqs[i];
+			const auto exact = harmony::freqToMidi (freq);
+
+			const auto scalar = accuracy == harmony::ConversionAccuracy::Cent ? harmony::freqToMidi<harmony::ConversionAccuracy::Cent> (freq)
+																	 : harmony::freqToMidi<harmony::ConversionAccuracy::TenthOfCent> (freq);
+
+			INFO ("Frequency: " << freq);
+
+			REQUIRE (std::abs (100. * (scalar - exact)) < maxCents);
+			REQUIRE (std::abs (100. * (batchNotes[i] - exact)) < maxCents);
+		}
+	};
+
+	SECTION ("Within 1 cent")
+	{
+		check_accuracy (harmony::ConversionAccuracy::Cent, 1.);
+	}
+
+	SECTION ("Within 0.1 cent")
+	{
+		check_accuracy (harmony::ConversionAccuracy::TenthOfCent, 0.1);
+	}
+
+	SECTION ("Exact")
+	{
+		REQUIRE (harmony::midiToFreq<harmony::ConversionAccuracy::Exact> (61.5) == harmony::midiToFreq (61.5));
+		REQUIRE (harmony::freqToMidi<harmony::ConversionAccuracy::Exact> (1234.5) == harmony::freqToMidi (1234.5));
+	}
+
+	SECTION ("Values outside the polynomials' range")
+	{
+		REQUIRE (std::isnan (harmony::midiToFreq<harmony::ConversionAccuracy::Cent> (std::numeric_limits<double>::quiet_NaN())));
+		REQUIRE (std::isinf (harmony::freqToMidi<harmony::ConversionAccuracy::Cent> (0.)));
+		REQUIRE (std::isnan (harmony::freqToMidi<harmony::ConversionAccuracy::TenthOfCent> (-10.)));
+	}
+}
+
 #undef TAGS
@@ -0,0 +1,257 @@
+/*
+ * ======================================================================================
+ *  __    ____  __  __  ____  ___
+ * (  )  (_  _)(  \/  )( ___)/ __)
+ *  )(__  _)(_  )    (  )__) \__ \
+ * (____)(____)(_/\/\_)(____)(___/
+ *
+ *  This file is part of the Limes open source library and is licensed under the terms of the GNU Public License.
+ *
+ *  Commercial licenses are available; contact the maintainers at ben.the.vining@gmail.com to inquire for details.
+ *
+ * ======================================================================================
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+#include <unordered_set>
+#include <vector>
+#include "lharmony/lharmony.h"
+#include <catch2/catch_test_macros.hpp>
+
+#define TAGS "[audio][harmony][ratio_interval]"
+
+using limes::harmony::RatioInterval;
+
+TEST_CASE ("RatioInterval - normalization", TAGS)
+{
+	STATIC_REQUIRE (RatioInterval {}.getNumerator() == 1);
+	STATIC_REQUIRE (RatioInterval {}.getDenominator() == 1);
+
+	STATIC_REQUIRE (RatioInterval { 6, 4 } == RatioInterval { 3, 2 });
+	STATIC_REQUIRE (RatioInterval { 6, 4 }.getNumerator() == 3);
+	STATIC_REQUIRE (RatioInterval { 6, 4 }.getDenominator() == 2);
+	STATIC_REQUIRE (RatioInterval { 1024, 768 } == RatioInterval { 4, 3 });
+	STATIC_REQUIRE (RatioInterval { 7, 7 } == RatioInterval {});
+
+	STATIC_REQUIRE (limes::harmony::detail::binaryGcd (0, 12) == 12);
+	STATIC_REQUIRE (limes::harmony::detail::binaryGcd (48, 180) == 12);
+	STATIC_REQUIRE (limes::harmony::detail::binaryGcd (17, 31) == 1);
+
+	for (std::uint64_t a = 1; a < 200; ++a)
+		for (std::uint64_t b = 1; b < 200; ++b)
+			REQUIRE (limes::harmony::detail::binaryGcd (a, b) == std::gcd (a, b));
+
+	STATIC_REQUIRE (RatioInterval { limes::harmony::JustRatio { 9, 8 } } == RatioInterval { 9, 8 });
+
+	REQUIRE_THROWS_AS (RatioInterval (0, 1), std::invalid_argument);
+	REQUIRE_THROWS_AS (RatioInterval (3, 0), std::invalid_argument);
+
+	REQUIRE (RatioInterval { 3, 2 }.getStringDescription() == "3/2");
+}
+
+TEST_CASE ("RatioInterval - stacking", TAGS)
+{
+	constexpr RatioInterval fifth { 3, 2 };
+	constexpr RatioInterval fourth { 4, 3 };
+	constexpr RatioInterval majorThird { 5, 4 };
+	constexpr RatioInterval octave { 2, 1 };
+
+	STATIC_REQUIRE (fifth * fourth == octave);
+	STATIC_REQUIRE (octave / fifth == fourth);
+	STATIC_REQUIRE (fifth.getReciprocal() == RatioInterval { 2, 3 });
+	STATIC_REQUIRE (fifth / fifth == RatioInterval {});
+
+	// the syntonic comma
+	STATIC_REQUIRE (fifth.pow (4) / (majorThird * octave.pow (2)) == RatioInterval { 81, 80 });
+	STATIC_REQUIRE (fifth.pow (-2) == RatioInterval { 4, 9 });
+	STATIC_REQUIRE (fifth.pow (0) == RatioInterval {});
+
+	// the Pythagorean comma
+	STATIC_REQUIRE (fifth.pow (12) / octave.pow (7) == RatioInterval { 531441, 524288 });
+
+	// stacking and unstacking many times stays exact
+	auto interval = RatioInterval {};
+
+	for (auto i = 0; i < 40; ++i)
+		interval *= fifth;
+
+	REQUIRE (interval == fifth.pow (40));
+
+	for (auto i = 0; i < 40; ++i)
+		interval /= fifth;
+
+	REQUIRE (interval == RatioInterval {});
+
+	REQUIRE_THROWS_AS (fifth.pow (41), std::overflow_error);
+	REQUIRE_THROWS_AS ((RatioInterval { std::numeric_limits<std::uint64_t>::max(), 1 } * octave), std::overflow_error);
+}
+
+TEST_CASE ("RatioInterval - comparisons", TAGS)
+{
+	STATIC_REQUIRE (RatioInterval { 3, 2 } > RatioInterval { 4, 3 });
+	STATIC_REQUIRE (RatioInterval { 81, 80 } > RatioInterval {});
+	STATIC_REQUIRE (RatioInterval { 2, 3 } < RatioInterval {});
+	STATIC_REQUIRE (! (RatioInterval { 3, 2 } < RatioInterval { 6, 4 }));
+
+	// these differ by less than a double can represent, but the comparison must still be exact
+	constexpr auto big = std::numeric_limits<std::uint64_t>::max();
+
+	STATIC_REQUIRE (RatioInterval { big - 1, big - 2 } > RatioInterval { big, big - 1 });
+	STATIC_REQUIRE (RatioInterval { big, big - 1 } < RatioInterval { big - 1, big - 2 });
+
+	std::vector<RatioInterval> lattice;
+
+	for (auto three = -6; three <= 6; ++three)
+		for (auto five = -3; five <= 3; ++five)
+			lattice.push_back ((RatioInterval { 3, 1 }.pow (three) * RatioInterval { 5, 1 }.pow (five)).getOctaveReduced());
+
+	std::sort (lattice.begin(), lattice.end());
+
+	for (auto i = 1UL; i < lattice.size(); ++i)
+	{
+		REQUIRE (lattice[i - 1] < lattice[i]);
+		REQUIRE (lattice[i - 1].getCents() < lattice[i].getCents());
+	}
+
+	const std::unordered_set<RatioInterval> unique { lattice.begin(), lattice.end() };
+
+	REQUIRE (unique.size() == lattice.size());
+}
+
+TEST_CASE ("RatioInterval - octaves", TAGS)
+{
+	STATIC_REQUIRE (RatioInterval {}.getNumOctaves() == 0);
+	STATIC_REQUIRE (RatioInterval { 3, 2 }.getNumOctaves() == 0);
+	STATIC_REQUIRE (RatioInterval { 2, 1 }.getNumOctaves() == 1);
+	STATIC_REQUIRE (RatioInterval { 5, 1 }.getNumOctaves() == 2);
+	STATIC_REQUIRE (RatioInterval { 2, 3 }.getNumOctaves() == -1);
+	STATIC_REQUIRE (RatioInterval { 1, 2 }.getNumOctaves() == -1);
+	STATIC_REQUIRE (RatioInterval { 1, 3 }.getNumOctaves() == -2);
+
+	STATIC_REQUIRE (RatioInterval { 3, 1 }.getOctaveReduced() == RatioInterval { 3, 2 });
+	STATIC_REQUIRE (RatioInterval { 4, 1 }.getOctaveReduced() == RatioInterval {});
+	STATIC_REQUIRE (RatioInterval { 1, 3 }.getOctaveReduced() == RatioInterval { 4, 3 });
+	STATIC_REQUIRE (RatioInterval { 5, 16 }.getOctaveReduced() == RatioInterval { 5, 4 });
+	STATIC_REQUIRE (RatioInterval { 81, 80 }.getOctaveReduced() == RatioInterval { 81, 80 });
+
+	for (std::uint64_t num = 1; num < 100; ++num)
+	{
+		for (std::uint64_t den = 1; den < 100; ++den)
+		{
+			const RatioInterval interval { num, den };
+
+			const auto octaves = static_cast<int> (std::floor (std::log2 (static_cast<double> (num) / static_cast<double> (den))));
+
+			// exact powers of two can round either way in floating point
+			if (interval.getOctaveReduced() != RatioInterval {})
+				REQUIRE (interval.getNumOctaves() == octaves);
+
+			const auto reduced = interval.getOctaveReduced();
+
+			REQUIRE (! (reduced < RatioInterval {}));
+			REQUIRE (reduced < RatioInterval { 2, 1 });
+			REQUIRE (reduced.isWithinPrimeLimit (interval.getPrimeLimit()));
+		}
+	}
+
+	REQUIRE_THROWS_AS (RatioInterval (2, std::numeric_limits<std::uint64_t>::max()).getOctaveReduced(), std::overflow_error);
+}
+
+TEST_CASE ("RatioInterval - prime limit and monzos", TAGS)
+{
+	STATIC_REQUIRE (RatioInterval {}.getPrimeLimit() == 1);
+	STATIC_REQUIRE (RatioInterval { 2, 1 }.getPrimeLimit() == 2);
+	STATIC_REQUIRE (RatioInterval { 3, 2 }.getPrimeLimit() == 3);
+	STATIC_REQUIRE (RatioInterval { 81, 80 }.getPrimeLimit() == 5);
+	STATIC_REQUIRE (RatioInterval { 7, 4 }.getPrimeLimit() == 7);
+	STATIC_REQUIRE (RatioInterval { 13, 11 }.getPrimeLimit() == 13);
+	STATIC_REQUIRE (RatioInterval { 4294967311ULL * 3, 2 }.getPrimeLimit() == 4294967311ULL);
+
+	STATIC_REQUIRE (RatioInterval { 81, 80 }.isWithinPrimeLimit (5));
+	STATIC_REQUIRE (! RatioInterval { 81, 80 }.isWithinPrimeLimit (3));
+	STATIC_REQUIRE (! RatioInterval { 7, 4 }.isWithinPrimeLimit (5));
+	STATIC_REQUIRE (RatioInterval {}.isWithinPrimeLimit (1));
+
+	for (std::uint64_t num = 1; num < 300; ++num)
+	{
+		const RatioInterval interval { num, 1 };
+
+		const auto limit = interval.getPrimeLimit();
+
+		REQUIRE (interval.isWithinPrimeLimit (limit));
+
+		if (limit > 1)
+			REQUIRE (! interval.isWithinPrimeLimit (limit - 1));
+	}
+
+	constexpr RatioInterval::Monzo syntonicComma { -4, 4, -1 };
+
+	STATIC_REQUIRE (RatioInterval { 81, 80 }.getMonzo() == syntonicComma);
+	STATIC_REQUIRE (RatioInterval::fromMonzo (syntonicComma) == RatioInterval { 81, 80 });
+	STATIC_REQUIRE (! RatioInterval { 59, 1 }.getMonzo().has_value());
+
+	for (std::uint64_t num = 1; num < 200; ++num)
+	{
+		for (std::uint64_t den = 1; den < 50; ++den)
+		{
+			const RatioInterval interval { num, den };
+
+			const auto monzo = interval.getMonzo();
+
+			if (interval.getPrimeLimit() > RatioInterval::monzoPrimes.back())
+			{
+				REQUIRE (! monzo.has_value());
+				continue;
+			}
+
+			REQUIRE (monzo.has_value());
+			REQUIRE (RatioInterval::fromMonzo (*monzo) == interval);
+		}
+	}
+
+	RatioInterval::Monzo tooBig {};
+	tooBig[1] = 41;
+
+	REQUIRE_THROWS_AS (RatioInterval::fromMonzo (tooBig), std::overflow_error);
+}
+
+TEST_CASE ("RatioInterval - conversions", TAGS)
+{
+	using limes::harmony::MicrotonalInterval;
+
+	STATIC_REQUIRE (RatioInterval {}.getCents() == 0.);
+	STATIC_REQUIRE (RatioInterval { 2, 1 }.getCents() == 1200.);
+	STATIC_REQUIRE (RatioInterval { 1, 2 }.getCents() == -1200.);
+
+	REQUIRE (std::abs (RatioInterval { 3, 2 }.getCents() - 701.955000865) < 1e-6);
+	REQUIRE (std::abs (RatioInterval { 81, 80 }.getCents() - 21.5062895967) < 1e-6);
+
+	// every just ratio of every interval converts exactly
+	for (auto index = 0UL; index < limes::harmony::Interval::numDenseIndices; ++index)
+	{
+		const auto interval = limes::harmony::Interval::fromDenseIndex (index);
+
+		const auto cents = interval.getCents_JustIntonation();
+		const auto ratios = interval.getJustRatios();
+
+		for (auto r = 0UL; r < ratios.size(); ++r)
+			REQUIRE (std::abs (RatioInterval { ratios[r] }.getCents() - cents[r]) < 1e-9);
+	}
+
+	constexpr MicrotonalInterval microtonal { RatioInterval { 3, 2 } };
+
+	REQUIRE (std::abs (microtonal.getCents() - 701.955) < 1e-3);
+	STATIC_REQUIRE (microtonal.getNearestCompoundInterval() == limes::harmony::CompoundInterval { 7 });
+
+	const limes::harmony::Pitch pitch { 60 };
+
+	REQUIRE (std::abs ((pitch + RatioInterval { 2, 1 }).getMidiPitch() - 72.) < 1e-9);
+	REQUIRE (std::abs ((pitch - RatioInterval { 2, 1 }).getMidiPitch() - 48.) < 1e-9);
+}
+
+#undef TAGS
@@ -0,0 +1,193 @@
+/*
+ * ======================================================================================
+ *  __    ____  __  __  ____  ___
+ * (  )  (_  _)(  \/  )( ___)/ __)
+ *  )(__  _)(_  )    (  )__) \__ \
+ * (____)(____)(_/\/\_)(____)(___/
+ *
+ *  This file is part of the Limes open source library and is licensed under the terms of the GNU Public License.
+ *
+ *  Commercial licenses are available; contact the maintainers at ben.the.vining@gmail.com to inquire for details.
+ *
+ * ======================================================================================
+ */
+
+#include <cmath>
+#include <limits>
+#include <vector>
+#include "lharmony/lharmony.h"
+#include <catch2/catch_test_macros.hpp>
+
+#define TAGS "[audio][harmony][ratio_recognizer]"
+
+using namespace limes::harmony;	 // NOLINT
+
+TEST_CASE ("RatioRecognizer - candidates", TAGS)
+{
+	const RatioRecognizer recognizer;
+
+	const auto candidates = recognizer.getCandidates();
+
+	REQUIRE (candidates.front() == RatioInterval {});
+	REQUIRE (candidates.back() == RatioInterval { 2, 1 });
+
+	for (auto i = 1UL; i < candidates.size(); ++i)
+		REQUIRE (candidates[i - 1] < candidates[i]);
+
+	for (const auto& candidate : candidates)
+	{
+		REQUIRE (candidate.isWithinPrimeLimit (5));
+		REQUIRE (candidate.getNumerator() <= 64);
+		REQUIRE (candidate.getDenominator() <= 64);
+	}
+
+	const auto contains = [&candidates] (RatioInterval ratio)
+	{ return std::find (candidates.begin(), candidates.end(), ratio) != candidates.end(); };
+
+	REQUIRE (contains (RatioInterval { 3, 2 }));
+	REQUIRE (contains (RatioInterval { 5, 4 }));
+	REQUIRE (contains (RatioInterval { 45, 32 }));
+	REQUIRE (! contains (RatioInterval { 7, 4 }));
+	REQUIRE (! contains (RatioInterval { 81, 64 }));
+
+	REQUIRE (RatioRecognizer { 7 }.getCandidates().size() > candidates.size());
+	REQUIRE (RatioRecognizer { 5, 10., 128 }.getCandidates().size() > candidates.size());
+}
+
+TEST_CASE ("RatioRecognizer - single intervals", TAGS)
+{
+	const RatioRecognizer recognizer { 7, 15. };
+
+	const auto fifth = recognizer.recognize (440., 660.);
+
+	REQUIRE (fifth.matched);
+	REQUIRE (fifth.ratio == RatioInterval { 3, 2 });
+	REQUIRE (fifth.interval == CompoundInterval { 0, Interval { 5, Interval::Quality::Perfect } });
+	REQUIRE (std::abs (fifth.errorCents) < 1e-9);
+
+	// direction doesn't matter
+	REQUIRE (recognizer.recognize (660., 440.).ratio == RatioInterval { 3, 2 });
+
+	const auto twelfth = recognizer.recognize (100., 300.);
+
+	REQUIRE (twelfth.ratio == RatioInterval { 3, 1 });
+	REQUIRE (twelfth.interval == CompoundInterval { 1, Interval { 5, Interval::Quality::Perfect } });
+
+	const auto seventh = recognizer.recognize (100., 175.);
+
+	REQUIRE (seventh.ratio == RatioInterval { 7, 4 });
+	REQUIRE (seventh.interval.getSimpleInterval() == Interval { 6, Interval::Quality::Augmented });
+
+	// a major third 5 cents sharp of just
+	const auto third = recognizer.recognizeCents (RatioInterval { 5, 4 }.getCents() + 5.);
+
+	REQUIRE (third.matched);
+	REQUIRE (third.ratio == RatioInterval { 5, 4 });
+	REQUIRE (third.interval.getSimpleInterval() == Interval { 3, Interval::Quality::Major });
+	REQUIRE (std::abs (third.errorCents - 5.) < 1e-9);
+
+	// an octave, including one just below it
+	REQUIRE (recognizer.recognizeCents (1200.).ratio == RatioInterval { 2, 1 });
+	REQUIRE (recognizer.recognizeCents (1199.5).ratio == RatioInterval { 2, 1 });
+	REQUIRE (recognizer.recognizeCents (1199.5).interval == CompoundInterval { 1, Interval {} });
+	REQUIRE (recognizer.recognizeCents (0.).ratio == RatioInterval {});
+
+	// the tritone is spelled as an augmented fourth, and 6/5 as a minor third
+	REQUIRE (recognizer.recognize (32., 45.).interval.getSimpleInterval() == Interval { 4, Interval::Quality::Augmented });
+	REQUIRE (recognizer.recognize (5., 6.).interval.getSimpleInterval() == Interval { 3, Interval::Quality::Minor });
+
+	// from a microtonal interval
+	REQUIRE (recognizer.recognize (MicrotonalInterval { 3.86 }).ratio == RatioInterval { 5, 4 });
+
+	// a quarter tone is far from any 5-limit ratio with small terms
+	const RatioRecognizer strict { 5, 5., 16 };
+
+	const auto quarterTone = strict.recognizeCents (50.);
+
+	REQUIRE (! quarterTone.matched);
+	REQUIRE (std::abs (quarterTone.errorCents) > 5.);
+
+	REQUIRE (! recognizer.recognize (440., 0.).matched);
+	REQUIRE (! recognizer.recognizeCents (std::numeric_limits<double>::quiet_NaN()).matched);
+	REQUIRE (! recognizer.recognizeCents (1200. * 70.).matched);
+
+	// sizes with more octaves than fit in an int are too large, not undefined
+	for (const auto huge : { 1e30, -1e30, std::numeric_limits<double>::max() })
+	{
+		const auto result = recognizer.recognize (MicrotonalInterval { huge });
+
+		REQUIRE (! result.matched);
+		REQUIRE (result.ratio == RatioInterval {});
+	}
+}
+
+TEST_CASE ("RatioRecognizer - every candidate is recognized", TAGS)
+{
+	for (const auto primeLimit : { 3, 5, 7, 11 })
+	{
+		const RatioRecognizer recognizer { static_cast<std::uint64_t> (primeLimit), 1., 96 };
+
+		for (const auto& candidate : recognizer.getCandidates())
+		{
+			for (const auto octaves : { 0, 1, 3 })
+			{
+				const auto ratio = candidate * RatioInterval { 2, 1 }.pow (octaves);
+
+				const auto result = recognizer.recognize (110., 110. * ratio.getRatio());
+
+				REQUIRE (result.matched);
+				REQUIRE (result.ratio == ratio);
+				REQUIRE (std::abs (result.interval.getNumSemitones() - ratio.getSemitones()) <= 1.);
+			}
+		}
+	}
+}
+
+TEST_CASE ("RatioRecognizer - batches", TAGS)
+{
+	const RatioRecognizer recognizer { 7, 10. };
+
+	std::vector<double> firstFreqs, secondFreqs;
+
+	// not a multiple of the block size or any SIMD width
+	for (auto i = 0; i < 1001; ++i)
+	{
+		firstFreqs.push_back (55. + static_cast<double> (i) * 0.731);
+		secondFreqs.push_back (firstFreqs.back() * std::exp2 (static_cast<double> (i % 97) * 0.0421));
+	}
+
+	firstFreqs[17]	= 0.;
+	secondFreqs[42] = std::numeric_limits<double>::infinity();
+
+	std::vector<RatioRecognizer::Result> results (firstFreqs.size());
+
+	for (const auto accuracy : { ConversionAccuracy::Exact, ConversionAccuracy::TenthOfCent })
+	{
+		recognizer.recognize (firstFreqs, secondFreqs, results, accuracy);
+
+		for (auto i = 0UL; i < firstFreqs.size(); ++i)
+		{
+			const auto expected = recognizer.recognize (firstFreqs[i], secondFreqs[i]);
+
+			if (i == 17 || i == 42)
+			{
+				REQUIRE (! results[i].matched);
+				continue;
+			}
+
+			if (accuracy != ConversionAccuracy::Exact)
+			{
+				// near the midpoint between two candidates, the approximation may pick the other one
+				REQUIRE (std::abs (results[i].errorCents) <= std::abs (expected.errorCents) + 0.2);
+				continue;
+			}
+
+			REQUIRE (results[i].matched == expected.matched);
+			REQUIRE (results[i].ratio == expected.ratio);
+			REQUIRE (results[i].interval == expected.interval);
+			REQUIRE (std::abs (results[i].errorCents - expected.errorCents) < 1e-6);
+		}
+	}
+}
+
+#undef TAGS
@@ -0,0 +1,49 @@
+/*
+ * ======================================================================================
+ *  __    ____  __  __  ____  ___
+ * (  )  (_  _)(  \/  )( ___)/ __)
+ *  )(__  _)(_  )    (  )__) \__ \
+ * (____)(____)(_/\/\_)(____)(___/
+ *
+ *  This file is part of the Limes open source library and is licensed under the terms of the GNU Public License.
+ *
+ *  Commercial licenses are available; contact the maintainers at ben.the.vining@gmail.com to inquire for details.
+ *
+ * ======================================================================================
+ */
+
+// A minimal program that links against lharmony and makes its first calls into the library.
+// The startup benchmark in Benchmarks.cpp launches it repeatedly to measure library load time,
+// and when run on its own it prints the latency of those first calls.
+
+#include <array>
+#include <chrono>
+#include <cstdio>
+#include "lharmony/lharmony.h"
+
+int main()
+{
+	namespace harmony = limes::harmony;
+
+	const auto start = std::chrono::steady_clock::now();
+
+	// read through a volatile so that the calls below cannot be folded at compile time
+	volatile auto semitones = 7;
+
+	const auto interval = harmony::Interval::fromNumSemitones (semitones);
+	const auto key		= harmony::scales::KeySignature { semitones % 8, true, harmony::scales::KeySignature::Type::Major };
+	const auto degrees	= key.getPitchClasses().size();
+
+	std::array<char, 8> name {};
+
+	harmony::toChars (name.data(), name.data() + name.size() - 1, harmony::Pitch { 60 + semitones });
+
+	const auto description = interval.getStringDescription();
+
+	const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds> (std::chrono::steady_clock::now() - start);
+
+	std::printf ("first call latency: %lld ns (%s, %s, %zu degrees)\n", static_cast<long long> (elapsed.count()),
+				 description.c_str(), name.data(), degrees);
+
+	return 0;
+}
@@ -0,0 +1,128 @@
+/*
+ * ======================================================================================
+ *  __    ____  __  __  ____  ___
+ * (  )  (_  _)(  \/  )( ___)/ __)
+ *  )(__  _)(_  )    (  )__) \__ \
+ * (____)(____)(_/\/\_)(____)(___/
+ *
+ *  This file is part of the Limes open source library and is licensed under the terms of the GNU Public License.
+ *
+ *  Commercial licenses are available; contact the maintainers at ben.the.vining@gmail.com to inquire for details.
+ *
+ * ======================================================================================
+ */
+
+#include <cmath>
+#include "lharmony/lharmony.h"
+#include <catch2/catch_all.hpp>
+
+#define TAGS "[audio][harmony][tuning]"
+
+using namespace limes::harmony;	 // NOLINT
+
+TEST_CASE ("TuningReference - default tuning", TAGS)
+{
+	const TuningReference tuning;
+
+	REQUIRE (tuning.getConcertPitchHz() == 440.);
+	REQUIRE (tuning == TuningReference { 440. });
+
+	for (auto note = 0; note < 128; ++note)
+		REQUIRE (tuning.getFreqHz (note) == midiToFreq (note));
+
+	for (auto note = -40.; note < 200.; note += 0.0173)
+	{
+		INFO ("MIDI pitch: " << note);
+
+		REQUIRE_THAT (tuning.getFreqHz (note), Catch::Matchers::WithinRel (midiToFreq (note), 1e-14));
+
+		REQUIRE_THAT (tuning.getMidiPitch (midiToFreq (note)), Catch::Matchers::WithinAbs (note, 1e-10));
+	}
+}
+
+TEST_CASE ("TuningReference - concert pitch", TAGS)
+{
+	const TuningReference baroque { 415. };
+
+	REQUIRE (baroque != TuningReference {});
+
+	REQUIRE (baroque.getFreqHz (69) == 415.);
+	REQUIRE (baroque.getFreqHz (57) == 207.5);
+	REQUIRE (baroque.getFreqHz (81) == 830.);
+	REQUIRE (baroque.getMidiPitch (415.) == 69.);
+
+	const TuningReference orchestra { 442. };
+
+	REQUIRE (Pitch { 69 }.getFreqHz (orchestra) == 442.);
+	REQUIRE (Pitch { 60 }.getRoundedFreqHz (orchestra) == 263);
+	REQUIRE_THAT (Pitch::fromFreq (442., orchestra).getMidiPitch(), Catch::Matchers::WithinAbs (69., 1e-12));
+
+	// the same frequency is lower in a higher tuning
+	REQUIRE (Pitch::fromFreq (440., orchestra) < Pitch::fromFreq (440.));
+
+	for (auto note = -40.; note < 200.; note += 0.0173)
+	{
+		INFO ("MIDI pitch: " << note);
+
+		REQUIRE_THAT (orchestra.getFreqHz (note), Catch::Matchers::WithinRel (midiToFreq (note) * 442. / 440., 1e-14));
+		REQUIRE_THAT (orchestra.getMidiPitch (orchestra.getFreqHz (note)), Catch::Matchers::WithinAbs (note, 1e-10));
+	}
+}
+
+TEST_CASE ("TuningReference - pitch class offsets", TAGS)
+{
+	// quarter-comma meantone, in cents relative to equal temperament
+	const TuningReference::PitchClassOffsets meantone { 10.3, -13.7, 3.4, 20.5, -3.4, 13.7, -10.3, 6.8, -17.1, 0., 17.1, -6.8 };
+
+	const TuningReference tuning { 440., meantone };
+
+	REQUIRE (tuning.getPitchClassOffset (PitchClass { 9 }) == 0.);
+	REQUIRE (tuning.getPitchClassOffset (PitchClass { 4 }) == -3.4);
+
+	REQUIRE (tuning.getFreqHz (69) == 440.);
+
+	const auto table = tuning.getFrequencyTable();
+
+	REQUIRE (table.size() == 128);
+
+	for (auto note = 0UL; note < table.size(); ++note)
+	{
+		INFO ("MIDI note: " << note);
+
+		const auto expected = midiToFreq (static_cast<double> (note) + meantone[note % 12] / 100.);
+
+		REQUIRE_THAT (table[note], Catch::Matchers::WithinRel (expected, 1e-14));
+
+		if (note > 0)
+			REQUIRE (table[note] > table[note - 1]);
+	}
+
+	// octaves outside the table are still pure
+	REQUIRE_THAT (tuning.getFreqHz (-12), Catch::Matchers::WithinRel (tuning.getFreqHz (0) * 0.5, 1e-15));
+	REQUIRE_THAT (tuning.getFreqHz (136), Catch::Matchers::WithinRel (tuning.getFreqHz (124) * 2., 1e-15));
+
+	// fractional pitches are interpolated on a log scale between the neighboring keys
+	const auto c4 = tuning.getFreqHz (60);
+	const auto cSharp4 = tuning.getFreqHz (61);
+
+	REQUIRE_THAT (tuning.getFreqHz (60.5), Catch::Matchers::WithinRel (std::sqrt (c4 * cSharp4), 1e-14));
+
+	for (auto note = -40.; note < 200.; note += 0.0173)
+	{
+		INFO ("MIDI pitch: " << note);
+
+		REQUIRE (tuning.getFreqHz (note) < tuning.getFreqHz (note + 0.0173));
+		REQUIRE_THAT (tuning.getMidiPitch (tuning.getFreqHz (note)), Catch::Matchers::WithinAbs (note, 1e-10));
+	}
+}
+
+TEST_CASE ("TuningReference - invalid frequencies", TAGS)
+{
+	const TuningReference tuning { 442. };
+
+	REQUIRE (std::isinf (tuning.getMidiPitch (0.)));
+	REQUIRE (std::isnan (tuning.getMidiPitch (-100.)));
+	REQUIRE (std::isnan (tuning.getFreqHz (std::nan (""))));
+}
+
+#undef TAGS